@@ -40,6 +40,7 @@
 #include <fastdds/dds/topic/TopicListener.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SampleIdentity.hpp>
 #include <fastdds/rtps/common/Time_t.hpp>
 
@@ -703,6 +704,16 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t ignore_participant(
             const InstanceHandle_t& handle);
 
+    /**
+     * Get the memory used by the send buffers and the discovery database of this DomainParticipant.
+     * The memory used by each DataWriter and DataReader is retrieved with their own get_memory_usage.
+     *
+     * @param [out] usage Structure to be filled with the memory used by this DomainParticipant.
+     * @return RETCODE_OK if successful, RETCODE_NOT_ENABLED if the DomainParticipant is not enabled.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_memory_usage(
+            fastdds::rtps::ParticipantMemoryUsage& usage) const;
+
     /**
      * Locally ignore a topic.
      *
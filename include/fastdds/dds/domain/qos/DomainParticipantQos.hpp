@@ -89,6 +89,8 @@ public:
                (this->timed_events_thread_ == b.timed_events_thread()) &&
                (this->discovery_server_thread_ == b.discovery_server_thread()) &&
                (this->typelookup_service_thread_ == b.typelookup_service_thread()) &&
+               (this->persistence_thread_ == b.persistence_thread()) &&
+               (this->listener_dispatch_thread_ == b.listener_dispatch_thread()) &&
 #if HAVE_SECURITY
                (this->security_log_thread_ == b.security_log_thread()) &&
 #endif // if HAVE_SECURITY
@@ -476,6 +478,68 @@ public:
         typelookup_service_thread_ = value;
     }
 
+    /**
+     * Getter for persistence service ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& persistence_thread()
+    {
+        return persistence_thread_;
+    }
+
+    /**
+     * Getter for persistence service ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& persistence_thread() const
+    {
+        return persistence_thread_;
+    }
+
+    /**
+     * Setter for the persistence service ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void persistence_thread(
+            const rtps::ThreadSettings& value)
+    {
+        persistence_thread_ = value;
+    }
+
+    /**
+     * Getter for listener dispatch ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    rtps::ThreadSettings& listener_dispatch_thread()
+    {
+        return listener_dispatch_thread_;
+    }
+
+    /**
+     * Getter for listener dispatch ThreadSettings
+     *
+     * @return rtps::ThreadSettings reference
+     */
+    const rtps::ThreadSettings& listener_dispatch_thread() const
+    {
+        return listener_dispatch_thread_;
+    }
+
+    /**
+     * Setter for the listener dispatch ThreadSettings
+     *
+     * @param value New ThreadSettings to be set
+     */
+    void listener_dispatch_thread(
+            const rtps::ThreadSettings& value)
+    {
+        listener_dispatch_thread_ = value;
+    }
+
 #if HAVE_SECURITY
     /**
      * Getter for security log ThreadSettings
@@ -551,6 +615,12 @@ private:
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     rtps::ThreadSettings typelookup_service_thread_;
 
+    //! Thread settings for the thread committing the changes of the persistence service in the background
+    rtps::ThreadSettings persistence_thread_;
+
+    //! Thread settings for the threads calling the data listeners of the DataReaders
+    rtps::ThreadSettings listener_dispatch_thread_;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     rtps::ThreadSettings security_log_thread_;
@@ -31,6 +31,7 @@
 #include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
 #include <fastdds/fastdds_dll.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/Time_t.hpp>
 #include <fastdds/dds/topic/TopicDataType.hpp>
 
@@ -500,6 +501,18 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t get_matched_subscriptions(
             std::vector<InstanceHandle_t>& subscription_handles) const;
 
+    /**
+     * @brief Get the memory used by this DataWriter: its history, its change and payload pools,
+     * and the proxies of the matched DataReaders.
+     *
+     * It only takes the DataWriter mutex for a short time, so it can be called periodically.
+     *
+     * @param [out] usage Structure to be filled with the memory used by this DataWriter.
+     * @return RETCODE_OK if successful, RETCODE_NOT_ENABLED if the DataWriter is not enabled.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * @brief Clears the DataWriter history
      *
@@ -21,6 +21,8 @@
 #define FASTDDS_DDS_SUBSCRIBER__DATAREADER_HPP
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
 #include <vector>
 
@@ -44,6 +46,7 @@
 #include <fastdds/fastdds_dll.hpp>
 
 #include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/Time_t.hpp>
 
 namespace dds {
@@ -711,6 +714,61 @@ public:
             void* data,
             SampleInfo* info);
 
+    /**
+     * Takes a collection of data samples from the DataReader as soon as they are available, without blocking the
+     * calling thread.
+     *
+     * If the DataReader has samples, they are taken and @c completion is called before returning. Otherwise, the take
+     * is left pending, and it is completed from the thread notifying the arrival of new samples (the one calling the
+     * listeners of the DataReader), taking all the samples received up to that moment. The listeners are not called
+     * for the samples taken this way. Only one take can be pending on each DataReader.
+     *
+     * The collections follow the same rules than on @ref take, and should be kept alive until @c completion is called.
+     * If the collections got a loan, it should be returned by means of @ref return_loan.
+     *
+     * @param [in,out] data_values   A LoanableCollection object where the received data samples will be returned.
+     * @param [in,out] sample_infos  A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples   The maximum number of samples to be returned. If the special value
+     *                               @ref LENGTH_UNLIMITED is provided, as many samples will be returned as are
+     *                               available, up to the limits described in the documentation for @ref read().
+     * @param [in]     completion    Function called with the result of the take. It receives RETCODE_OK when the
+     *                               collections have been filled, RETCODE_ALREADY_DELETED when the DataReader is
+     *                               deleted before any sample arrives, or any other error returned by the take.
+     *
+     * @return RETCODE_OK when @c completion has been called or will be called.
+     * RETCODE_PRECONDITION_NOT_MET when another take is pending.
+     * Any of the errors returned by @ref take otherwise, without calling @c completion.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t async_take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            std::function<void(ReturnCode_t)> completion);
+
+    /**
+     * Variant of @ref async_take returning a future which is satisfied with the result of the take.
+     *
+     * @param [in,out] data_values   A LoanableCollection object where the received data samples will be returned.
+     * @param [in,out] sample_infos  A SampleInfoSeq object where the received sample info will be returned.
+     * @param [in]     max_samples   The maximum number of samples to be returned.
+     *
+     * @return Future receiving the return code passed to the completion, or the error returned by @ref async_take.
+     * It receives RETCODE_NO_DATA when the take is cancelled with @ref cancel_async_take.
+     */
+    FASTDDS_EXPORTED_API std::future<ReturnCode_t> async_take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples = LENGTH_UNLIMITED);
+
+    /**
+     * Cancels the take left pending by @ref async_take. Its completion will not be called, and the future returned
+     * by the variant without completion receives RETCODE_NO_DATA.
+     *
+     * @return RETCODE_OK when the take has been cancelled.
+     * RETCODE_PRECONDITION_NOT_MET when there was no pending take, as it may have just been completed.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t cancel_async_take();
+
     ///@}
 
     /**
@@ -995,6 +1053,18 @@ public:
     FASTDDS_EXPORTED_API ReturnCode_t get_matched_publications(
             std::vector<InstanceHandle_t>& publication_handles) const;
 
+    /**
+     * @brief Get the memory used by this DataReader: its history, its change and payload pools,
+     * and the proxies of the matched DataWriters.
+     *
+     * It only takes the DataReader mutex for a short time, so it can be called periodically.
+     *
+     * @param [out] usage Structure to be filled with the memory used by this DataReader.
+     * @return RETCODE_OK if successful, RETCODE_NOT_ENABLED if the DataReader is not enabled.
+     */
+    FASTDDS_EXPORTED_API ReturnCode_t get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * @brief This operation creates a ReadCondition. The returned ReadCondition will be attached and belong to the
      * DataReader.
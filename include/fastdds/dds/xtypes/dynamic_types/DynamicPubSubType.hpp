@@ -15,6 +15,9 @@
 #ifndef FASTDDS_DDS_XTYPES_DYNAMIC_TYPES__DYNAMICPUBSUBTYPE_HPP
 #define FASTDDS_DDS_XTYPES_DYNAMIC_TYPES__DYNAMICPUBSUBTYPE_HPP
 
+#include <cstdint>
+#include <memory>
+
 #include <fastdds/dds/core/ReturnCode.hpp>
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/xtypes/dynamic_types/Types.hpp>
@@ -29,6 +32,7 @@ namespace dds {
 
 class DynamicType;
 class DynamicData;
+class KeyHashCache;
 
 class DynamicPubSubType : public virtual eprosima::fastdds::dds::TopicDataType
 {
@@ -36,13 +40,17 @@ class DynamicPubSubType : public virtual eprosima::fastdds::dds::TopicDataType
 
     unsigned char* key_buffer_ {nullptr};
 
+    uint32_t key_buffer_size_ {0};
+
     MD5 md5_;
 
+    std::unique_ptr<KeyHashCache> key_hash_cache_;
+
 public:
 
     //{{{ Public functions
 
-    FASTDDS_EXPORTED_API DynamicPubSubType() = default;
+    FASTDDS_EXPORTED_API DynamicPubSubType();
 
     /**
      * @brief Constructs a @ref DynamicPubSubType from a @ref DynamicType
@@ -183,6 +191,19 @@ public:
     //! Register TypeObject representation in Fast DDS TypeObjectRegistry
     FASTDDS_EXPORTED_API void register_type_object_representation() override;
 
+    /**
+     * @brief Enables a cache that maps serialized keys to their instance handle.
+     *
+     * When enabled, @ref compute_key avoids recomputing the MD5 digest of keys which were already seen.
+     * This is useful for keyed types whose serialized key is bigger than 16 bytes (i.e. string keys) and which
+     * are written repeatedly on the same instances.
+     *
+     * @param max_entries Maximum number of cached keys. When the cache is full it is emptied before storing a new
+     * key. A value of 0 disables the cache (default).
+     */
+    FASTDDS_EXPORTED_API void set_key_hash_cache_limit(
+            uint32_t max_entries);
+
     //}}}
 
 private:
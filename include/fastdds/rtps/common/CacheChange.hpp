@@ -155,6 +155,7 @@ struct FASTDDS_EXPORTED_API CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        missing_fragment_hint_ = ch_ptr->missing_fragment_hint_;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -257,6 +258,7 @@ struct FASTDDS_EXPORTED_API CacheChange_t
         fragment_size_ = fragment_size;
         fragment_count_ = 0;
         first_missing_fragment_ = 0;
+        missing_fragment_hint_ = 0;
 
         if (fragment_size > 0)
         {
@@ -396,6 +398,10 @@ private:
     // First fragment in missing list
     uint32_t first_missing_fragment_ = 0;
 
+    // A fragment known to be in the missing list, used as starting point when looking for the position of
+    // fragments received out of order. Only valid when it is not lower than first_missing_fragment_.
+    uint32_t missing_fragment_hint_ = 0;
+
     uint32_t get_next_missing_fragment(
             uint32_t fragment_index)
     {
@@ -454,13 +460,23 @@ private:
             }
             else
             {
-                // Find prev in missing list
+                // Find prev in missing list.
+                // Fragments usually arrive in order after a gap, so start from the previous position found when
+                // possible instead of traversing the whole missing list.
                 uint32_t current_frag = first_missing_fragment_;
+                if ((missing_fragment_hint_ > first_missing_fragment_) && (missing_fragment_hint_ < initial_fragment))
+                {
+                    current_frag = missing_fragment_hint_;
+                }
+
                 while (current_frag < initial_fragment)
                 {
                     uint32_t next_frag = get_next_missing_fragment(current_frag);
                     if (next_frag >= initial_fragment)
                     {
+                        // current_frag stays in the missing list, as only fragments after it are removed
+                        missing_fragment_hint_ = current_frag;
+
                         // This is the fragment previous to initial_fragment.
                         // Find future value for next by repeating next = *next until next >= last_fragment.
                         uint32_t next_missing_fragment = next_frag;
@@ -0,0 +1,85 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryUsage.hpp
+ */
+
+#ifndef FASTDDS_RTPS_COMMON__MEMORYUSAGE_HPP
+#define FASTDDS_RTPS_COMMON__MEMORYUSAGE_HPP
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * @brief Memory used by a collection of elements.
+ */
+struct MemoryUsage
+{
+    //! Number of elements allocated.
+    uint64_t elements = 0;
+
+    //! Number of bytes allocated for those elements.
+    uint64_t bytes = 0;
+};
+
+/**
+ * @brief Memory used by a writer or a reader.
+ *
+ * Bytes are counted from the size of the elements, without the memory owned by their internal collections.
+ */
+struct EndpointMemoryUsage
+{
+    //! Changes on the history.
+    MemoryUsage history;
+
+    //! Changes allocated by the change pool, both on the history and free for reuse.
+    MemoryUsage change_pool;
+
+    /**
+     * Payloads allocated by the payload pool, both in use and free for reuse.
+     * The payload pool is shared by all the writers and readers of the same topic on a participant.
+     */
+    MemoryUsage payload_pool;
+
+    //! Proxies allocated for the matched endpoints, both in use and free for reuse.
+    MemoryUsage matched_proxies;
+};
+
+/**
+ * @brief Memory used by a participant, besides the memory used by its writers and readers.
+ */
+struct ParticipantMemoryUsage
+{
+    //! Buffers allocated to send messages.
+    MemoryUsage send_buffers;
+
+    //! Discovery data of the participants, including the local one.
+    MemoryUsage discovered_participants;
+
+    //! Discovery data of the readers.
+    MemoryUsage discovered_readers;
+
+    //! Discovery data of the writers.
+    MemoryUsage discovered_writers;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_COMMON__MEMORYUSAGE_HPP
@@ -55,6 +55,15 @@ struct FlowControllerDescriptor
     //! Default value: 100ms.
     uint64_t period_ms = 100;
 
+    //! Maximum number of bytes to be sent to network in a single burst.
+    //!
+    //! When greater than 0, the bandwidth limitation is applied with a token bucket of this size.
+    //! The bucket is refilled continuously at a rate of max_bytes_per_period every period_ms, and the flow controller
+    //! waits between datagrams for the bytes they need instead of waiting for the next period.
+    //! 0 value means the bandwidth limitation is applied per period.
+    //! Default value: 0
+    uint32_t max_burst_bytes = 0;
+
     //! Thread settings for the sender thread
     ThreadSettings sender_thread;
 
@@ -65,6 +74,7 @@ struct FlowControllerDescriptor
                (this->scheduler == b.scheduler) &&
                (this->max_bytes_per_period == b.max_bytes_per_period) &&
                (this->period_ms == b.period_ms) &&
+               (this->max_burst_bytes == b.max_burst_bytes) &&
                (this->sender_thread == b.sender_thread);
     }
 
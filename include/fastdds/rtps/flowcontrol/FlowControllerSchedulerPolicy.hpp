@@ -37,7 +37,10 @@ enum class FlowControllerSchedulerPolicy : int32_t
     HIGH_PRIORITY,
     //! Priority with reservation scheduler policy: guarantee each DataWriter's minimum reservation of throughput.
     //! Samples not fitting the reservation are scheduled by priority.
-    PRIORITY_WITH_RESERVATION
+    PRIORITY_WITH_RESERVATION,
+    //! Earliest deadline first scheduler policy: samples with the nearest deadline are scheduled first to be sent to
+    //! network. The deadline of a sample is its source timestamp plus the latency budget of its DataWriter.
+    EARLIEST_DEADLINE_FIRST
 };
 
 } // namespace rtps
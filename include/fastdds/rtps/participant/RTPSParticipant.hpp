@@ -30,6 +30,7 @@
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 #include <fastdds/rtps/builtin/data/ParticipantBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/statistics/IListeners.hpp>
 #include <fastdds/fastdds_dll.hpp>
 
@@ -376,6 +377,15 @@ public:
             fastdds::rtps::SubscriptionBuiltinTopicData& data,
             const GUID_t& reader_guid) const;
 
+    /**
+     * @brief Fills the memory used by the send buffers and the discovery database of this participant.
+     * The memory used by its writers and readers is reported by each endpoint.
+     *
+     * @param[out] usage Structure to fill.
+     */
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage) const;
+
 #if HAVE_SECURITY
 
     /**
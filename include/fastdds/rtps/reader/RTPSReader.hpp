@@ -26,6 +26,7 @@
 #include <fastdds/rtps/attributes/ReaderAttributes.hpp>
 #include <fastdds/rtps/builtin/data/PublicationBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 #include <fastdds/rtps/common/SequenceNumber.hpp>
 #include <fastdds/rtps/common/Time_t.hpp>
@@ -150,6 +151,16 @@ public:
     FASTDDS_EXPORTED_API virtual bool matched_writers_guids(
             std::vector<GUID_t>& guids) const = 0;
 
+    /**
+     * @brief Get the memory used by this reader.
+     *
+     * @param[out] usage Structure to be filled with the memory used by the history, the pools and the matched writers.
+     *
+     * @note The default implementation leaves @p usage untouched.
+     */
+    FASTDDS_EXPORTED_API virtual void get_memory_usage(
+            EndpointMemoryUsage& usage) const;
+
     /**
      * @brief Read the next unread CacheChange_t from the history.
      *
@@ -301,6 +301,20 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
      */
     bool non_blocking_send;
 
+    /**
+     * Number of threads servicing the sockets of all the connections.
+     *
+     * When set to 0, which is the default, each connection is serviced by its own thread performing blocking reads.
+     * Otherwise, messages are read asynchronously by a pool of this number of threads (the accept thread included),
+     * and receive buffers are taken from a pool shared by all the connections, which keeps at most this number of
+     * unused buffers.
+     * Received messages are processed on the thread that read them, listeners included, so a slow listener delays
+     * the reception on the other connections. The \c fastdds.receive_processing.threads participant property moves
+     * that processing to a separate pool of threads.
+     * Not applied when TLS is enabled.
+     */
+    uint16_t reactor_threads;
+
     //! Add listener port to the listening_ports list
     void add_listener_port(
             uint16_t port)
@@ -35,6 +35,7 @@
 #include <fastdds/rtps/builtin/data/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/CdrSerialization.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/RemoteLocators.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/Endpoint.hpp>
@@ -199,6 +200,37 @@ public:
     FASTDDS_EXPORTED_API virtual bool matched_readers_guids(
             std::vector<GUID_t>& guids) const = 0;
 
+    /**
+     * @brief Get the memory used by this writer.
+     *
+     * @param[out] usage Structure to be filled with the memory used by the history, the pools and the matched readers.
+     *
+     * @note The default implementation leaves @p usage untouched.
+     */
+    FASTDDS_EXPORTED_API virtual void get_memory_usage(
+            EndpointMemoryUsage& usage) const;
+
+    /**
+     * @brief Get the number of repairs requested by a matched reader which were merged with the pending repair of the
+     * same change requested by another reader, so the change was sent once for all of them.
+     *
+     * @return Number of merged repairs. Always 0 for best-effort writers.
+     *
+     * @note The default implementation returns 0.
+     */
+    FASTDDS_EXPORTED_API virtual uint64_t get_merged_repairs_count() const;
+
+    /**
+     * @brief Get the number of changes of this writer which were sent after their deadline by an
+     * EARLIEST_DEADLINE_FIRST flow controller. The deadline of a change is its source timestamp plus the latency
+     * budget of the writer.
+     *
+     * @return Number of deadline misses. Always 0 for writers not using an EARLIEST_DEADLINE_FIRST flow controller.
+     *
+     * @note The default implementation returns 0.
+     */
+    FASTDDS_EXPORTED_API virtual uint64_t get_flow_controller_deadline_misses() const;
+
 #ifdef FASTDDS_STATISTICS
 
     /**
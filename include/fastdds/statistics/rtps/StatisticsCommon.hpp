@@ -206,6 +206,20 @@ protected:
      */
     void on_resent_data(
             uint32_t to_send);
+
+    /**
+     * @brief Select whether the entity counters are reported on every event or only when
+     * publish_statistics_counters_impl is called.
+     * @param aggregate true to only report the counters periodically
+     */
+    void set_statistics_counters_aggregation_impl(
+            bool aggregate);
+
+    /**
+     * @brief Report the current value of the DATA, HEARTBEAT, GAP and resent data counters that changed since
+     * the last call.
+     */
+    void publish_statistics_counters_impl();
 };
 
 // Members are private details
@@ -25,7 +25,7 @@ namespace fastdds {
 namespace dds {
 
 Condition::Condition()
-    : notifier_ (new detail::ConditionNotifier())
+    : notifier_ (new detail::ConditionNotifier(*this))
 {
 }
 
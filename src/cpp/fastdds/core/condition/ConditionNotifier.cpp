@@ -55,7 +55,7 @@ void ConditionNotifier::notify ()
     std::lock_guard<std::mutex> guard(mutex_);
     for (WaitSetImpl* wait_set : entries_)
     {
-        wait_set->wake_up();
+        wait_set->wake_up(condition_);
     }
 }
 
@@ -34,6 +34,16 @@ struct WaitSetImpl;
 
 struct ConditionNotifier
 {
+    /**
+     * Constructor.
+     * @param condition The Condition owning this notifier.
+     */
+    explicit ConditionNotifier(
+            const Condition& condition)
+        : condition_(condition)
+    {
+    }
+
     /**
      * Add a WaitSet implementation to the list of attached entries.
      * Does nothing if wait_set was already attached to this notifier.
@@ -52,7 +62,7 @@ struct ConditionNotifier
             WaitSetImpl* wait_set);
 
     /**
-     * Wake up all the WaitSet implementations attached to this notifier.
+     * Inform all the WaitSet implementations attached to this notifier that the condition may have been triggered.
      */
     void notify ();
 
@@ -66,6 +76,7 @@ struct ConditionNotifier
 
 private:
 
+    const Condition& condition_;
     std::mutex mutex_;
     eprosima::utilities::collections::unordered_vector<WaitSetImpl*> entries_;
 };
@@ -18,6 +18,7 @@
 
 #include "WaitSetImpl.hpp"
 
+#include <algorithm>
 #include <condition_variable>
 #include <mutex>
 
@@ -67,16 +68,8 @@ ReturnCode_t WaitSetImpl::attach_condition(
         // This is a new condition. Inform the notifier of our interest.
         condition.get_notifier()->attach_to(this);
 
-        {
-            // Might happen that a wait changes is_waiting_'s status. Protect it.
-            std::lock_guard<std::mutex> guard(mutex_);
-
-            // Should wake_up when adding a new triggered condition
-            if (is_waiting_ && condition.get_trigger_value())
-            {
-                cond_.notify_one();
-            }
-        }
+        // The condition may have been triggered before being attached.
+        wake_up(condition);
     }
 
     return RETCODE_OK;
@@ -97,6 +90,10 @@ ReturnCode_t WaitSetImpl::detach_condition(
     {
         // Inform the notifier we are not interested anymore.
         condition.get_notifier()->detach_from(this);
+
+        // The notifier will not add the condition again once detached.
+        std::lock_guard<std::mutex> guard(mutex_);
+        remove_ready_nts(condition);
         return RETCODE_OK;
     }
 
@@ -117,17 +114,31 @@ ReturnCode_t WaitSetImpl::wait(
 
     auto fill_active_conditions = [&]()
             {
-                bool ret_val = false;
-                active_conditions.clear();
-                for (const Condition* c : entries_)
+                if (check_all_)
+                {
+                    check_all_ = false;
+                    ready_.assign(entries_.begin(), entries_.end());
+                }
+                else
                 {
-                    if (c->get_trigger_value())
-                    {
-                        ret_val = true;
-                        active_conditions.push_back(const_cast<Condition*>(c));
-                    }
+                    // A condition may have been notified several times.
+                    std::sort(ready_.begin(), ready_.end());
+                    ready_.erase(std::unique(ready_.begin(), ready_.end()), ready_.end());
                 }
-                return ret_val;
+
+                // Only the triggered conditions are kept, as the rest will be notified when triggered.
+                active_conditions.clear();
+                auto new_end = std::remove_if(ready_.begin(), ready_.end(), [&active_conditions](const Condition* c)
+                                {
+                                    if (c->get_trigger_value())
+                                    {
+                                        active_conditions.push_back(const_cast<Condition*>(c));
+                                        return false;
+                                    }
+                                    return true;
+                                });
+                ready_.erase(new_end, ready_.end());
+                return !active_conditions.empty();
             };
 
     bool condition_value = false;
@@ -163,7 +174,34 @@ ReturnCode_t WaitSetImpl::get_conditions(
 void WaitSetImpl::wake_up()
 {
     std::lock_guard<std::mutex> guard(mutex_);
-    cond_.notify_one();
+    check_all_ = true;
+    if (is_waiting_)
+    {
+        cond_.notify_one();
+    }
+}
+
+void WaitSetImpl::wake_up(
+        const Condition& condition)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!check_all_)
+    {
+        if (ready_.size() < entries_.size())
+        {
+            ready_.push_back(&condition);
+        }
+        else
+        {
+            // Too many repeated notifications. Evaluating all the conditions is cheaper.
+            ready_.clear();
+            check_all_ = true;
+        }
+    }
+    if (is_waiting_)
+    {
+        cond_.notify_one();
+    }
 }
 
 void WaitSetImpl::will_be_deleted (
@@ -171,6 +209,13 @@ void WaitSetImpl::will_be_deleted (
 {
     std::lock_guard<std::mutex> guard(mutex_);
     entries_.remove(&condition);
+    remove_ready_nts(condition);
+}
+
+void WaitSetImpl::remove_ready_nts(
+        const Condition& condition)
+{
+    ready_.erase(std::remove(ready_.begin(), ready_.end(), &condition), ready_.end());
 }
 
 }  // namespace detail
@@ -21,6 +21,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/dds/core/condition/Condition.hpp>
 #include <fastdds/dds/core/ReturnCode.hpp>
@@ -94,10 +95,19 @@ struct WaitSetImpl
             ConditionSeq& attached_conditions) const;
 
     /**
-     * @brief Wake up this WaitSet implementation if it was waiting
+     * @brief Wake up this WaitSet implementation if it was waiting, re-evaluating all the attached conditions
      */
     void wake_up();
 
+    /**
+     * @brief Called by the notifier of an attached condition when it may have been triggered.
+     * Only the conditions notified since the last wait (and the ones returned by it) are evaluated by wait.
+     * Wakes up this WaitSet implementation if it was waiting.
+     * @param condition The Condition which may have been triggered.
+     */
+    void wake_up(
+            const Condition& condition);
+
     /**
      * @brief Called from the destructor of a Condition to inform this WaitSet implementation that the condition
      * should be automatically detached.
@@ -107,9 +117,20 @@ struct WaitSetImpl
 
 private:
 
+    /**
+     * @brief Removes a condition from the list of conditions to evaluate.
+     * @param condition The Condition to remove.
+     */
+    void remove_ready_nts(
+            const Condition& condition);
+
     mutable std::mutex mutex_;
     std::condition_variable cond_;
     eprosima::utilities::collections::unordered_vector<const Condition*> entries_;
+    //! Conditions to evaluate on the next wait: the notified ones and the ones triggered on the last evaluation.
+    std::vector<const Condition*> ready_;
+    //! Whether all the attached conditions should be evaluated on the next wait.
+    bool check_all_ = false;
     bool is_waiting_ = false;
 };
 
@@ -447,6 +447,12 @@ ReturnCode_t DomainParticipant::ignore_participant(
     return impl_->ignore_participant(handle);
 }
 
+ReturnCode_t DomainParticipant::get_memory_usage(
+        fastdds::rtps::ParticipantMemoryUsage& usage) const
+{
+    return impl_->get_memory_usage(usage);
+}
+
 ReturnCode_t DomainParticipant::ignore_topic(
         const InstanceHandle_t& handle)
 {
@@ -63,6 +63,7 @@
 #include <fastdds/utils/TypePropagation.hpp>
 #include <rtps/builtin/liveliness/WLP.hpp>
 #include <rtps/domain/RTPSDomainImpl.hpp>
+#include <utils/JobThreadPool.hpp>
 #include <utils/SystemInfo.hpp>
 #include <xmlparser/attributes/PublisherAttributes.hpp>
 #include <xmlparser/attributes/ReplierAttributes.hpp>
@@ -138,6 +139,29 @@ static size_t get_filter_max_expression_length(
     return DDSSQLFilter::DDSFilterFactory::DEFAULT_MAX_EXPRESSION_LENGTH;
 }
 
+static uint32_t get_listener_dispatch_threads(
+        const DomainParticipantQos& qos)
+{
+    constexpr const char parameter_name[] = "fastdds.listener_dispatch.threads";
+    const std::string* property = fastdds::rtps::PropertyPolicyHelper::find_property(
+        qos.properties(), parameter_name);
+    if (nullptr != property)
+    {
+        try
+        {
+            return static_cast<uint32_t>(std::stoul(*property));
+        }
+        catch (...)
+        {
+            EPROSIMA_LOG_WARNING(DOMAIN_PARTICIPANT,
+                    "Invalid value for fastdds.listener_dispatch.threads property: "
+                    << *property << ". Listeners will be called from the reception threads");
+        }
+    }
+
+    return 0;
+}
+
 DomainParticipantImpl::DomainParticipantImpl(
         DomainParticipant* dp,
         DomainId_t did,
@@ -352,6 +376,14 @@ ReturnCode_t DomainParticipantImpl::enable()
             });
     }
 
+    uint32_t listener_dispatch_threads = get_listener_dispatch_threads(qos_);
+    if (0 < listener_dispatch_threads)
+    {
+        listener_dispatch_pool_.reset(new fastdds::JobThreadPool(
+                    listener_dispatch_threads, qos_.listener_dispatch_thread(),
+                    part->get_attributes().participantID, "dds.lsn.%u.%u"));
+    }
+
     if (qos_.entity_factory().autoenable_created_entities)
     {
         // Enable topics first
@@ -950,6 +982,18 @@ ReturnCode_t DomainParticipantImpl::ignore_participant(
            RETCODE_BAD_PARAMETER;
 }
 
+ReturnCode_t DomainParticipantImpl::get_memory_usage(
+        fastdds::rtps::ParticipantMemoryUsage& usage) const
+{
+    if (nullptr == rtps_participant_)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    rtps_participant_->get_memory_usage(usage);
+    return RETCODE_OK;
+}
+
 /* TODO
    bool DomainParticipantImpl::ignore_topic(
         const InstanceHandle_t& handle)
@@ -2450,6 +2494,18 @@ bool DomainParticipantImpl::can_qos_be_updated(
         EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
                 "Participant typelookup_service_thread cannot be changed after the participant is enabled");
     }
+    if (!(to.persistence_thread() == from.persistence_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant persistence_thread cannot be changed after the participant is enabled");
+    }
+    if (!(to.listener_dispatch_thread() == from.listener_dispatch_thread()))
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant listener_dispatch_thread cannot be changed after the participant is enabled");
+    }
 #if HAVE_SECURITY
     if (!(to.security_log_thread() == from.security_log_thread()))
     {
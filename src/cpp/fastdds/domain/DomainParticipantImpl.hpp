@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <mutex>
 
 #include "fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp"
@@ -41,6 +42,7 @@
 #include <fastdds/dds/topic/Topic.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/participant/RTPSParticipantListener.hpp>
 #include <fastdds/topic/TopicProxyFactory.hpp>
 #include <rtps/reader/StatefulReader.hpp>
@@ -48,6 +50,8 @@
 namespace eprosima {
 namespace fastdds {
 
+class JobThreadPool;
+
 namespace rtps {
 
 struct PublicationBuiltinTopicData;
@@ -601,6 +605,16 @@ public:
     ReturnCode_t ignore_participant(
             const InstanceHandle_t& handle);
 
+    /**
+     * @brief Get the memory used by the send buffers and the discovery database of this participant.
+     *
+     * @param [out] usage Structure to be filled with the memory used by this participant.
+     * @return RETCODE_NOT_ENABLED if the participant is not enabled.
+     *         RETCODE_OK if successful.
+     */
+    ReturnCode_t get_memory_usage(
+            fastdds::rtps::ParticipantMemoryUsage& usage) const;
+
     /* TODO
        bool ignore_topic(
             const InstanceHandle_t& handle);
@@ -814,6 +828,16 @@ public:
         return rtps_participant_;
     }
 
+    /**
+     * Get the pool of threads dispatching the data notifications to the DataReader listeners.
+     *
+     * @return Pointer to the pool, or nullptr when the listeners are called from the reception threads.
+     */
+    fastdds::JobThreadPool* listener_dispatch_pool() const
+    {
+        return listener_dispatch_pool_.get();
+    }
+
     const TypeSupport find_type(
             const std::string& type_name) const;
 
@@ -902,6 +926,9 @@ protected:
     //!RTPSParticipant
     fastdds::rtps::RTPSParticipant* rtps_participant_;
 
+    //!Threads dispatching the data notifications to the DataReader listeners. Created on enable() when configured.
+    std::unique_ptr<fastdds::JobThreadPool> listener_dispatch_pool_;
+
     //!Participant*
     DomainParticipant* participant_;
 
@@ -294,6 +294,12 @@ ReturnCode_t DataWriter::get_matched_subscriptions(
     return impl_->get_matched_subscriptions(subscription_handles);
 }
 
+ReturnCode_t DataWriter::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    return impl_->get_memory_usage(usage);
+}
+
 ReturnCode_t DataWriter::clear_history(
         size_t* removed)
 {
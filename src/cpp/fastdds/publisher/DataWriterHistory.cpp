@@ -482,6 +482,7 @@ bool DataWriterHistory::remove_instance_changes(
 
     if (vit->second.cache_changes.empty())
     {
+        instance_deadlines_.erase(vit->first);
         keyed_changes_.erase(vit);
     }
 
@@ -511,7 +512,7 @@ bool DataWriterHistory::set_next_deadline(
             return false;
         }
 
-        keyed_changes_[handle].next_deadline_us = next_deadline_us;
+        instance_deadlines_.set(handle, next_deadline_us);
         return true;
     }
 
@@ -531,19 +532,7 @@ bool DataWriterHistory::get_next_deadline(
 
     if (topic_kind_ == WITH_KEY)
     {
-        auto min = std::min_element(
-            keyed_changes_.begin(),
-            keyed_changes_.end(),
-            [](
-                const t_m_Inst_Caches::value_type& lhs,
-                const t_m_Inst_Caches::value_type& rhs)
-            {
-                return lhs.second.next_deadline_us < rhs.second.next_deadline_us;
-            });
-
-        handle = min->first;
-        next_deadline_us = min->second.next_deadline_us;
-        return true;
+        return instance_deadlines_.front(handle, next_deadline_us);
     }
     else if (topic_kind_ == NO_KEY)
     {
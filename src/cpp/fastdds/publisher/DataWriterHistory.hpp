@@ -31,6 +31,7 @@
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <utils/collections/DeadlineQueue.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -226,7 +227,7 @@ public:
      * @brief Returns the deadline for the instance that is next going to 'expire'
      * @param handle The handle for the instance that will next miss the deadline
      * @param next_deadline_us The time point when the deadline will occur
-     * @return True if deadline could be retrieved for the given instance
+     * @return True if deadline could be retrieved for the given instance, false when no instance has a deadline
      */
     bool get_next_deadline(
             rtps::InstanceHandle_t& handle,
@@ -260,6 +261,8 @@ private:
     t_m_Inst_Caches keyed_changes_;
     //!Time point when the next deadline will occur (only used for topics with no key)
     std::chrono::steady_clock::time_point next_deadline_us_;
+    //!Instances sorted by their next deadline (only used for topics with key)
+    utilities::collections::DeadlineQueue<rtps::InstanceHandle_t> instance_deadlines_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
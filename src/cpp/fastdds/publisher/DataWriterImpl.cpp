@@ -18,6 +18,7 @@
  */
 #include <fastdds/publisher/DataWriterImpl.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 
@@ -332,6 +333,16 @@ ReturnCode_t DataWriterImpl::enable()
             w_att.endpoint.properties.properties().push_back(std::move(property));
         }
 
+        // The earliest deadline first flow controller scheduler takes the latency budget of the samples from here.
+        if (nullptr == PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.sfc.latency_budget_us") &&
+                qos_.latency_budget().duration.to_ns() > 0 &&
+                qos_.latency_budget().duration != dds::c_TimeInfinite)
+        {
+            property.name("fastdds.sfc.latency_budget_us");
+            property.value(std::to_string(qos_.latency_budget().duration.to_ns() / 1000));
+            w_att.endpoint.properties.properties().push_back(std::move(property));
+        }
+
         if (qos_.reliable_writer_qos().disable_positive_acks.enabled &&
                 qos_.reliable_writer_qos().disable_positive_acks.duration != dds::c_TimeInfinite)
         {
@@ -489,6 +500,7 @@ ReturnCode_t DataWriterImpl::enable()
         if (lifespan_expired())
         {
             lifespan_timer_->restart_timer();
+            lifespan_timer_armed_ = true;
         }
     }
 
@@ -1139,25 +1151,26 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             {
                 EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not set the next deadline in the history");
             }
-            else
+            else if (!deadline_timer_armed_)
             {
-                if (timer_owner_ == handle || timer_owner_ == InstanceHandle_t())
+                // Once armed, the timer reschedules itself for the earliest deadline each time it expires, so
+                // writing an instance only needs to update its deadline on the history
+                if (deadline_timer_reschedule())
                 {
-                    if (deadline_timer_reschedule())
-                    {
-                        deadline_timer_->cancel_timer();
-                        deadline_timer_->restart_timer();
-                    }
+                    deadline_timer_->restart_timer();
+                    deadline_timer_armed_ = true;
                 }
             }
         }
 
-        if (qos_.lifespan().duration != dds::c_TimeInfinite)
+        if (qos_.lifespan().duration != dds::c_TimeInfinite && !lifespan_timer_armed_)
         {
+            // The changes are added in timestamp order, so an armed timer expires first for an older change
             lifespan_duration_us_ = duration<double, std::ratio<1, 1000000>>(
                 qos_.lifespan().duration.to_ns() * 1e-3);
             lifespan_timer_->update_interval_millisec(qos_.lifespan().duration.to_ns() * 1e-6);
             lifespan_timer_->restart_timer();
+            lifespan_timer_armed_ = true;
         }
 
         return RETCODE_OK;
@@ -1348,6 +1361,7 @@ ReturnCode_t DataWriterImpl::set_qos(
     // Lifespan
     if (lifespan_changed)
     {
+        std::lock_guard<RecursiveTimedMutex> lock(writer_->getMutex());
         if (new_qos.lifespan().duration != dds::c_TimeInfinite)
         {
             lifespan_duration_us_ =
@@ -1357,6 +1371,7 @@ ReturnCode_t DataWriterImpl::set_qos(
         else
         {
             lifespan_timer_->cancel_timer();
+            lifespan_timer_armed_ = false;
         }
     }
 
@@ -1651,12 +1666,12 @@ bool DataWriterImpl::deadline_timer_reschedule()
     steady_clock::time_point next_deadline_us;
     if (!history_->get_next_deadline(timer_owner_, next_deadline_us))
     {
-        EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not get the next deadline from the history");
+        // No instance has a deadline to check
         return false;
     }
 
-    auto interval_ms = duration_cast<milliseconds>(next_deadline_us - steady_clock::now());
-    deadline_timer_->update_interval_millisec(static_cast<double>(interval_ms.count()));
+    duration<double, std::milli> interval_ms = next_deadline_us - steady_clock::now();
+    deadline_timer_->update_interval_millisec((std::max)(0.0, interval_ms.count()));
     return true;
 }
 
@@ -1683,6 +1698,7 @@ void DataWriterImpl::configure_deadline_timer_()
     {
         deadline_duration_us_ = std::chrono::duration<double, std::micro>::max();
         deadline_timer_->cancel_timer();
+        deadline_timer_armed_ = false;
         return;
     }
 
@@ -1692,6 +1708,7 @@ void DataWriterImpl::configure_deadline_timer_()
     if (qos_.deadline().period.to_ns() == 0)
     {
         deadline_timer_->cancel_timer();
+        deadline_timer_armed_ = false;
 
         deadline_missed_status_.total_count = std::numeric_limits<uint32_t>::max();
         deadline_missed_status_.total_count_change = std::numeric_limits<uint32_t>::max();
@@ -1704,7 +1721,14 @@ void DataWriterImpl::configure_deadline_timer_()
         return;
     }
 
-    deadline_timer_->update_interval_millisec(qos_.deadline().period.to_ns() * 1e-6);
+    // Schedule the timer again for the earliest deadline, as it could be armed with the previous period
+    deadline_timer_->cancel_timer();
+    deadline_timer_armed_ = false;
+    if (deadline_missed_status_.total_count < std::numeric_limits<uint32_t>::max() && deadline_timer_reschedule())
+    {
+        deadline_timer_->restart_timer();
+        deadline_timer_armed_ = true;
+    }
 }
 
 void DataWriterImpl::notify_deadline_missed_nts_()
@@ -1729,29 +1753,40 @@ bool DataWriterImpl::deadline_missed()
 
     assert(qos_.deadline().period != dds::c_TimeInfinite);
 
-    deadline_missed_status_.total_count++;
-    deadline_missed_status_.total_count_change++;
-    deadline_missed_status_.last_instance_handle = timer_owner_;
+    // The instance which the timer was scheduled for could have been written since then, so only the instances
+    // whose deadline has already passed are notified.
+    steady_clock::time_point now = steady_clock::now();
+    steady_clock::time_point next_deadline_us;
+    while (history_->get_next_deadline(timer_owner_, next_deadline_us) && next_deadline_us <= now)
+    {
+        deadline_missed_status_.total_count++;
+        deadline_missed_status_.total_count_change++;
+        deadline_missed_status_.last_instance_handle = timer_owner_;
 
-    notify_deadline_missed_nts_();
+        notify_deadline_missed_nts_();
 
-    // If we just reached the max -> log ONCE, stop timer, and bail.
-    if (deadline_missed_status_.total_count == std::numeric_limits<uint32_t>::max())
-    {
-        EPROSIMA_LOG_WARNING(DATA_WRITER,
-                "Maximum number of deadline missed messages reached. Stopping deadline timer.");
-        deadline_timer_->cancel_timer();
-        return false; // do not reschedule
-    }
+        // If we just reached the max -> log ONCE, stop timer, and bail.
+        if (deadline_missed_status_.total_count == std::numeric_limits<uint32_t>::max())
+        {
+            EPROSIMA_LOG_WARNING(DATA_WRITER,
+                    "Maximum number of deadline missed messages reached. Stopping deadline timer.");
+            deadline_timer_->cancel_timer();
+            deadline_timer_armed_ = false;
+            return false; // do not reschedule
+        }
 
-    if (!history_->set_next_deadline(
-                timer_owner_,
-                steady_clock::now() + duration_cast<steady_clock::duration>(deadline_duration_us_)))
-    {
-        EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not set the next deadline in the history");
-        return false;
+        if (!history_->set_next_deadline(
+                    timer_owner_,
+                    now + duration_cast<steady_clock::duration>(deadline_duration_us_)))
+        {
+            EPROSIMA_LOG_ERROR(DATA_WRITER, "Could not set the next deadline in the history");
+            deadline_timer_armed_ = false;
+            return false;
+        }
     }
-    return deadline_timer_reschedule();
+
+    deadline_timer_armed_ = deadline_timer_reschedule();
+    return deadline_timer_armed_;
 }
 
 ReturnCode_t DataWriterImpl::get_offered_deadline_missed_status(
@@ -1816,6 +1851,7 @@ bool DataWriterImpl::lifespan_expired()
         history_->remove_change_pub(earliest_change);
     }
 
+    lifespan_timer_armed_ = false;
     return false;
 }
 
@@ -2608,6 +2644,18 @@ ReturnCode_t DataWriterImpl::get_matched_subscriptions(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    if (writer_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    writer_->get_memory_usage(usage);
+    return RETCODE_OK;
+}
+
 bool DataWriterImpl::is_relevant(
         const fastdds::rtps::CacheChange_t& change,
         const fastdds::rtps::GUID_t& reader_guid) const
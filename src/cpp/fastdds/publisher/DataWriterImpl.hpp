@@ -35,6 +35,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/SerializedPayload.hpp>
 #include <fastdds/rtps/common/WriteParams.hpp>
 #include <fastdds/rtps/history/IChangePool.hpp>
@@ -410,6 +411,16 @@ public:
     ReturnCode_t get_matched_subscriptions(
             std::vector<InstanceHandle_t>& subscription_handles) const;
 
+    /**
+     * @brief Get the memory used by this DataWriter.
+     *
+     * @param[out] usage Structure to be filled with the memory used by the history, the pools and the matched readers.
+     * @return @ref RETCODE_OK if the operation succeeds.
+     * @return @ref RETCODE_NOT_ENABLED if the DataWriter has not been enabled.
+     */
+    ReturnCode_t get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     /**
      * Retrieve the publication data discovery information.
      *
@@ -550,9 +561,12 @@ protected:
     //! Deadline duration in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> deadline_duration_us_;
 
-    //! The current timer owner, i.e. the instance which started the deadline timer
+    //! The current timer owner, i.e. the instance with the earliest deadline when the timer was scheduled
     InstanceHandle_t timer_owner_;
 
+    //! Whether the deadline timer is scheduled. Protected by the writer mutex.
+    bool deadline_timer_armed_ = false;
+
     //! The publication matched status
     PublicationMatchedStatus publication_matched_status_;
 
@@ -571,6 +585,9 @@ protected:
     //! The lifespan duration, in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
+    //! Whether the lifespan timer is scheduled. Protected by the writer mutex.
+    bool lifespan_timer_armed_ = false;
+
     DataWriter* user_datawriter_ = nullptr;
 
     bool is_data_sharing_compatible_ = false;
@@ -662,8 +679,8 @@ protected:
     bool deadline_missed();
 
     /**
-     * @brief A method to reschedule the deadline timer
-     * @return true if deadline rescheduling succeeded, false otherwise
+     * @brief A method to reschedule the deadline timer for the earliest deadline of the instances
+     * @return true if deadline rescheduling succeeded, false when there is no deadline to check
      */
     bool deadline_timer_reschedule();
 
@@ -47,6 +47,17 @@ public:
 
 protected:
 
+    size_t change_size() const final
+    {
+        return sizeof(DataWriterFilteredChange);
+    }
+
+    fastdds::rtps::CacheChange_t* construct_change(
+            void* storage) const final
+    {
+        return new (storage) DataWriterFilteredChange(filter_allocation_);
+    }
+
     fastdds::rtps::CacheChange_t* create_change() const final
     {
         return new DataWriterFilteredChange(filter_allocation_);
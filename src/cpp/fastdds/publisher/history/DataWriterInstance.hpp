@@ -19,8 +19,6 @@
 #ifndef _FASTDDS_PUBLISHER_HISTORY_DATAWRITERINSTANCE_HPP_
 #define _FASTDDS_PUBLISHER_HISTORY_DATAWRITERINSTANCE_HPP_
 
-#include <chrono>
-
 #include <fastdds/rtps/common/CacheChange.hpp>
 #include <fastdds/rtps/common/ChangeKind_t.hpp>
 #include <fastdds/rtps/common/SerializedPayload.hpp>
@@ -37,8 +35,6 @@ struct DataWriterInstance
 {
     //! A vector of cache changes
     std::vector<fastdds::rtps::CacheChange_t*> cache_changes;
-    //! The time when the group will miss the deadline
-    std::chrono::steady_clock::time_point next_deadline_us;
     //! Serialized payload for key holder
     fastdds::rtps::SerializedPayload_t key_payload;
 
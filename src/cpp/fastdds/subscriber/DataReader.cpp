@@ -31,6 +31,46 @@ using namespace fastdds::rtps;
 namespace fastdds {
 namespace dds {
 
+namespace {
+
+/**
+ * Promise behind the future returned by DataReader::async_take.
+ * It is satisfied with RETCODE_NO_DATA when destroyed without a result, which happens when the completion holding it
+ * is discarded by DataReader::cancel_async_take.
+ */
+class AsyncTakePromise
+{
+public:
+
+    ~AsyncTakePromise()
+    {
+        if (!satisfied_)
+        {
+            promise_.set_value(RETCODE_NO_DATA);
+        }
+    }
+
+    std::future<ReturnCode_t> get_future()
+    {
+        return promise_.get_future();
+    }
+
+    void set_value(
+            ReturnCode_t ret_code)
+    {
+        satisfied_ = true;
+        promise_.set_value(ret_code);
+    }
+
+private:
+
+    std::promise<ReturnCode_t> promise_;
+
+    bool satisfied_ = false;
+};
+
+} // namespace
+
 DataReader::DataReader(
         DataReaderImpl* impl,
         const StatusMask& mask)
@@ -271,6 +311,41 @@ ReturnCode_t DataReader::take_next_sample(
     return impl_->take_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::async_take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        std::function<void(ReturnCode_t)> completion)
+{
+    return impl_->async_take(data_values, sample_infos, max_samples, std::move(completion));
+}
+
+std::future<ReturnCode_t> DataReader::async_take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples)
+{
+    auto promise = std::make_shared<AsyncTakePromise>();
+    std::future<ReturnCode_t> result = promise->get_future();
+
+    ReturnCode_t ret_code = impl_->async_take(data_values, sample_infos, max_samples,
+                    [promise](ReturnCode_t completion_code)
+                    {
+                        promise->set_value(completion_code);
+                    });
+    if (RETCODE_OK != ret_code)
+    {
+        promise->set_value(ret_code);
+    }
+
+    return result;
+}
+
+ReturnCode_t DataReader::cancel_async_take()
+{
+    return impl_->cancel_async_take();
+}
+
 ReturnCode_t DataReader::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -403,6 +478,12 @@ ReturnCode_t DataReader::get_matched_publications(
     return impl_->get_matched_publications(publication_handles);
 }
 
+ReturnCode_t DataReader::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    return impl_->get_memory_usage(usage);
+}
+
 ReadCondition* DataReader::create_readcondition(
         SampleStateMask sample_states,
         ViewStateMask view_states,
@@ -17,6 +17,7 @@
  */
 #include <fastdds/subscriber/DataReaderImpl.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
@@ -113,6 +114,7 @@ DataReaderImpl::DataReaderImpl(
 #pragma warning (disable : 4355 )
     , listener_(listener)
     , reader_listener_(this)
+    , data_available_dispatch_(this)
     , deadline_duration_us_(qos_.deadline().period.to_ns() * 1e-3)
     , lifespan_duration_us_(qos_.lifespan().duration.to_ns() * 1e-3)
     , sample_info_pool_(qos)
@@ -244,6 +246,8 @@ ReturnCode_t DataReaderImpl::enable()
         att.endpoint.set_data_sharing_configuration(datasharing);
     }
 
+    listener_dispatch_pool_ = subscriber_->get_participant_impl()->listener_dispatch_pool();
+
     std::shared_ptr<IPayloadPool> pool = get_payload_pool();
     RTPSReader* reader = RTPSDomain::createRTPSReader(
         subscriber_->rtps_participant(),
@@ -321,6 +325,14 @@ void DataReaderImpl::disable()
 
 void DataReaderImpl::stop()
 {
+    fastdds::JobThreadPool* listener_dispatch_pool = listener_dispatch_pool_.exchange(nullptr);
+    if (nullptr != listener_dispatch_pool)
+    {
+        // Wait for a listener being called from the pool, and discard a pending notification.
+        // Notifications submitted afterwards by a thread that already read the pool are ignored once removed.
+        listener_dispatch_pool->remove(&data_available_dispatch_);
+    }
+
     delete lifespan_timer_;
     delete deadline_timer_;
 
@@ -332,6 +344,17 @@ void DataReaderImpl::stop()
 
     if (reader_ != nullptr)
     {
+        std::function<void(ReturnCode_t)> completion;
+        {
+            std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+            completion = std::move(async_take_.completion);
+            async_take_ = AsyncTake();
+        }
+        if (completion)
+        {
+            completion(RETCODE_ALREADY_DELETED);
+        }
+
         EPROSIMA_LOG_INFO(DATA_READER, "Removing " << guid().entityId << " in topic: " << topic_->get_name());
         RTPSDomain::removeRTPSReader(reader_);
         reader_ = nullptr;
@@ -390,23 +413,15 @@ void DataReaderImpl::set_read_communication_status(
 {
     if (trigger_value)
     {
-        auto user_reader = user_datareader_;
-
-        // First check if we can handle with on_data_on_readers
-        SubscriberListener* subscriber_listener =
-                subscriber_->get_listener_for(StatusMask::data_on_readers());
-        if (subscriber_listener != nullptr)
+        fastdds::JobThreadPool* listener_dispatch_pool = listener_dispatch_pool_.load();
+        if (nullptr != listener_dispatch_pool)
         {
-            subscriber_listener->on_data_on_readers(subscriber_->user_subscriber_);
+            // Notifications arriving before the listener is called are coalesced into a single call.
+            listener_dispatch_pool->submit(&data_available_dispatch_);
         }
         else
         {
-            // If not, try with on_data_available
-            DataReaderListener* listener = get_listener_for(StatusMask::data_available());
-            if (listener != nullptr)
-            {
-                listener->on_data_available(user_reader);
-            }
+            notify_data_available();
         }
     }
 
@@ -417,6 +432,34 @@ void DataReaderImpl::set_read_communication_status(
     user_datareader_->get_statuscondition().get_impl()->set_status(notify_status, trigger_value);
 }
 
+void DataReaderImpl::notify_data_available()
+{
+    if (try_complete_async_take())
+    {
+        // The samples notified were taken by the async_take, and the DataReader may no longer exist.
+        return;
+    }
+
+    auto user_reader = user_datareader_;
+
+    // First check if we can handle with on_data_on_readers
+    SubscriberListener* subscriber_listener =
+            subscriber_->get_listener_for(StatusMask::data_on_readers());
+    if (subscriber_listener != nullptr)
+    {
+        subscriber_listener->on_data_on_readers(subscriber_->user_subscriber_);
+    }
+    else
+    {
+        // If not, try with on_data_available
+        DataReaderListener* listener = get_listener_for(StatusMask::data_available());
+        if (listener != nullptr)
+        {
+            listener->on_data_available(user_reader);
+        }
+    }
+}
+
 ReturnCode_t DataReaderImpl::check_collection_preconditions_and_calc_max_samples(
         LoanableCollection& data_values,
         SampleInfoSeq& sample_infos,
@@ -799,6 +842,103 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     return read_or_take_next_sample(data, info, true);
 }
 
+ReturnCode_t DataReaderImpl::async_take(
+        LoanableCollection& data_values,
+        SampleInfoSeq& sample_infos,
+        int32_t max_samples,
+        std::function<void(ReturnCode_t)> completion)
+{
+    if (reader_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    if (!completion)
+    {
+        return RETCODE_BAD_PARAMETER;
+    }
+
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
+
+    if (async_take_.completion)
+    {
+        EPROSIMA_LOG_WARNING(DATA_READER, "DataReader " << guid() << " already has a pending async_take");
+        return RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    // Samples are checked while holding the mutex of the reader, so new samples will find the take pending.
+    ReturnCode_t ret_code = take(data_values, sample_infos, max_samples);
+    if (RETCODE_NO_DATA == ret_code)
+    {
+        async_take_.data_values = &data_values;
+        async_take_.sample_infos = &sample_infos;
+        async_take_.max_samples = max_samples;
+        async_take_.completion = std::move(completion);
+        return RETCODE_OK;
+    }
+
+    if (RETCODE_OK == ret_code)
+    {
+        lock.unlock();
+        completion(ret_code);
+    }
+
+    return ret_code;
+}
+
+ReturnCode_t DataReaderImpl::cancel_async_take()
+{
+    if (reader_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    // The cancelled completion is destroyed outside the lock, as its captures may wake up other threads.
+    std::function<void(ReturnCode_t)> completion;
+
+    {
+        std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+
+        if (!async_take_.completion)
+        {
+            return RETCODE_PRECONDITION_NOT_MET;
+        }
+
+        completion = std::move(async_take_.completion);
+        async_take_ = AsyncTake();
+    }
+
+    return RETCODE_OK;
+}
+
+bool DataReaderImpl::try_complete_async_take()
+{
+    std::function<void(ReturnCode_t)> completion;
+    ReturnCode_t ret_code = RETCODE_OK;
+
+    {
+        std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+
+        if (!async_take_.completion)
+        {
+            return false;
+        }
+
+        // Takes all the samples received since the notification, up to the requested maximum.
+        ret_code = take(*async_take_.data_values, *async_take_.sample_infos, async_take_.max_samples);
+        if (RETCODE_NO_DATA == ret_code)
+        {
+            return false;
+        }
+
+        completion = std::move(async_take_.completion);
+        async_take_ = AsyncTake();
+    }
+
+    completion(ret_code);
+    return true;
+}
+
 ReturnCode_t DataReaderImpl::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -904,6 +1044,7 @@ ReturnCode_t DataReaderImpl::set_qos(
         // Lifespan
         if (old_qos.lifespan().duration != qos_.lifespan().duration)
         {
+            std::lock_guard<RecursiveTimedMutex> lock(reader_->getMutex());
             if (qos_.lifespan().duration != dds::c_TimeInfinite)
             {
                 lifespan_duration_us_ =
@@ -913,6 +1054,7 @@ ReturnCode_t DataReaderImpl::set_qos(
             else
             {
                 lifespan_timer_->cancel_timer();
+                lifespan_timer_armed_ = false;
             }
         }
     }
@@ -1112,12 +1254,14 @@ bool DataReaderImpl::on_new_cache_change_added(
         {
             EPROSIMA_LOG_ERROR(DATA_READER, "Could not set next deadline in the history");
         }
-        else if (timer_owner_ == change->instanceHandle || timer_owner_ == InstanceHandle_t())
+        else if (!deadline_timer_armed_)
         {
+            // Once armed, the timer reschedules itself for the earliest deadline each time it expires, so
+            // receiving a sample only needs to update the deadline of its instance on the history
             if (deadline_timer_reschedule())
             {
-                deadline_timer_->cancel_timer();
                 deadline_timer_->restart_timer();
+                deadline_timer_armed_ = true;
             }
         }
     }
@@ -1148,6 +1292,7 @@ bool DataReaderImpl::on_new_cache_change_added(
             // As the history is sorted by timestamp, this means that the new change has the smallest timestamp
             // We have to stop the timer as this will be the next change to expire
             lifespan_timer_->cancel_timer();
+            lifespan_timer_armed_ = false;
         }
     }
     else
@@ -1155,11 +1300,14 @@ bool DataReaderImpl::on_new_cache_change_added(
         EPROSIMA_LOG_ERROR(DATA_READER, "A change was added to history that could not be retrieved");
     }
 
-    // Update and restart the timer
-    // If the timer is already running this will not have any effect
-    fastdds::rtps::Time_t interval = expiration_ts - current_ts;
-    lifespan_timer_->update_interval_millisec(interval.to_ns() * 1e-6);
-    lifespan_timer_->restart_timer();
+    // An armed timer expires first for an older change, and reschedules itself when it does
+    if (!lifespan_timer_armed_)
+    {
+        fastdds::rtps::Time_t interval = expiration_ts - current_ts;
+        lifespan_timer_->update_interval_millisec(interval.to_ns() * 1e-6);
+        lifespan_timer_->restart_timer();
+        lifespan_timer_armed_ = true;
+    }
     return true;
 }
 
@@ -1248,6 +1396,18 @@ ReturnCode_t DataReaderImpl::get_matched_publications(
     return ret;
 }
 
+ReturnCode_t DataReaderImpl::get_memory_usage(
+        fastdds::rtps::EndpointMemoryUsage& usage) const
+{
+    if (reader_ == nullptr)
+    {
+        return RETCODE_NOT_ENABLED;
+    }
+
+    reader_->get_memory_usage(usage);
+    return RETCODE_OK;
+}
+
 bool DataReaderImpl::deadline_timer_reschedule()
 {
     std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex());
@@ -1259,12 +1419,12 @@ bool DataReaderImpl::deadline_timer_reschedule()
     steady_clock::time_point next_deadline_us;
     if (!history_->get_next_deadline(timer_owner_, next_deadline_us))
     {
-        EPROSIMA_LOG_ERROR(DATA_READER, "Could not get the next deadline from the history");
+        // No instance has a deadline to check
         return false;
     }
-    auto interval_ms = duration_cast<milliseconds>(next_deadline_us - steady_clock::now());
+    duration<double, std::milli> interval_ms = next_deadline_us - steady_clock::now();
 
-    deadline_timer_->update_interval_millisec(static_cast<double>(interval_ms.count()));
+    deadline_timer_->update_interval_millisec((std::max)(0.0, interval_ms.count()));
     return true;
 }
 
@@ -1291,6 +1451,7 @@ void DataReaderImpl::configure_deadline_timer_()
     {
         deadline_duration_us_ = std::chrono::duration<double, std::micro>::max();
         deadline_timer_->cancel_timer();
+        deadline_timer_armed_ = false;
         return;
     }
 
@@ -1300,6 +1461,7 @@ void DataReaderImpl::configure_deadline_timer_()
     if (qos_.deadline().period.to_ns() == 0)
     {
         deadline_timer_->cancel_timer();
+        deadline_timer_armed_ = false;
 
         deadline_missed_status_.total_count = std::numeric_limits<uint32_t>::max();
         deadline_missed_status_.total_count_change = std::numeric_limits<uint32_t>::max();
@@ -1312,7 +1474,14 @@ void DataReaderImpl::configure_deadline_timer_()
         return;
     }
 
-    deadline_timer_->update_interval_millisec(qos_.deadline().period.to_ns() * 1e-6);
+    // Schedule the timer again for the earliest deadline, as it could be armed with the previous period
+    deadline_timer_->cancel_timer();
+    deadline_timer_armed_ = false;
+    if (deadline_missed_status_.total_count < std::numeric_limits<uint32_t>::max() && deadline_timer_reschedule())
+    {
+        deadline_timer_->restart_timer();
+        deadline_timer_armed_ = true;
+    }
 }
 
 void DataReaderImpl::notify_deadline_missed_nts_()
@@ -1338,29 +1507,40 @@ bool DataReaderImpl::deadline_missed()
 
     assert(qos_.deadline().period != dds::c_TimeInfinite);
 
-    deadline_missed_status_.total_count++;
-    deadline_missed_status_.total_count_change++;
-    deadline_missed_status_.last_instance_handle = timer_owner_;
+    // The instance which the timer was scheduled for could have received samples since then, so only the instances
+    // whose deadline has already passed are notified.
+    steady_clock::time_point now = steady_clock::now();
+    steady_clock::time_point next_deadline_us;
+    while (history_->get_next_deadline(timer_owner_, next_deadline_us) && next_deadline_us <= now)
+    {
+        deadline_missed_status_.total_count++;
+        deadline_missed_status_.total_count_change++;
+        deadline_missed_status_.last_instance_handle = timer_owner_;
+
+        notify_deadline_missed_nts_();
 
-    notify_deadline_missed_nts_();
+        // If we just reached the max -> log ONCE, stop timer, and bail
+        if (deadline_missed_status_.total_count == std::numeric_limits<uint32_t>::max())
+        {
+            EPROSIMA_LOG_WARNING(DATA_READER,
+                    "Maximum number of deadline missed messages reached. Stopping deadline timer.");
+            deadline_timer_->cancel_timer();
+            deadline_timer_armed_ = false;
+            return false; // do not reschedule
+        }
 
-    // If we just reached the max -> log ONCE, stop timer, and bail
-    if (deadline_missed_status_.total_count == std::numeric_limits<uint32_t>::max())
-    {
-        EPROSIMA_LOG_WARNING(DATA_READER,
-                "Maximum number of deadline missed messages reached. Stopping deadline timer.");
-        deadline_timer_->cancel_timer();
-        return false; // do not reschedule
+        if (!history_->set_next_deadline(
+                    timer_owner_,
+                    now + duration_cast<steady_clock::duration>(deadline_duration_us_), true))
+        {
+            EPROSIMA_LOG_ERROR(DATA_READER, "Could not set next deadline in the history");
+            deadline_timer_armed_ = false;
+            return false;
+        }
     }
 
-    if (!history_->set_next_deadline(
-                timer_owner_,
-                steady_clock::now() + duration_cast<steady_clock::duration>(deadline_duration_us_), true))
-    {
-        EPROSIMA_LOG_ERROR(DATA_READER, "Could not set next deadline in the history");
-        return false;
-    }
-    return deadline_timer_reschedule();
+    deadline_timer_armed_ = deadline_timer_reschedule();
+    return deadline_timer_armed_;
 }
 
 ReturnCode_t DataReaderImpl::get_requested_deadline_missed_status(
@@ -1408,6 +1588,7 @@ bool DataReaderImpl::lifespan_expired()
         try_notify_read_conditions();
     }
 
+    lifespan_timer_armed_ = false;
     return false;
 }
 
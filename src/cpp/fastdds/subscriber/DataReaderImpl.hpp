@@ -20,6 +20,8 @@
 #ifndef FASTDDS_SUBSCRIBER__DATAREADERIMPL_HPP
 #define FASTDDS_SUBSCRIBER__DATAREADERIMPL_HPP
 
+#include <atomic>
+#include <functional>
 #include <mutex>
 
 #include <fastdds/dds/core/ReturnCode.hpp>
@@ -35,6 +37,7 @@
 #include <fastdds/rtps/attributes/ReaderAttributes.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/history/IPayloadPool.hpp>
 #include <fastdds/rtps/reader/ReaderListener.hpp>
 
@@ -45,6 +48,7 @@
 #include <fastdds/subscriber/history/DataReaderHistory.hpp>
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
+#include <utils/JobThreadPool.hpp>
 #include <rtps/history/ITopicPayloadPool.h>
 
 namespace eprosima {
@@ -187,6 +191,14 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t async_take(
+            LoanableCollection& data_values,
+            SampleInfoSeq& sample_infos,
+            int32_t max_samples,
+            std::function<void(ReturnCode_t)> completion);
+
+    ReturnCode_t cancel_async_take();
+
     ///@}
 
     ReturnCode_t return_loan(
@@ -260,6 +272,16 @@ public:
     ReturnCode_t get_matched_publications(
             std::vector<InstanceHandle_t>& publication_handles) const;
 
+    /**
+     * @brief Get the memory used by this DataReader.
+     *
+     * @param[out] usage Structure to be filled with the memory used by the history, the pools and the matched writers.
+     * @return @ref RETCODE_OK if the operation succeeds.
+     * @return @ref RETCODE_NOT_ENABLED if the DataReader has not been enabled.
+     */
+    ReturnCode_t get_memory_usage(
+            fastdds::rtps::EndpointMemoryUsage& usage) const;
+
     ReturnCode_t get_requested_deadline_missed_status(
             RequestedDeadlineMissedStatus& status);
 
@@ -519,15 +541,58 @@ protected:
     }
     reader_listener_;
 
+    //! Job calling the data listeners from the listener dispatch pool of the participant.
+    class DataAvailableDispatch : public fastdds::JobThreadPool::Job
+    {
+    public:
+
+        using time_point = fastdds::JobThreadPool::time_point;
+
+        DataAvailableDispatch(
+                DataReaderImpl* data_reader)
+            : data_reader_(data_reader)
+        {
+        }
+
+        time_point execute() override
+        {
+            data_reader_->notify_data_available();
+            return (time_point::max)();
+        }
+
+    private:
+
+        DataReaderImpl* data_reader_;
+    }
+    data_available_dispatch_;
+
+    //! Pool calling the data listeners, or nullptr when they are called from the thread receiving the data.
+    //! Atomic, as it is cleared on stop() while the data is being received.
+    std::atomic<fastdds::JobThreadPool*> listener_dispatch_pool_{nullptr};
+
+    //! Take requested by async_take waiting for samples. Protected by the mutex of the RTPS reader.
+    struct AsyncTake
+    {
+        LoanableCollection* data_values = nullptr;
+        SampleInfoSeq* sample_infos = nullptr;
+        int32_t max_samples = LENGTH_UNLIMITED;
+        //! Empty when there is no pending take.
+        std::function<void(ReturnCode_t)> completion;
+    }
+    async_take_;
+
     //! A timer used to check for deadlines
     fastdds::rtps::TimedEvent* deadline_timer_ = nullptr;
 
     //! Deadline duration in microseconds
     std::chrono::duration<double, std::ratio<1, 1000000>> deadline_duration_us_;
 
-    //! The current timer owner, i.e. the instance which started the deadline timer
+    //! The current timer owner, i.e. the instance with the earliest deadline when the timer was scheduled
     fastdds::rtps::InstanceHandle_t timer_owner_;
 
+    //! Whether the deadline timer is scheduled. Protected by the reader mutex.
+    bool deadline_timer_armed_ = false;
+
     //! Subscription matched status
     SubscriptionMatchedStatus subscription_matched_status_;
 
@@ -551,6 +616,9 @@ protected:
     //! The lifespan duration
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
+    //! Whether the lifespan timer is scheduled. Protected by the reader mutex.
+    bool lifespan_timer_armed_ = false;
+
     DataReader* user_datareader_ = nullptr;
 
     std::shared_ptr<detail::SampleLoanManager> sample_pool_;
@@ -640,6 +708,16 @@ protected:
     void set_read_communication_status(
             bool trigger_value);
 
+    //! Calls on_data_on_readers on the subscriber listener or, if not handled, on_data_available on the listener.
+    void notify_data_available();
+
+    /**
+     * Takes the samples of a pending async_take and calls its completion, if there are samples available.
+     *
+     * @return true if the completion was called. The completion may have deleted this DataReader.
+     */
+    bool try_complete_async_take();
+
     void update_subscription_matched_status(
             const fastdds::rtps::MatchingInfo& status);
 
@@ -662,7 +740,8 @@ protected:
     bool deadline_missed();
 
     /**
-     * @brief A method to reschedule the deadline timer
+     * @brief A method to reschedule the deadline timer for the earliest deadline of the instances
+     * @return true if deadline rescheduling succeeded, false when there is no deadline to check
      */
     bool deadline_timer_reschedule();
 
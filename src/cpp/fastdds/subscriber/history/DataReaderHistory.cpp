@@ -432,6 +432,7 @@ bool DataReaderHistory::find_key(
         if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state)
         {
             data_available_instances_.erase(vit->first);
+            instance_deadlines_.erase(vit->first);
             instances_.erase(vit);
             vit_out = instances_.emplace(handle,
                             std::make_shared<DataReaderInstance>(key_changes_allocation_,
@@ -579,7 +580,7 @@ bool DataReaderHistory::set_next_deadline(
     {
         it->second->deadline_missed();
     }
-    it->second->next_deadline_us = next_deadline_us;
+    instance_deadlines_.set(handle, next_deadline_us);
     return true;
 }
 
@@ -593,17 +594,7 @@ bool DataReaderHistory::get_next_deadline(
         return false;
     }
     std::lock_guard<RecursiveTimedMutex> guard(*getMutex());
-    auto min = std::min_element(instances_.begin(),
-                    instances_.end(),
-                    [](
-                        const InstanceCollection::value_type& lhs,
-                        const InstanceCollection::value_type& rhs)
-                    {
-                        return lhs.second->next_deadline_us < rhs.second->next_deadline_us;
-                    });
-    handle = min->first;
-    next_deadline_us = min->second->next_deadline_us;
-    return true;
+    return instance_deadlines_.front(handle, next_deadline_us);
 }
 
 uint64_t DataReaderHistory::get_unread_count(
@@ -702,6 +693,7 @@ void DataReaderHistory::check_and_remove_instance(
                 instance->alive_writers.empty() &&
                 instance_info->first.isDefined())
         {
+            instance_deadlines_.erase(instance_info->first);
             instances_.erase(instance_info->first);
         }
 
@@ -45,6 +45,7 @@
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 
 #include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+#include <utils/collections/DeadlineQueue.hpp>
 
 #include "DataReaderHistoryCounters.hpp"
 #include "DataReaderInstance.hpp"
@@ -262,7 +263,7 @@ public:
      * @param handle The handle to the instance
      * @param next_deadline_us The time point when the instance will miss the deadline
      *
-     * @return True if the deadline was retrieved successfully
+     * @return True if the deadline was retrieved successfully, false when no instance has a deadline
      */
     bool get_next_deadline(
             InstanceHandle_t& handle,
@@ -387,6 +388,8 @@ private:
     InstanceCollection instances_;
     //!Collection of DataReaderInstance objects with available data, accessible by their handle
     InstanceCollection data_available_instances_;
+    //!Handles of the instances sorted by their next deadline
+    utilities::collections::DeadlineQueue<InstanceHandle_t> instance_deadlines_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -19,7 +19,6 @@
 #ifndef _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCE_HPP_
 #define _FASTDDS_SUBSCRIBER_HISTORY_DATAREADERINSTANCE_HPP_
 
-#include <chrono>
 #include <cstdint>
 
 #include <fastdds/dds/subscriber/InstanceState.hpp>
@@ -48,8 +47,6 @@ struct DataReaderInstance
     WriterCollection alive_writers;
     //! GUID and strength of the current maximum strength writer
     WriterOwnership current_owner{ {}, (std::numeric_limits<uint32_t>::max)() };
-    //! The time when the group will miss the deadline
-    std::chrono::steady_clock::time_point next_deadline_us;
     //! Current view state of the instance
     ViewStateKind view_state = ViewStateKind::NEW_VIEW_STATE;
     //! Current instance state of the instance
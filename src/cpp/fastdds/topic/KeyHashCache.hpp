@@ -0,0 +1,155 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file KeyHashCache.hpp
+ */
+
+#ifndef FASTDDS_TOPIC__KEYHASHCACHE_HPP
+#define FASTDDS_TOPIC__KEYHASHCACHE_HPP
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+#include <fastdds/rtps/common/InstanceHandle.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/**
+ * Bounded cache that maps the serialized representation of a key to its instance handle.
+ *
+ * It is meant to avoid recomputing the MD5 digest of keys whose serialized form is bigger than 16 bytes when the
+ * same instances are written repeatedly.
+ * When the cache is full it is cleared before inserting a new entry, so memory usage is always bounded.
+ *
+ * This class is not thread-safe.
+ */
+class KeyHashCache
+{
+public:
+
+    /**
+     * Construct a KeyHashCache.
+     *
+     * @param max_entries  Maximum number of entries held by the cache. 0 means the cache is disabled.
+     */
+    explicit KeyHashCache(
+            size_t max_entries = 0)
+        : max_entries_(max_entries)
+    {
+    }
+
+    /**
+     * Whether this cache will hold any entry.
+     */
+    bool is_enabled() const
+    {
+        return 0 < max_entries_;
+    }
+
+    /**
+     * Change the maximum number of entries held by the cache.
+     * Current entries are discarded.
+     *
+     * @param max_entries  Maximum number of entries held by the cache. 0 means the cache is disabled.
+     */
+    void set_max_entries(
+            size_t max_entries)
+    {
+        max_entries_ = max_entries;
+        entries_.clear();
+        entries_.reserve(max_entries_);
+    }
+
+    /**
+     * Look for the instance handle associated to a serialized key.
+     *
+     * @param [in]  key     Pointer to the serialized key.
+     * @param [in]  length  Length of the serialized key.
+     * @param [out] handle  Instance handle associated to the key, only written when found.
+     *
+     * @return true when the key was found in the cache.
+     */
+    bool find(
+            const unsigned char* key,
+            size_t length,
+            rtps::InstanceHandle_t& handle)
+    {
+        if (!is_enabled())
+        {
+            return false;
+        }
+
+        // Reuse the same string so lookups do not allocate once it has grown enough.
+        lookup_key_.assign(reinterpret_cast<const char*>(key), length);
+        auto it = entries_.find(lookup_key_);
+        if (entries_.end() == it)
+        {
+            return false;
+        }
+
+        handle = it->second;
+        return true;
+    }
+
+    /**
+     * Store the instance handle associated to a serialized key.
+     *
+     * @param key     Pointer to the serialized key.
+     * @param length  Length of the serialized key.
+     * @param handle  Instance handle associated to the key.
+     */
+    void insert(
+            const unsigned char* key,
+            size_t length,
+            const rtps::InstanceHandle_t& handle)
+    {
+        if (!is_enabled())
+        {
+            return;
+        }
+
+        if (entries_.size() >= max_entries_)
+        {
+            entries_.clear();
+        }
+
+        entries_.emplace(std::string(reinterpret_cast<const char*>(key), length), handle);
+    }
+
+    /**
+     * Number of entries currently held by the cache.
+     */
+    size_t size() const
+    {
+        return entries_.size();
+    }
+
+private:
+
+    size_t max_entries_ = 0;
+
+    std::string lookup_key_;
+
+    std::unordered_map<std::string, rtps::InstanceHandle_t> entries_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_TOPIC__KEYHASHCACHE_HPP
@@ -162,6 +162,8 @@ void set_qos_from_attributes(
     qos.timed_events_thread() = attr.timed_events_thread;
     qos.discovery_server_thread() = attr.discovery_server_thread;
     qos.typelookup_service_thread() = attr.typelookup_service_thread;
+    qos.persistence_thread() = attr.persistence_thread;
+    qos.listener_dispatch_thread() = attr.listener_dispatch_thread;
 #if HAVE_SECURITY
     qos.security_log_thread() = attr.security_log_thread;
 #endif // if HAVE_SECURITY
@@ -219,6 +221,8 @@ void set_attributes_from_qos(
     attr.timed_events_thread = qos.timed_events_thread();
     attr.discovery_server_thread = qos.discovery_server_thread();
     attr.typelookup_service_thread = qos.typelookup_service_thread();
+    attr.persistence_thread = qos.persistence_thread();
+    attr.listener_dispatch_thread = qos.listener_dispatch_thread();
 #if HAVE_SECURITY
     attr.security_log_thread = qos.security_log_thread();
 #endif // if HAVE_SECURITY
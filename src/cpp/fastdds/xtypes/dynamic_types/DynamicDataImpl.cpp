@@ -17,6 +17,8 @@
 #include <algorithm>
 #include <bitset>
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <functional>
 #include <iterator>
 #include <map>
@@ -160,15 +162,31 @@ DynamicDataImpl::DynamicDataImpl(
             TK_STRUCTURE == type_kind ||
             TK_UNION == type_kind)
     {
+        if (TK_STRUCTURE == type_kind)
+        {
+            allocate_flat_storage();
+        }
+
         for (auto& member : enclosing_type_->get_all_members_by_index())
         {
-            traits<DynamicData>::ref_type data = DynamicDataFactory::get_instance()->create_data(
-                member->get_descriptor().type());
-            traits<DynamicDataImpl>::ref_type data_impl = traits<DynamicData>::narrow<DynamicDataImpl>(data);
+            traits<DynamicDataImpl>::ref_type data_impl;
+            const DynamicTypeImpl::FlatMember* flat_member {find_flat_member(member->get_id())};
+
+            if (nullptr != flat_member)
+            {
+                data_impl = create_flat_member_data(
+                    traits<DynamicType>::narrow<DynamicTypeImpl>(member->get_descriptor().type()), *flat_member);
+            }
+            else
+            {
+                traits<DynamicData>::ref_type data = DynamicDataFactory::get_instance()->create_data(
+                    member->get_descriptor().type());
+                data_impl = traits<DynamicData>::narrow<DynamicDataImpl>(data);
+            }
 
             set_default_value(member, data_impl);
 
-            value_.emplace(member->get_id(), data);
+            value_.emplace(member->get_id(), data_impl);
         }
     }
     else if (TK_ARRAY == type_kind ||
@@ -296,10 +314,27 @@ traits<DynamicData>::ref_type DynamicDataImpl::clone() noexcept
             TK_UNION == type_kind)
     {
         ret_value->selected_union_member_ = selected_union_member_;
+
+        if (flat_storage_)
+        {
+            ret_value->allocate_flat_storage();
+            std::memcpy(ret_value->flat_storage_.get(), flat_storage_.get(),
+                    enclosing_type_->get_flat_storage_size());
+        }
+
         for (const auto& value : value_)
         {
-            ret_value->value_.emplace(value.first, std::static_pointer_cast<DynamicDataImpl>(value.second)->clone());
+            auto data = std::static_pointer_cast<DynamicDataImpl>(value.second);
+            const DynamicTypeImpl::FlatMember* flat_member {ret_value->find_flat_member(value.first)};
 
+            if (nullptr != flat_member)
+            {
+                ret_value->value_.emplace(value.first, ret_value->create_flat_member_data(data->type_, *flat_member));
+            }
+            else
+            {
+                ret_value->value_.emplace(value.first, data->clone());
+            }
         }
     }
     else if (TK_ARRAY == type_kind ||
@@ -1284,8 +1319,20 @@ ReturnCode_t DynamicDataImpl::set_complex_value(
 
                     if (data->type_->equals(value->type()))
                     {
-                        value_.erase(it);
-                        value_.emplace(id, value->clone());
+                        const DynamicTypeImpl::FlatMember* flat_member {find_flat_member(id)};
+
+                        if (nullptr != flat_member)
+                        {
+                            // Copy the value, so the member keeps pointing to the flat storage.
+                            auto value_impl = traits<DynamicData>::narrow<DynamicDataImpl>(value);
+                            std::memmove(flat_member_address(*flat_member), value_impl->value_.cbegin()->second.get(),
+                                    flat_member->size);
+                        }
+                        else
+                        {
+                            value_.erase(it);
+                            value_.emplace(id, value->clone());
+                        }
                         ret_value =  RETCODE_OK;
                     }
                     else
@@ -2671,6 +2718,31 @@ ReturnCode_t DynamicDataImpl::clear_sequence_element(
     return ret_value;
 }
 
+void DynamicDataImpl::allocate_flat_storage() noexcept
+{
+    uint32_t storage_size {enclosing_type_->get_flat_storage_size()};
+
+    if (0 < storage_size)
+    {
+        // Value-initialization zeroes the storage, which is the initial value of every primitive type.
+        size_t num_blocks {(storage_size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t)};
+        flat_storage_ = std::shared_ptr<std::max_align_t>(new std::max_align_t[num_blocks](),
+                        std::default_delete<std::max_align_t[]>());
+    }
+}
+
+traits<DynamicDataImpl>::ref_type DynamicDataImpl::create_flat_member_data(
+        const traits<DynamicTypeImpl>::ref_type& member_type,
+        const DynamicTypeImpl::FlatMember& flat_member) const noexcept
+{
+    traits<DynamicDataImpl>::ref_type data = std::make_shared<DynamicDataImpl>();
+    data->type_ = member_type;
+    data->enclosing_type_ = get_enclosing_type(member_type);
+    // The member shares the ownership of the whole flat storage.
+    data->value_.emplace(MEMBER_ID_INVALID, std::shared_ptr<void>(flat_storage_, flat_member_address(flat_member)));
+    return data;
+}
+
 std::shared_ptr<void> DynamicDataImpl::clone_primitive(
         TypeKind type_kind,
         const std::shared_ptr<void>& primitive) const noexcept
@@ -3852,6 +3924,14 @@ ReturnCode_t DynamicDataImpl::get_value(
             TK_STRUCTURE == type_kind ||
             TK_UNION == type_kind)
     {
+        // Fast path for members placed in the flat storage when no promotion is needed.
+        const DynamicTypeImpl::FlatMember* flat_member {find_flat_member(id)};
+        if (nullptr != flat_member && TK == flat_member->kind)
+        {
+            value = *static_cast<TypeForKind<TK>*>(flat_member_address(*flat_member));
+            return RETCODE_OK;
+        }
+
         if (MEMBER_ID_INVALID != id && (TK_UNION != type_kind || 0 == id || selected_union_member_ == id))
         {
             auto it = value_.find(id);
@@ -5018,6 +5098,14 @@ ReturnCode_t DynamicDataImpl::set_value(
             TK_STRUCTURE == type_kind ||
             TK_UNION == type_kind)
     {
+        // Fast path for members placed in the flat storage when no promotion is needed.
+        const DynamicTypeImpl::FlatMember* flat_member {find_flat_member(id)};
+        if (nullptr != flat_member && TK == flat_member->kind)
+        {
+            *static_cast<TypeForKind<TK>*>(flat_member_address(*flat_member)) = value;
+            return RETCODE_OK;
+        }
+
         if (MEMBER_ID_INVALID != id)
         {
             if (TK_UNION == type_kind && 0 == id)     // Check setting discriminator is correct.
@@ -5786,15 +5874,39 @@ size_t DynamicDataImpl::calculate_serialized_size(
             eprosima::fastcdr::EncodingAlgorithmFlag previous_encoding = calculator.get_encoding();
             calculated_size = calculator.begin_calculate_type_serialized_size(encoding, current_alignment);
 
-            for (auto& member : type->get_all_members_by_index())
+            if (flat_storage_ && type == enclosing_type_)
             {
-                it = value_.find(member->get_id());
+                // Follow the serialization plan, reading the members placed in the flat storage straight from it.
+                for (auto& step : type->get_serialization_plan())
+                {
+                    if (TK_NONE != step.kind)
+                    {
+                        calculated_size += calculate_flat_member_serialized_size(calculator, step, current_alignment);
+                        continue;
+                    }
 
-                if (it != value_.end())
+                    it = value_.find(step.id);
+
+                    if (it != value_.end())
+                    {
+                        auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+                        calculated_size += calculator.calculate_member_serialized_size(
+                            step.id, member_data, current_alignment);
+                    }
+                }
+            }
+            else
+            {
+                for (auto& member : type->get_all_members_by_index())
                 {
-                    auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
-                    calculated_size += calculator.calculate_member_serialized_size(
-                        member->get_id(), member_data, current_alignment);
+                    it = value_.find(member->get_id());
+
+                    if (it != value_.end())
+                    {
+                        auto member_data = std::static_pointer_cast<DynamicDataImpl>(it->second);
+                        calculated_size += calculator.calculate_member_serialized_size(
+                            member->get_id(), member_data, current_alignment);
+                    }
                 }
             }
 
@@ -6609,6 +6721,28 @@ bool DynamicDataImpl::deserialize(
                     {
                         bool ret_value = true;
 
+                        if (flat_storage_ && type == enclosing_type_)
+                        {
+                            // Members placed in the flat storage are deserialized straight into it.
+                            const DynamicTypeImpl::FlatMember* flat_member {nullptr};
+
+                            if (ExtensibilityKind::MUTABLE == type->get_descriptor().extensibility_kind())
+                            {
+                                flat_member = find_flat_member(mid.id);
+                            }
+                            else if (mid.id < type->get_serialization_plan().size() &&
+                                    TK_NONE != type->get_serialization_plan()[mid.id].kind)
+                            {
+                                flat_member = &type->get_serialization_plan()[mid.id];
+                            }
+
+                            if (nullptr != flat_member)
+                            {
+                                deserialize_flat_member(dcdr, *flat_member);
+                                return ret_value;
+                            }
+                        }
+
                         traits<DynamicTypeMember>::ref_type member;
 
                         if (ExtensibilityKind::MUTABLE == type->get_descriptor().extensibility_kind())
@@ -7336,20 +7470,49 @@ void DynamicDataImpl::serialize(
             eprosima::fastcdr::Cdr::state current_state(cdr);
             cdr.begin_serialize_type(current_state, encoding);
 
-            for (auto& member : type->get_all_members_by_index())
+            if (flat_storage_ && type == enclosing_type_)
             {
-                auto it = value_.find(member->get_id());
-
-                if (it != value_.end())
+                // Follow the serialization plan, writing the members placed in the flat storage straight from it.
+                for (auto& step : type->get_serialization_plan())
                 {
-                    auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
+                    if (TK_NONE != step.kind)
+                    {
+                        serialize_flat_member(cdr, step);
+                        continue;
+                    }
 
-                    cdr << eprosima::fastcdr::MemberId{member->get_id()} << member_data;
+                    auto it = value_.find(step.id);
+
+                    if (it != value_.end())
+                    {
+                        auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
+
+                        cdr << eprosima::fastcdr::MemberId{step.id} << member_data;
+                    }
+                    else
+                    {
+                        EPROSIMA_LOG_ERROR(DYN_TYPES,
+                                "Error serializing structure member because it is not found on DynamicData");
+                    }
                 }
-                else
+            }
+            else
+            {
+                for (auto& member : type->get_all_members_by_index())
                 {
-                    EPROSIMA_LOG_ERROR(DYN_TYPES,
-                            "Error serializing structure member because it is not found on DynamicData");
+                    auto it = value_.find(member->get_id());
+
+                    if (it != value_.end())
+                    {
+                        auto member_data {std::static_pointer_cast<DynamicDataImpl>(it->second)};
+
+                        cdr << eprosima::fastcdr::MemberId{member->get_id()} << member_data;
+                    }
+                    else
+                    {
+                        EPROSIMA_LOG_ERROR(DYN_TYPES,
+                                "Error serializing structure member because it is not found on DynamicData");
+                    }
                 }
             }
 
@@ -7382,6 +7545,224 @@ void DynamicDataImpl::serialize(
     }
 }
 
+size_t DynamicDataImpl::calculate_flat_member_serialized_size(
+        eprosima::fastcdr::CdrSizeCalculator& calculator,
+        const DynamicTypeImpl::FlatMember& flat_member,
+        size_t& current_alignment) const noexcept
+{
+    size_t calculated_size {0};
+
+    switch (flat_member.kind)
+    {
+        case TK_INT32:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_INT32>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_UINT32:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_UINT32>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_INT8:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_INT8>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_INT16:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_INT16>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_UINT16:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_UINT16>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_INT64:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_INT64>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_UINT64:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_UINT64>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_FLOAT32:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_FLOAT32>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_FLOAT64:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_FLOAT64>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_FLOAT128:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_FLOAT128>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_CHAR8:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_CHAR8>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_CHAR16:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_CHAR16>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_BOOLEAN:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_BOOLEAN>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_BYTE:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_BYTE>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        case TK_UINT8:
+            calculated_size = calculator.calculate_member_serialized_size(eprosima::fastcdr::MemberId(flat_member.id),
+                            *static_cast<const TypeForKind<TK_UINT8>*>(flat_member_address(flat_member)),
+                            current_alignment);
+            break;
+        default:
+            break;
+    }
+
+    return calculated_size;
+}
+
+void DynamicDataImpl::deserialize_flat_member(
+        eprosima::fastcdr::Cdr& cdr,
+        const DynamicTypeImpl::FlatMember& flat_member)
+{
+    switch (flat_member.kind)
+    {
+        case TK_INT32:
+            cdr >> *static_cast<TypeForKind<TK_INT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT32:
+            cdr >> *static_cast<TypeForKind<TK_UINT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT8:
+            cdr >> *static_cast<TypeForKind<TK_INT8>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT16:
+            cdr >> *static_cast<TypeForKind<TK_INT16>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT16:
+            cdr >> *static_cast<TypeForKind<TK_UINT16>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT64:
+            cdr >> *static_cast<TypeForKind<TK_INT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT64:
+            cdr >> *static_cast<TypeForKind<TK_UINT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT32:
+            cdr >> *static_cast<TypeForKind<TK_FLOAT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT64:
+            cdr >> *static_cast<TypeForKind<TK_FLOAT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT128:
+            cdr >> *static_cast<TypeForKind<TK_FLOAT128>*>(flat_member_address(flat_member));
+            break;
+        case TK_CHAR8:
+            cdr >> *static_cast<TypeForKind<TK_CHAR8>*>(flat_member_address(flat_member));
+            break;
+        case TK_CHAR16:
+            cdr >> *static_cast<TypeForKind<TK_CHAR16>*>(flat_member_address(flat_member));
+            break;
+        case TK_BOOLEAN:
+            cdr >> *static_cast<TypeForKind<TK_BOOLEAN>*>(flat_member_address(flat_member));
+            break;
+        case TK_BYTE:
+            cdr >> *static_cast<TypeForKind<TK_BYTE>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT8:
+            cdr >> *static_cast<TypeForKind<TK_UINT8>*>(flat_member_address(flat_member));
+            break;
+        default:
+            break;
+    }
+}
+
+void DynamicDataImpl::serialize_flat_member(
+        eprosima::fastcdr::Cdr& cdr,
+        const DynamicTypeImpl::FlatMember& flat_member) const
+{
+    switch (flat_member.kind)
+    {
+        case TK_INT32:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_INT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT32:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_UINT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT8:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_INT8>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT16:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_INT16>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT16:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_UINT16>*>(flat_member_address(flat_member));
+            break;
+        case TK_INT64:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_INT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT64:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_UINT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT32:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_FLOAT32>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT64:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_FLOAT64>*>(flat_member_address(flat_member));
+            break;
+        case TK_FLOAT128:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_FLOAT128>*>(flat_member_address(flat_member));
+            break;
+        case TK_CHAR8:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_CHAR8>*>(flat_member_address(flat_member));
+            break;
+        case TK_CHAR16:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_CHAR16>*>(flat_member_address(flat_member));
+            break;
+        case TK_BOOLEAN:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_BOOLEAN>*>(flat_member_address(flat_member));
+            break;
+        case TK_BYTE:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_BYTE>*>(flat_member_address(flat_member));
+            break;
+        case TK_UINT8:
+            cdr << eprosima::fastcdr::MemberId{flat_member.id}
+                << *static_cast<const TypeForKind<TK_UINT8>*>(flat_member_address(flat_member));
+            break;
+        default:
+            break;
+    }
+}
+
 //}}}
 
 } // namespace dds
@@ -59,6 +59,10 @@ class DynamicDataImpl : public traits<DynamicData>::base_type
     //! Points to the current selected member in the union.
     MemberId selected_union_member_ {MEMBER_ID_INVALID};
 
+    //! Used in TK_STRUCTURE to store together the fixed-size primitive members, placed as described by
+    //! DynamicTypeImpl::get_flat_members. The DynamicDataImpl of these members point to their place in this storage.
+    std::shared_ptr<void> flat_storage_;
+
     //}}}
 
 public:
@@ -470,6 +474,39 @@ private:
             TypeKind kind,
             MemberId id) noexcept;
 
+    /*!
+     * Auxiliary function to allocate the flat storage of a TK_STRUCTURE.
+     * The storage is only allocated when the type has fixed-size primitive members.
+     */
+    void allocate_flat_storage() noexcept;
+
+    /*!
+     * Auxiliary function to create the DynamicDataImpl of a fixed-size primitive member whose value is placed in the
+     * flat storage.
+     */
+    traits<DynamicDataImpl>::ref_type create_flat_member_data(
+            const traits<DynamicTypeImpl>::ref_type& member_type,
+            const DynamicTypeImpl::FlatMember& flat_member) const noexcept;
+
+    /*!
+     * Auxiliary function to get the placement of a member in the flat storage.
+     * @return nullptr if the member is not placed in the flat storage.
+     */
+    const DynamicTypeImpl::FlatMember* find_flat_member(
+            MemberId id) const noexcept
+    {
+        return flat_storage_ ? enclosing_type_->find_flat_member(id) : nullptr;
+    }
+
+    /*!
+     * Auxiliary function to get the address of a member placed in the flat storage.
+     */
+    void* flat_member_address(
+            const DynamicTypeImpl::FlatMember& flat_member) const noexcept
+    {
+        return static_cast<char*>(flat_storage_.get()) + flat_member.offset;
+    }
+
     /*!
      * Auxiliary function for getting the initial number of elements for TK_ARRAY.
      */
@@ -720,6 +757,28 @@ private:
             eprosima::fastcdr::Cdr& cdr,
             const traits<DynamicTypeImpl>::ref_type type) const;
 
+    /*!
+     * Auxiliary function to calculate the serialized size of a member placed in the flat storage.
+     */
+    size_t calculate_flat_member_serialized_size(
+            eprosima::fastcdr::CdrSizeCalculator& calculator,
+            const DynamicTypeImpl::FlatMember& flat_member,
+            size_t& current_alignment) const noexcept;
+
+    /*!
+     * Auxiliary function to deserialize a member placed in the flat storage.
+     */
+    void deserialize_flat_member(
+            eprosima::fastcdr::Cdr& cdr,
+            const DynamicTypeImpl::FlatMember& flat_member);
+
+    /*!
+     * Auxiliary function to serialize, with its member identifier, a member placed in the flat storage.
+     */
+    void serialize_flat_member(
+            eprosima::fastcdr::Cdr& cdr,
+            const DynamicTypeImpl::FlatMember& flat_member) const;
+
     //}}}
 
 };
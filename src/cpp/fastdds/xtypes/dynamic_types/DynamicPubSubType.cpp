@@ -27,6 +27,7 @@
 #include "common.hpp"
 #include "DynamicDataImpl.hpp"
 #include "DynamicTypeImpl.hpp"
+#include <fastdds/topic/KeyHashCache.hpp>
 #include <rtps/domain/RTPSDomainImpl.hpp>
 
 namespace eprosima {
@@ -35,9 +36,15 @@ namespace dds {
 
 //{{{ Public functions
 
+DynamicPubSubType::DynamicPubSubType()
+    : key_hash_cache_(new KeyHashCache())
+{
+}
+
 DynamicPubSubType::DynamicPubSubType(
         traits<DynamicType>::ref_type type)
     : dynamic_type_(type)
+    , key_hash_cache_(new KeyHashCache())
 {
     update_dynamic_type();
 }
@@ -162,10 +169,17 @@ bool DynamicPubSubType::compute_key(
     size_t keyBufferSize =
             static_cast<uint32_t>((*data_ptr)->calculate_key_serialized_size(calculator, current_alignment));
 
-    if (nullptr == key_buffer_)
+    // Keys with unbounded members may need a bigger buffer than the one used for previous samples.
+    if (nullptr == key_buffer_ || key_buffer_size_ < keyBufferSize)
     {
-        key_buffer_ = reinterpret_cast<unsigned char*>(malloc(keyBufferSize > 16 ? keyBufferSize : 16));
-        memset(key_buffer_, 0, keyBufferSize > 16 ? keyBufferSize : 16);
+        uint32_t new_size = keyBufferSize > 16 ? static_cast<uint32_t>(keyBufferSize) : 16u;
+        unsigned char* new_buffer = reinterpret_cast<unsigned char*>(realloc(key_buffer_, new_size));
+        if (nullptr == new_buffer)
+        {
+            return false;
+        }
+        key_buffer_ = new_buffer;
+        key_buffer_size_ = new_size;
     }
 
     eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(key_buffer_), keyBufferSize);
@@ -173,18 +187,27 @@ bool DynamicPubSubType::compute_key(
             eprosima::fastcdr::CdrVersion::XCDRv2);  // Object that serializes the data.
     ser.set_encoding_flag(eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2);
     (*data_ptr)->serialize_key(ser);
+    size_t key_length = ser.get_serialized_data_length();
     if (force_md5 || keyBufferSize > 16)
     {
+        if (key_hash_cache_->find(key_buffer_, key_length, handle))
+        {
+            return true;
+        }
+
         md5_.init();
-        md5_.update(key_buffer_, (unsigned int)ser.get_serialized_data_length());
+        md5_.update(key_buffer_, (unsigned int)key_length);
         md5_.finalize();
         for (uint8_t i = 0; i < 16; ++i)
         {
             handle.value[i] = md5_.digest[i];
         }
+        key_hash_cache_->insert(key_buffer_, key_length, handle);
     }
     else
     {
+        // Short keys are zero-padded up to the 16 bytes of the handle.
+        memset(key_buffer_ + key_length, 0, 16 - key_length);
         for (uint8_t i = 0; i < 16; ++i)
         {
             handle.value[i] = key_buffer_[i];
@@ -275,6 +298,12 @@ ReturnCode_t DynamicPubSubType::set_dynamic_type(
     return RETCODE_BAD_PARAMETER;
 }
 
+void DynamicPubSubType::set_key_hash_cache_limit(
+        uint32_t max_entries)
+{
+    key_hash_cache_->set_max_entries(max_entries);
+}
+
 void DynamicPubSubType::register_type_object_representation()
 {
     if (dynamic_type_)
@@ -14,6 +14,7 @@
 
 #include "DynamicTypeBuilderImpl.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <string>
 #include <utility>
@@ -27,6 +28,7 @@
 #include "DynamicTypeMemberImpl.hpp"
 #include "MemberDescriptorImpl.hpp"
 #include "TypeDescriptorImpl.hpp"
+#include "TypeForKind.hpp"
 #include "TypeValueConverter.hpp"
 
 namespace eprosima {
@@ -256,6 +258,61 @@ bool DynamicTypeBuilderImpl::equals(
     return ret_value;
 }
 
+//{{{ Auxiliary functions to calculate the flat storage of a TK_STRUCTURE.
+template<TypeKind TK>
+bool flat_size_for_kind(
+        uint32_t& size,
+        uint32_t& alignment)
+{
+    size = static_cast<uint32_t>(sizeof(TypeForKind<TK>));
+    alignment = static_cast<uint32_t>(alignof(TypeForKind<TK>));
+    return true;
+}
+
+static bool flat_size_for_kind(
+        TypeKind kind,
+        uint32_t& size,
+        uint32_t& alignment)
+{
+    switch (kind)
+    {
+        case TK_INT8:
+            return flat_size_for_kind<TK_INT8>(size, alignment);
+        case TK_UINT8:
+            return flat_size_for_kind<TK_UINT8>(size, alignment);
+        case TK_INT16:
+            return flat_size_for_kind<TK_INT16>(size, alignment);
+        case TK_UINT16:
+            return flat_size_for_kind<TK_UINT16>(size, alignment);
+        case TK_INT32:
+            return flat_size_for_kind<TK_INT32>(size, alignment);
+        case TK_UINT32:
+            return flat_size_for_kind<TK_UINT32>(size, alignment);
+        case TK_INT64:
+            return flat_size_for_kind<TK_INT64>(size, alignment);
+        case TK_UINT64:
+            return flat_size_for_kind<TK_UINT64>(size, alignment);
+        case TK_FLOAT32:
+            return flat_size_for_kind<TK_FLOAT32>(size, alignment);
+        case TK_FLOAT64:
+            return flat_size_for_kind<TK_FLOAT64>(size, alignment);
+        case TK_FLOAT128:
+            return flat_size_for_kind<TK_FLOAT128>(size, alignment);
+        case TK_CHAR8:
+            return flat_size_for_kind<TK_CHAR8>(size, alignment);
+        case TK_CHAR16:
+            return flat_size_for_kind<TK_CHAR16>(size, alignment);
+        case TK_BOOLEAN:
+            return flat_size_for_kind<TK_BOOLEAN>(size, alignment);
+        case TK_BYTE:
+            return flat_size_for_kind<TK_BYTE>(size, alignment);
+        default:
+            return false;
+    }
+}
+
+//}}}
+
 //{{{ Auxiliary structure to revert default_value setting.
 template<typename T>
 struct RollbackSetting
@@ -750,6 +807,11 @@ traits<DynamicType>::ref_type DynamicTypeBuilderImpl::build() noexcept
             ret_val->default_union_member_ = default_union_member_;
             ret_val->default_literal_ = default_literal_;
             ret_val->index_own_members_ = index_own_members_;
+
+            if (TK_STRUCTURE == type_descriptor_.kind())
+            {
+                calculate_flat_members(*ret_val);
+            }
         }
     }
 
@@ -776,6 +838,42 @@ ReturnCode_t DynamicTypeBuilderImpl::copy_from(
     return RETCODE_OK;
 }
 
+void DynamicTypeBuilderImpl::calculate_flat_members(
+        DynamicTypeImpl& type) const noexcept
+{
+    type.flat_members_.clear();
+    type.serialization_plan_.clear();
+    type.flat_storage_size_ = 0;
+
+    for (auto& member : members_)
+    {
+        DynamicTypeImpl::FlatMember flat_member;
+        flat_member.id = member->get_id();
+
+        // Aliases and enumerations are not placed in the flat storage, because their values are checked when set.
+        TypeKind member_kind {member->get_descriptor().type()->get_kind()};
+        uint32_t size {0};
+        uint32_t alignment {0};
+
+        if (!member->get_descriptor().is_optional() && flat_size_for_kind(member_kind, size, alignment))
+        {
+            flat_member.kind = member_kind;
+            flat_member.offset = (type.flat_storage_size_ + alignment - 1) / alignment * alignment;
+            flat_member.size = size;
+            type.flat_members_.push_back(flat_member);
+            type.flat_storage_size_ = flat_member.offset + size;
+        }
+
+        type.serialization_plan_.push_back(flat_member);
+    }
+
+    std::sort(type.flat_members_.begin(), type.flat_members_.end(),
+            [](const DynamicTypeImpl::FlatMember& a, const DynamicTypeImpl::FlatMember& b)
+            {
+                return a.id < b.id;
+            });
+}
+
 traits<DynamicTypeBuilder>::ref_type DynamicTypeBuilderImpl::_this()
 {
     return shared_from_this();
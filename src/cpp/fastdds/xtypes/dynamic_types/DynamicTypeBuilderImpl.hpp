@@ -118,6 +118,14 @@ protected:
 
 private:
 
+    /*!
+     * Calculates the placement of the fixed-size primitive members of a TK_STRUCTURE inside a flat storage, and the
+     * serialization plan of its members.
+     * @param [inout] type Type being built.
+     */
+    void calculate_flat_members(
+            DynamicTypeImpl& type) const noexcept;
+
     //! Contains the annotations applied by the user.
     std::vector<AnnotationDescriptorImpl> annotation_;
 
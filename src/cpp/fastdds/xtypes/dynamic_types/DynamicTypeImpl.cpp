@@ -216,6 +216,23 @@ bool DynamicTypeImpl::equals(
     return ret_value;
 }
 
+const DynamicTypeImpl::FlatMember* DynamicTypeImpl::find_flat_member(
+        MemberId id) const noexcept
+{
+    auto it = std::lower_bound(flat_members_.begin(), flat_members_.end(), id,
+                    [](const FlatMember& flat_member, MemberId member_id)
+                    {
+                        return flat_member.id < member_id;
+                    });
+
+    if (flat_members_.end() != it && id == it->id)
+    {
+        return &(*it);
+    }
+
+    return nullptr;
+}
+
 traits<DynamicTypeImpl>::ref_type DynamicTypeImpl::resolve_alias_enclosed_type() noexcept
 {
     traits<DynamicTypeImpl>::ref_type ret_value = traits<DynamicType>::narrow<DynamicTypeImpl>(_this());
@@ -36,6 +36,18 @@ class DynamicTypeImpl : public virtual traits<DynamicType>::base_type
 
 public:
 
+    //! Placement of a fixed-size primitive member of a TK_STRUCTURE inside the flat storage of its DynamicData.
+    struct FlatMember
+    {
+        MemberId id {MEMBER_ID_INVALID};
+
+        TypeKind kind {TK_NONE};
+
+        uint32_t offset {0};
+
+        uint32_t size {0};
+    };
+
     DynamicTypeImpl(
             const TypeDescriptorImpl& descriptor) noexcept;
 
@@ -126,6 +138,38 @@ public:
         return default_literal_;
     }
 
+    /*!
+     * Returns the placement of the fixed-size primitive members (TK_STRUCTURE), sorted by MemberId.
+     * Members not present in this collection are stored on their own.
+     */
+    const std::vector<FlatMember>& get_flat_members() const noexcept
+    {
+        return flat_members_;
+    }
+
+    /*!
+     * Returns the members of a TK_STRUCTURE in serialization order, with their placement in the flat storage.
+     * Members not placed in the flat storage have TK_NONE kind.
+     */
+    const std::vector<FlatMember>& get_serialization_plan() const noexcept
+    {
+        return serialization_plan_;
+    }
+
+    //! Returns the size needed to store all the members returned by @ref get_flat_members.
+    uint32_t get_flat_storage_size() const noexcept
+    {
+        return flat_storage_size_;
+    }
+
+    /*!
+     * Looks for the placement of a fixed-size primitive member.
+     * @param [in] id MemberId of the member.
+     * @return Pointer to the placement of the member. nullptr if the member is not stored in the flat storage.
+     */
+    const FlatMember* find_flat_member(
+            MemberId id) const noexcept;
+
     traits<DynamicTypeImpl>::ref_type resolve_alias_enclosed_type() noexcept;
 
 protected:
@@ -168,6 +212,18 @@ private:
 
     //! Contains the verbatim builtin annotation applied by the user.
     std::vector<VerbatimTextDescriptorImpl> verbatim_;
+
+    //! Placement of the fixed-size primitive members (TK_STRUCTURE), sorted by MemberId.
+    //! This is calculated while the type is being built.
+    std::vector<FlatMember> flat_members_;
+
+    //! Members of a TK_STRUCTURE in serialization order, with their placement in the flat storage.
+    //! This is calculated while the type is being built.
+    std::vector<FlatMember> serialization_plan_;
+
+    //! Size of the flat storage of the fixed-size primitive members (TK_STRUCTURE).
+    //! This is calculated while the type is being built.
+    uint32_t flat_storage_size_ {0};
 };
 
 } // namespace dds
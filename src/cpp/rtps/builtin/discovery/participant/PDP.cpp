@@ -716,6 +716,18 @@ void PDP::resetParticipantAnnouncement()
     }
 }
 
+void PDP::get_memory_usage(
+        ParticipantMemoryUsage& usage) const
+{
+    std::lock_guard<std::recursive_mutex> guardPDP(*mp_mutex);
+    usage.discovered_participants.elements = participant_proxies_number_;
+    usage.discovered_participants.bytes = participant_proxies_number_ * sizeof(ParticipantProxyData);
+    usage.discovered_readers.elements = reader_proxies_number_;
+    usage.discovered_readers.bytes = reader_proxies_number_ * sizeof(ReaderProxyData);
+    usage.discovered_writers.elements = writer_proxies_number_;
+    usage.discovered_writers.bytes = writer_proxies_number_ * sizeof(WriterProxyData);
+}
+
 void PDP::notify_and_maybe_ignore_new_participant(
         ParticipantProxyData* pdata,
         bool& should_be_ignored)
@@ -42,6 +42,7 @@
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
 #include <fastdds/rtps/common/InstanceHandle.hpp>
 #include <fastdds/rtps/common/LocatorList.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/Types.hpp>
 #include <fastdds/rtps/common/WriteParams.hpp>
 #include <fastdds/rtps/history/IPayloadPool.hpp>
@@ -381,6 +382,14 @@ public:
         return participant_proxies_number_;
     }
 
+    /**
+     * Fill the memory used by the discovery database.
+     * @param usage Structure where the number of proxy data objects created for participants, readers and writers,
+     * and the bytes they take, are filled.
+     */
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage) const;
+
     /**
      * Assert the liveliness of a Remote Participant.
      * @param remote_guid GuidPrefix_t of the participant whose liveliness is being asserted.
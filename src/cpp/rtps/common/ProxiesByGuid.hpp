@@ -0,0 +1,132 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ProxiesByGuid.hpp
+ */
+
+#ifndef FASTDDS_RTPS_COMMON__PROXIESBYGUID_HPP
+#define FASTDDS_RTPS_COMMON__PROXIESBYGUID_HPP
+
+#include <algorithm>
+#include <cassert>
+
+#include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/utils/collections/ResourceLimitedVector.hpp>
+
+#include <utils/collections/sorted_vector_insert.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Index of the matched proxies of an endpoint, sorted by GUID.
+ *
+ * It lets the reception path find the proxy of a remote endpoint in logarithmic time, instead of iterating over all
+ * the matched proxies. It uses the same allocation configuration as the collections holding the matched proxies.
+ *
+ * @tparam Proxy Type of the proxy. It should provide a guid() method returning the GUID of the remote endpoint.
+ */
+template<typename Proxy>
+class ProxiesByGuid
+{
+public:
+
+    explicit ProxiesByGuid(
+            const ResourceLimitedContainerConfig& allocation)
+        : proxies_(allocation)
+    {
+    }
+
+    /**
+     * Adds a proxy to the index.
+     *
+     * @param proxy Pointer to the proxy. There should not be another proxy with the same GUID in the index.
+     */
+    void add(
+            Proxy* proxy)
+    {
+        assert(nullptr == find(proxy->guid()));
+        eprosima::utilities::collections::sorted_vector_insert(proxies_, proxy, [](const Proxy* lhs, const Proxy* rhs)
+                {
+                    return lhs->guid() < rhs->guid();
+                });
+    }
+
+    /**
+     * Removes the proxy with the given GUID from the index.
+     *
+     * @param guid GUID of the remote endpoint.
+     * @return Pointer to the removed proxy. nullptr if there was no proxy with the given GUID.
+     */
+    Proxy* remove(
+            const GUID_t& guid)
+    {
+        Proxy* ret_val = nullptr;
+        auto it = lower_bound(guid);
+        if (proxies_.end() != it && (*it)->guid() == guid)
+        {
+            ret_val = *it;
+            proxies_.erase(it);
+        }
+        return ret_val;
+    }
+
+    /**
+     * Looks for the proxy with the given GUID.
+     *
+     * @param guid GUID of the remote endpoint.
+     * @return Pointer to the proxy. nullptr if there is no proxy with the given GUID.
+     */
+    Proxy* find(
+            const GUID_t& guid) const
+    {
+        auto it = lower_bound(guid);
+        return (proxies_.end() != it && (*it)->guid() == guid) ? *it : nullptr;
+    }
+
+    void clear()
+    {
+        proxies_.clear();
+    }
+
+private:
+
+    typename ResourceLimitedVector<Proxy*>::const_iterator lower_bound(
+            const GUID_t& guid) const
+    {
+        return std::lower_bound(proxies_.begin(), proxies_.end(), guid, [](const Proxy* proxy, const GUID_t& value)
+                       {
+                           return proxy->guid() < value;
+                       });
+    }
+
+    typename ResourceLimitedVector<Proxy*>::iterator lower_bound(
+            const GUID_t& guid)
+    {
+        return std::lower_bound(proxies_.begin(), proxies_.end(), guid, [](const Proxy* proxy, const GUID_t& value)
+                       {
+                           return proxy->guid() < value;
+                       });
+    }
+
+    ResourceLimitedVector<Proxy*> proxies_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_COMMON__PROXIESBYGUID_HPP
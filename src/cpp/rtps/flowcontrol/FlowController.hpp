@@ -90,6 +90,16 @@ public:
      * @return Maximum number of bytes of a RTPS message.
      */
     virtual uint32_t get_max_payload() = 0;
+
+    /*!
+     * Return the number of samples of a writer that were delivered after their deadline.
+     * Only the earliest deadline first scheduler keeps track of the deadline of the samples.
+     *
+     * @param writer Pointer to the writer. Cannot be nullptr.
+     * @return Number of deadline misses of the writer.
+     */
+    virtual uint64_t get_deadline_misses(
+            BaseWriter* writer) = 0;
 };
 
 } // namespace rtps
@@ -2,6 +2,7 @@
 #include "FlowControllerImpl.hpp"
 
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -17,6 +18,33 @@ void FlowControllerFactory::init(
             (nullptr == participant_) ? ThreadSettings{}
             : participant_->get_const_attributes().builtin_controllers_sender_thread;
 
+    if (nullptr != participant_)
+    {
+        const std::string* sender_threads_property = PropertyPolicyHelper::find_property(
+            participant_->get_const_attributes().properties, "fastdds.flow_controllers.sender_threads");
+        if (nullptr != sender_threads_property)
+        {
+            unsigned long sender_threads = 0;
+            try
+            {
+                sender_threads = std::stoul(*sender_threads_property);
+            }
+            catch (const std::exception& e)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                        "Error parsing flow_controllers.sender_threads property: " << e.what());
+            }
+
+            if (0 < sender_threads)
+            {
+                // Asynchronous flow controllers will share these threads instead of creating their own one.
+                sender_pool_.reset(new JobThreadPool(static_cast<uint32_t>(sender_threads),
+                        sender_thread_settings,
+                        static_cast<uint32_t>(participant_->get_const_attributes().participantID), "dds.fcp.%u.%u"));
+            }
+        }
+    }
+
     // PureSyncFlowController -> used by volatile besteffort writers.
     flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                 pure_sync_flow_controller_name,
@@ -29,14 +57,14 @@ void FlowControllerFactory::init(
                 std::unique_ptr<FlowController>(
                     new FlowControllerImpl<FlowControllerSyncPublishMode,
                     FlowControllerFifoSchedule>(participant_, nullptr, async_controller_index_++,
-                    sender_thread_settings))));
+                    sender_thread_settings, sender_pool_.get()))));
     // AsyncFlowController
     flow_controllers_.insert(decltype(flow_controllers_)::value_type(
                 async_flow_controller_name,
                 std::unique_ptr<FlowController>(
                     new FlowControllerImpl<FlowControllerAsyncPublishMode,
                     FlowControllerFifoSchedule>(participant_, nullptr, async_controller_index_++,
-                    sender_thread_settings))));
+                    sender_thread_settings, sender_pool_.get()))));
 
 #ifdef FASTDDS_STATISTICS
     flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -44,7 +72,7 @@ void FlowControllerFactory::init(
                 std::unique_ptr<FlowController>(
                     new FlowControllerImpl<FlowControllerAsyncPublishMode,
                     FlowControllerFifoSchedule>(participant_, nullptr, async_controller_index_++,
-                    sender_thread_settings))));
+                    sender_thread_settings, sender_pool_.get()))));
 #endif // ifndef FASTDDS_STATISTICS
 }
 
@@ -70,7 +98,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                                 FlowControllerFifoSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::ROUND_ROBIN:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -78,7 +107,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                                 FlowControllerRoundRobinSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -86,7 +116,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                                 FlowControllerHighPrioritySchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -94,7 +125,17 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
+                break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerLimitedAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             default:
                 assert(false);
@@ -110,7 +151,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerAsyncPublishMode,
                                 FlowControllerFifoSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::ROUND_ROBIN:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -118,7 +160,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerAsyncPublishMode,
                                 FlowControllerRoundRobinSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -126,7 +169,8 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerAsyncPublishMode,
                                 FlowControllerHighPrioritySchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             case FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION:
                 flow_controllers_.insert(decltype(flow_controllers_)::value_type(
@@ -134,7 +178,17 @@ void FlowControllerFactory::register_flow_controller (
                             std::unique_ptr<FlowController>(
                                 new FlowControllerImpl<FlowControllerAsyncPublishMode,
                                 FlowControllerPriorityWithReservationSchedule>(participant_,
-                                &flow_controller_descr, async_controller_index_++, sender_thread_settings))));
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
+                break;
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+                flow_controllers_.insert(decltype(flow_controllers_)::value_type(
+                            flow_controller_descr.name,
+                            std::unique_ptr<FlowController>(
+                                new FlowControllerImpl<FlowControllerAsyncPublishMode,
+                                FlowControllerEarliestDeadlineFirstSchedule>(participant_,
+                                &flow_controller_descr, async_controller_index_++, sender_thread_settings,
+                                sender_pool_.get()))));
                 break;
             default:
                 assert(false);
@@ -4,9 +4,11 @@
 #include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
 #include <fastdds/rtps/attributes/WriterAttributes.hpp>
 #include "FlowController.hpp"
+#include <utils/JobThreadPool.hpp>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
 
 namespace eprosima {
 
@@ -34,6 +36,8 @@ public:
     /*!
      * Initialize the factory.
      * In charge of creating default flow controllers.
+     * When the participant has the property fastdds.flow_controllers.sender_threads set to a value greater than 0,
+     * the asynchronous flow controllers share that number of sender threads instead of creating one each.
      * Call always before use it.
      *
      * @param participant Pointer to the participant owner of this object.
@@ -64,6 +68,9 @@ protected:
 
     fastdds::rtps::RTPSParticipantImpl* participant_ = nullptr;
 
+    //! Sender threads shared by the asynchronous flow controllers. Must be destroyed after them.
+    std::unique_ptr<JobThreadPool> sender_pool_;
+
     //! Stores the created flow controllers.
     std::map<std::string, std::unique_ptr<FlowController>> flow_controllers_;
 
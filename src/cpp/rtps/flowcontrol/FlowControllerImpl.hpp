@@ -2,9 +2,12 @@
 #define _RTPS_FLOWCONTROL_FLOWCONTROLLERIMPL_HPP_
 
 #include <atomic>
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <cmath>
 #include <map>
+#include <set>
 #include <unordered_map>
 
 #include "FlowController.hpp"
@@ -17,6 +20,7 @@
 #include <rtps/messages/RTPSMessageGroup.hpp>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
 #include <rtps/writer/BaseWriter.hpp>
+#include <utils/JobThreadPool.hpp>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
 
@@ -64,6 +68,12 @@ struct FlowQueue
         return new_ones_.is_empty() && old_ones_.is_empty();
     }
 
+    //! Whether the change returned by get_next_change() is a new one.
+    bool is_next_change_new() const noexcept
+    {
+        return !new_ones_.is_empty();
+    }
+
     void add_new_sample(
             CacheChange_t* change) noexcept
     {
@@ -243,6 +253,16 @@ struct FlowControllerAsyncPublishMode
         return false;
     }
 
+    bool reset_period_if_expired()
+    {
+        return false;
+    }
+
+    std::chrono::steady_clock::time_point wake_up_time() const
+    {
+        return (std::chrono::steady_clock::time_point::max)();
+    }
+
     void process_deliver_retcode(
             const DeliveryRetCode&)
     {
@@ -291,6 +311,17 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         max_bytes_per_period = descriptor->max_bytes_per_period;
         period_ms = std::chrono::milliseconds(descriptor->period_ms);
+        max_burst_bytes = descriptor->max_burst_bytes;
+
+        if (0 < max_burst_bytes)
+        {
+            // Start with a full bucket.
+            available_bytes_ = static_cast<double>(max_burst_bytes);
+            auto period_us = (std::max)(std::chrono::microseconds(period_ms).count(),
+                            static_cast<std::chrono::microseconds::rep>(1));
+            refill_bytes_per_us_ = static_cast<double>(max_bytes_per_period) / static_cast<double>(period_us);
+        }
+
         group.set_limitation(this);
     }
 
@@ -313,7 +344,24 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
         }
 
-        bool ret = (max_bytes_per_period - current_sent_bytes_) > size_to_check;
+        bool ret = false;
+
+        if (0 < max_burst_bytes)
+        {
+            refill_token_bucket(std::chrono::steady_clock::now());
+            // A sample bigger than the bucket is sent when the bucket is full.
+            uint32_t needed_bytes = (std::min)(size_to_check, max_burst_bytes);
+            ret = available_bytes_ >= needed_bytes;
+
+            if (!ret)
+            {
+                needed_bytes_ = needed_bytes;
+            }
+        }
+        else
+        {
+            ret = (max_bytes_per_period - current_sent_bytes_) > size_to_check;
+        }
 
         if (!ret)
         {
@@ -325,37 +373,84 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
     /*!
      * Wait until there is a new change added (notified by other thread) or there is a timeout (period was excedded and
-     * the bandwidth limitation has to be reset.
+     * the bandwidth limitation has to be reset, or the token bucket has the bytes needed by the next datagram).
      *
-     * @return false if the condition_variable was awaken because a new change was added. true if the condition_variable was awaken because the bandwidth limitation has to be reset.
+     * @return true if the period was exceeded and the bandwidth limitation was reset. false in other case.
      */
     bool wait(
             std::unique_lock<fastdds::TimedMutex>& lock)
     {
-        auto lapse = std::chrono::steady_clock::now() - last_period_;
-        bool reset_limit = true;
+        auto wake_up = wake_up_time();
 
-        if (lapse < period_ms)
+        if (std::chrono::steady_clock::now() < wake_up)
         {
-            if (std::cv_status::no_timeout == cv.wait_for(lock, period_ms - lapse))
-            {
-                reset_limit = false;
-            }
+            cv.wait_until(lock, wake_up);
+        }
+
+        return reset_period_if_expired();
+    }
+
+    bool force_wait() const
+    {
+        return force_wait_;
+    }
+
+    /*!
+     * Non-blocking version of wait(), used when running on a shared sender pool.
+     * Refills the token bucket, and resets the bandwidth limitation if the period was exceeded.
+     *
+     * @return true if the period was exceeded and the bandwidth limitation was reset.
+     */
+    bool reset_period_if_expired()
+    {
+        auto now = std::chrono::steady_clock::now();
+
+        if (0 < max_burst_bytes)
+        {
+            refill_token_bucket(now);
+        }
+
+        if (now - last_period_ < period_ms)
+        {
+            return false;
         }
 
-        if (reset_limit)
+        last_period_ = now;
+
+        if (0 == max_burst_bytes)
         {
-            last_period_ = std::chrono::steady_clock::now();
             force_wait_ = false;
             current_sent_bytes_ = 0;
         }
 
-        return reset_limit;
+        return true;
     }
 
-    bool force_wait() const
+    //! Time point when the flow controller may be able to send again.
+    std::chrono::steady_clock::time_point wake_up_time() const
     {
-        return force_wait_;
+        auto wake_up = last_period_ + period_ms;
+
+        if (0 < max_burst_bytes && force_wait_)
+        {
+            double missing_bytes = static_cast<double>(needed_bytes_) - available_bytes_;
+            auto refill_time = last_refill_ + std::chrono::microseconds(
+                static_cast<std::chrono::microseconds::rep>(std::ceil(missing_bytes / refill_bytes_per_us_)));
+            wake_up = (std::min)(wake_up, refill_time);
+        }
+
+        return wake_up;
+    }
+
+    //! Maximum size of the datagrams sent through this flow controller.
+    uint32_t max_payload() const
+    {
+        if (0 < max_burst_bytes)
+        {
+            return (std::min)(static_cast<uint32_t>(max_bytes_per_period), max_burst_bytes);
+        }
+
+        return static_cast<uint32_t>(max_bytes_per_period);
     }
 
     void process_deliver_retcode(
@@ -371,7 +466,14 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
             uint32_t bytes,
             RTPSMessageSenderInterface&) override
     {
-        current_sent_bytes_ += bytes;
+        if (0 < max_burst_bytes)
+        {
+            available_bytes_ -= bytes;
+        }
+        else
+        {
+            current_sent_bytes_ += bytes;
+        }
     }
 
     bool data_exceeds_limitation(
@@ -380,6 +482,27 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
             uint32_t pending_to_send,
             RTPSMessageSenderInterface&) override
     {
+        if (0 < max_burst_bytes)
+        {
+            if (size_to_add + pending_to_send <= available_bytes_)
+            {
+                return false;
+            }
+
+            refill_token_bucket(std::chrono::steady_clock::now());
+
+            if (size_to_add + pending_to_send <= available_bytes_ ||
+                    // A datagram bigger than the bucket is sent when the bucket is full.
+                    (0 == pending_to_send && available_bytes_ >= max_burst_bytes))
+            {
+                return false;
+            }
+
+            // Pending bytes will be sent before waiting.
+            needed_bytes_ = (std::min)(size_to_add, max_burst_bytes);
+            return true;
+        }
+
         return
             //   either limitation has already been reached
             (sent_bytes_limitation_ <= (current_sent_bytes_ + pending_to_send)) ||
@@ -391,8 +514,30 @@ struct FlowControllerLimitedAsyncPublishMode : public FlowControllerAsyncPublish
 
     std::chrono::milliseconds period_ms;
 
+    //! Size of the token bucket. 0 when the bandwidth limitation is applied per period.
+    uint32_t max_burst_bytes = 0;
+
 private:
 
+    void refill_token_bucket(
+            const std::chrono::steady_clock::time_point& now)
+    {
+        auto elapsed_us = std::chrono::duration_cast<std::chrono::microseconds>(now - last_refill_);
+
+        if (0 < elapsed_us.count())
+        {
+            // Sub-microsecond remainders are kept for the next refill.
+            last_refill_ += elapsed_us;
+            available_bytes_ = (std::min)(static_cast<double>(max_burst_bytes),
+                            available_bytes_ + static_cast<double>(elapsed_us.count()) * refill_bytes_per_us_);
+        }
+
+        if (force_wait_ && available_bytes_ >= needed_bytes_)
+        {
+            force_wait_ = false;
+        }
+    }
+
     bool force_wait_ {false};
 
     std::chrono::steady_clock::time_point last_period_ {std::chrono::steady_clock::now()};
@@ -400,6 +545,17 @@ private:
     uint32_t sent_bytes_limitation_ {0};
 
     uint32_t current_sent_bytes_ {0};
+
+    //! Bytes currently in the token bucket. Negative after sending a datagram bigger than the bucket.
+    double available_bytes_ {0};
+
+    //! Bytes added to the token bucket per microsecond.
+    double refill_bytes_per_us_ {0};
+
+    //! Bytes the token bucket needs before sending again.
+    uint32_t needed_bytes_ {0};
+
+    std::chrono::steady_clock::time_point last_refill_ {last_period_};
 };
 
 
@@ -815,11 +971,13 @@ struct FlowControllerPriorityWithReservationSchedule
         uint32_t reservation_bytes = (0 == bandwidth_limit_? 0 :
                 ((bandwidth_limit_ * reservation) / 100));
 
-        auto ret = writers_queue_.emplace(writer, std::make_tuple(FlowQueue(), priority, reservation_bytes, 0u));
+        WriterInfo info;
+        info.priority = priority;
+        info.registration_order = next_registration_order_++;
+        info.reservation_bytes = reservation_bytes;
+        auto ret = writers_queue_.emplace(writer, std::move(info));
         (void)ret;
         assert(ret.second);
-
-        priorities_[priority].push_back(writer);
     }
 
     void unregister_writer(
@@ -832,30 +990,29 @@ struct FlowControllerPriorityWithReservationSchedule
                     "FlowControllerPriorityWithReservationSchedule::unregister_writer: writer not found");
             return;
         }
-        int32_t priority = std::get<1>(it->second);
+
+        WriterInfo* info = &it->second;
+        ready_writers_.erase(info);
+        writers_within_reservation_.erase(info);
+        remove_from_list(writers_with_interested_changes_, info);
+        remove_from_list(writers_out_of_reservation_, info);
+        if (info == writer_being_processed_)
+        {
+            writer_being_processed_ = nullptr;
+        }
         writers_queue_.erase(it);
-        auto priority_it = priorities_.find(priority);
-        assert(priority_it != priorities_.end());
-        auto writer_it = std::find(priority_it->second.begin(), priority_it->second.end(), writer);
-        assert(writer_it != priority_it->second.end());
-        priority_it->second.erase(writer_it);
     }
 
     void work_done()
     {
         if (nullptr != writer_being_processed_)
         {
-            assert(0 != size_being_processed_);
-            auto writer = writers_queue_.find(writer_being_processed_);
-            if (writer == writers_queue_.end())
+            if (0 != size_being_processed_)
             {
-                EPROSIMA_LOG_ERROR(RTPS_WRITER,
-                        "work_done(): writer_being_processed_ not found in writers_queue_");
-            }
-            else
-            {
-                std::get<3>(writer->second) += size_being_processed_;
+                writer_being_processed_->used_bytes(current_period_) += size_being_processed_;
             }
+            // The delivered change was the head of the writer's queue.
+            update_writer_state(writer_being_processed_);
             writer_being_processed_ = nullptr;
             size_being_processed_ = 0;
         }
@@ -865,78 +1022,71 @@ struct FlowControllerPriorityWithReservationSchedule
             BaseWriter* writer,
             CacheChange_t* change)
     {
-        // Find writer queue..
-        auto it = writers_queue_.find(writer);
-        assert(it != writers_queue_.end());
-        std::get<0>(it->second).add_new_sample(change);
+        WriterInfo& info = find_writer(writer);
+        info.queue.add_new_sample(change);
+        mark_interested(info);
     }
 
     void add_old_sample(
             BaseWriter* writer,
             CacheChange_t* change)
     {
-        // Find writer queue..
-        auto it = writers_queue_.find(writer);
-        assert(it != writers_queue_.end());
-        std::get<0>(it->second).add_old_sample(change);
+        WriterInfo& info = find_writer(writer);
+        info.queue.add_old_sample(change);
+        mark_interested(info);
     }
 
     CacheChange_t* get_next_change_nts()
     {
-        CacheChange_t* highest_priority = nullptr;
-        CacheChange_t* ret_change = nullptr;
+        writer_being_processed_ = nullptr;
+        size_being_processed_ = 0;
 
-        if (0 < writers_queue_.size())
+        // Writers whose next change fits in their bandwidth reservation go first, by priority.
+        // Changes removed by the writers are not notified to the scheduler, so the state of each writer is checked
+        // again before choosing it.
+        while (!writers_within_reservation_.empty())
         {
-            for (auto& priority : priorities_)
+            WriterInfo* info = *writers_within_reservation_.begin();
+            CacheChange_t* change = info->queue.get_next_change();
+
+            if (nullptr != change && fits_in_reservation(*info, change))
             {
-                for (auto writer_it : priority.second)
-                {
-                    auto writer = writers_queue_.find(writer_it);
-                    CacheChange_t* change = std::get<0>(writer->second).get_next_change();
+                writer_being_processed_ = info;
+                size_being_processed_ = size_to_check(change);
+                return change;
+            }
 
-                    if (nullptr == highest_priority)
-                    {
-                        highest_priority = change;
-                    }
+            update_writer_state(info);
+        }
 
-                    if (nullptr != change)
-                    {
-                        // Check if writer's next change can be processed because the writer's bandwidth reservation is
-                        // enough.
-                        uint32_t size_to_check = change->serializedPayload.length;
-                        if (0 != change->getFragmentCount())
-                        {
-                            size_to_check = change->getFragmentSize();
-                        }
-
-                        if (std::get<2>(writer->second) > (std::get<3>(writer->second) + size_to_check))
-                        {
-                            ret_change = change;
-                            writer_being_processed_ = writer_it;
-                            size_being_processed_ = size_to_check;
-                            break;
-                        }
-                    }
-                }
+        // Otherwise, the change of the highest priority writer.
+        while (!ready_writers_.empty())
+        {
+            WriterInfo* info = *ready_writers_.begin();
+            CacheChange_t* change = info->queue.get_next_change();
 
-                if (nullptr != ret_change)
-                {
-                    break;
-                }
+            if (nullptr != change)
+            {
+                writer_being_processed_ = info;
+                return change;
             }
+
+            update_writer_state(info);
         }
 
-        return (nullptr != ret_change ? ret_change : highest_priority);
+        return nullptr;
     }
 
     void add_interested_changes_to_queue_nts()
     {
         // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
-        for (auto& queue : writers_queue_)
+        for (WriterInfo* info : writers_with_interested_changes_)
         {
-            std::get<0>(queue.second).add_interested_changes_to_queue();
+            info->has_interested_changes = false;
+            info->queue.add_interested_changes_to_queue();
+            update_writer_state(info);
         }
+        writers_with_interested_changes_.clear();
     }
 
     void set_bandwith_limitation(
@@ -947,32 +1097,353 @@ struct FlowControllerPriorityWithReservationSchedule
 
     void trigger_bandwidth_limit_reset()
     {
-        for (auto& writer : writers_queue_)
+        // Consumed bytes of the previous period are discarded lazily.
+        ++current_period_;
+
+        // Only the writers which ran out of reservation can have changed their state.
+        std::vector<WriterInfo*> out_of_reservation;
+        out_of_reservation.swap(writers_out_of_reservation_);
+        for (WriterInfo* info : out_of_reservation)
         {
-            std::get<3>(writer.second) = 0;
+            info->is_out_of_reservation = false;
+            update_writer_state(info);
         }
     }
 
 private:
 
-    using map_writers = std::unordered_map<BaseWriter*, std::tuple<FlowQueue, int32_t, uint32_t,
-                    uint32_t>>;
+    struct WriterInfo
+    {
+        //! Returns the bytes consumed from the reservation in the given period.
+        uint32_t& used_bytes(
+                uint64_t period)
+        {
+            if (period != used_bytes_period)
+            {
+                used_bytes_period = period;
+                used_bytes_in_period = 0;
+            }
+            return used_bytes_in_period;
+        }
+
+        FlowQueue queue;
+
+        int32_t priority = 10;
+
+        //! Used to keep the registration order among writers with the same priority.
+        uint64_t registration_order = 0;
+
+        uint32_t reservation_bytes = 0;
+
+        uint32_t used_bytes_in_period = 0;
+
+        uint64_t used_bytes_period = 0;
+
+        //! Whether the writer is in writers_with_interested_changes_.
+        bool has_interested_changes = false;
+
+        //! Whether the writer is in writers_out_of_reservation_.
+        bool is_out_of_reservation = false;
+    };
+
+    struct PriorityOrder
+    {
+        bool operator ()(
+                const WriterInfo* lhs,
+                const WriterInfo* rhs) const
+        {
+            return lhs->priority < rhs->priority ||
+                   (lhs->priority == rhs->priority && lhs->registration_order < rhs->registration_order);
+        }
+    };
+
+    static uint32_t size_to_check(
+            CacheChange_t* change)
+    {
+        return 0 != change->getFragmentCount() ? change->getFragmentSize() : change->serializedPayload.length;
+    }
+
+    bool fits_in_reservation(
+            WriterInfo& info,
+            CacheChange_t* change)
+    {
+        return info.reservation_bytes > (info.used_bytes(current_period_) + size_to_check(change));
+    }
+
+    static void remove_from_list(
+            std::vector<WriterInfo*>& list,
+            WriterInfo* info)
+    {
+        auto it = std::find(list.begin(), list.end(), info);
+        if (list.end() != it)
+        {
+            list.erase(it);
+        }
+    }
+
+    WriterInfo& find_writer(
+            BaseWriter* writer)
+    {
+        auto it = writers_queue_.find(writer);
+        assert(it != writers_queue_.end());
+        return it->second;
+    }
+
+    void mark_interested(
+            WriterInfo& info)
+    {
+        // This function should be called with interested_lock locked.
+        if (!info.has_interested_changes)
+        {
+            info.has_interested_changes = true;
+            writers_with_interested_changes_.push_back(&info);
+        }
+    }
+
+    //! Places the writer in the indexes according to its next change.
+    void update_writer_state(
+            WriterInfo* info)
+    {
+        CacheChange_t* change = info->queue.get_next_change();
+
+        if (nullptr == change)
+        {
+            ready_writers_.erase(info);
+            writers_within_reservation_.erase(info);
+            return;
+        }
+
+        ready_writers_.insert(info);
+
+        if (fits_in_reservation(*info, change))
+        {
+            writers_within_reservation_.insert(info);
+        }
+        else
+        {
+            writers_within_reservation_.erase(info);
+
+            if (0 != info->reservation_bytes && !info->is_out_of_reservation)
+            {
+                info->is_out_of_reservation = true;
+                writers_out_of_reservation_.push_back(info);
+            }
+        }
+    }
+
+    std::unordered_map<BaseWriter*, WriterInfo> writers_queue_;
+
+    //! Writers with changes in their queue, ordered by priority.
+    std::set<WriterInfo*, PriorityOrder> ready_writers_;
+
+    //! Writers whose next change fits in their bandwidth reservation, ordered by priority.
+    std::set<WriterInfo*, PriorityOrder> writers_within_reservation_;
+
+    //! Writers with changes to be included in their queue.
+    //! Should be protected with changes_interested_mutex.
+    std::vector<WriterInfo*> writers_with_interested_changes_;
 
-    using map_priorities = std::map<int32_t, std::vector<BaseWriter*>>;
+    //! Writers whose next change did not fit in their bandwidth reservation during current period.
+    std::vector<WriterInfo*> writers_out_of_reservation_;
 
-    map_writers writers_queue_;
+    uint64_t next_registration_order_ = 0;
 
-    map_priorities priorities_;
+    uint64_t current_period_ = 0;
 
     uint32_t bandwidth_limit_ = 0;
 
-    BaseWriter* writer_being_processed_ = nullptr;
+    WriterInfo* writer_being_processed_ = nullptr;
 
+    //! Bytes consumed from the reservation of writer_being_processed_. 0 if its change does not use the reservation.
     uint32_t size_being_processed_ = 0;
 };
 
+//! Earliest deadline first scheduling
+struct FlowControllerEarliestDeadlineFirstSchedule
+{
+    void register_writer(
+            BaseWriter* writer)
+    {
+        assert(nullptr != writer);
+        int64_t latency_budget_ns = -1;
+        auto property = PropertyPolicyHelper::find_property(
+            writer->getAttributes().properties, "fastdds.sfc.latency_budget_us");
+
+        if (nullptr != property)
+        {
+            char* ptr = nullptr;
+            uint32_t latency_budget_us = strtoul(property->c_str(), &ptr, 10);
+
+            if (property->c_str() != ptr)     // A valid integer was read.
+            {
+                latency_budget_ns = static_cast<int64_t>(latency_budget_us) * 1000;
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                        "Not numerical value for fastdds.sfc.latency_budget_us property. No latency budget set");
+            }
+        }
+
+        WriterInfo info;
+        info.latency_budget_ns = latency_budget_ns;
+        auto ret = writers_queue_.emplace(writer, std::move(info));
+        (void)ret;
+        assert(ret.second);
+    }
+
+    void unregister_writer(
+            BaseWriter* writer)
+    {
+        auto it = writers_queue_.find(writer);
+        if (it == writers_queue_.end())
+        {
+            EPROSIMA_LOG_ERROR(RTPS_WRITER,
+                    "FlowControllerEarliestDeadlineFirstSchedule::unregister_writer: writer not found");
+            return;
+        }
+        writers_queue_.erase(it);
+
+        if (writer == writer_being_processed_)
+        {
+            writer_being_processed_ = nullptr;
+        }
+    }
+
+    void work_done()
+    {
+        if (nullptr != writer_being_processed_)
+        {
+            Time_t now;
+            Time_t::now(now);
+            if (now.to_ns() > deadline_being_processed_)
+            {
+                auto writer = writers_queue_.find(writer_being_processed_);
+                assert(writer != writers_queue_.end());
+                ++writer->second.deadline_misses;
+            }
+            writer_being_processed_ = nullptr;
+        }
+    }
+
+    void add_new_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        find_queue(writer).add_new_sample(change);
+    }
+
+    void add_old_sample(
+            BaseWriter* writer,
+            CacheChange_t* change)
+    {
+        find_queue(writer).add_old_sample(change);
+    }
+
+    CacheChange_t* get_next_change_nts()
+    {
+        CacheChange_t* ret_change = nullptr;
+        BaseWriter* ret_writer = nullptr;
+        bool ret_is_new = false;
+        int64_t earliest_deadline = 0;
+        int64_t earliest_timestamp = 0;
+
+        writer_being_processed_ = nullptr;
+
+        for (auto& writer : writers_queue_)
+        {
+            CacheChange_t* change = writer.second.queue.get_next_change();
+
+            if (nullptr != change)
+            {
+                // Samples of writers without latency budget go after the rest. Ties are resolved in writing order.
+                int64_t timestamp = change->sourceTimestamp.to_ns();
+                int64_t deadline = 0 > writer.second.latency_budget_ns ?
+                        (std::numeric_limits<int64_t>::max)() : timestamp + writer.second.latency_budget_ns;
+
+                if (nullptr == ret_change || deadline < earliest_deadline ||
+                        (deadline == earliest_deadline && timestamp < earliest_timestamp))
+                {
+                    ret_change = change;
+                    ret_writer = writer.first;
+                    ret_is_new = writer.second.queue.is_next_change_new();
+                    earliest_deadline = deadline;
+                    earliest_timestamp = timestamp;
+                }
+            }
+        }
+
+        // Only the first delivery of a sample with latency budget can miss its deadline.
+        if (ret_is_new && (std::numeric_limits<int64_t>::max)() != earliest_deadline)
+        {
+            writer_being_processed_ = ret_writer;
+            deadline_being_processed_ = earliest_deadline;
+        }
+
+        return ret_change;
+    }
+
+    void add_interested_changes_to_queue_nts()
+    {
+        // This function should be called with mutex_  and interested_lock locked, because the queue is changed.
+        for (auto& queue : writers_queue_)
+        {
+            queue.second.queue.add_interested_changes_to_queue();
+        }
+    }
+
+    void set_bandwith_limitation(
+            uint32_t) const
+    {
+    }
+
+    void trigger_bandwidth_limit_reset() const
+    {
+    }
+
+    /*!
+     * Returns the number of samples of a writer that were delivered after their deadline.
+     *
+     * @param writer Pointer to the writer.
+     * @return Number of deadline misses of the writer. 0 if the writer is not registered.
+     */
+    uint64_t get_deadline_misses(
+            BaseWriter* writer) const
+    {
+        auto it = writers_queue_.find(writer);
+        return writers_queue_.end() != it ? it->second.deadline_misses : 0;
+    }
+
+private:
+
+    struct WriterInfo
+    {
+        FlowQueue queue;
+
+        //! Latency budget of the writer's samples. Negative when the writer has no latency budget.
+        int64_t latency_budget_ns = -1;
+
+        //! Number of samples delivered after their deadline.
+        uint64_t deadline_misses = 0;
+    };
+
+    FlowQueue& find_queue(
+            BaseWriter* writer)
+    {
+        auto it = writers_queue_.find(writer);
+        assert(it != writers_queue_.end());
+        return it->second.queue;
+    }
+
+    std::unordered_map<BaseWriter*, WriterInfo> writers_queue_;
+
+    BaseWriter* writer_being_processed_ = nullptr;
+
+    int64_t deadline_being_processed_ = 0;
+};
+
 template<typename PublishMode, typename SampleScheduling>
-class FlowControllerImpl : public FlowController
+class FlowControllerImpl : public FlowController, private JobThreadPool::Job
 {
     using publish_mode = PublishMode;
     using scheduler = SampleScheduling;
@@ -983,19 +1454,21 @@ public:
             RTPSParticipantImpl* participant,
             const FlowControllerDescriptor* descriptor,
             uint32_t async_index,
-            ThreadSettings thread_settings)
+            ThreadSettings thread_settings,
+            JobThreadPool* sender_pool = nullptr)
         : participant_(participant)
         , async_mode(participant, descriptor)
         , participant_id_(0)
         , async_index_(async_index)
         , thread_settings_(thread_settings)
+        , sender_pool_(sender_pool)
     {
         if (nullptr != participant)
         {
             participant_id_ = static_cast<uint32_t>(participant->get_const_attributes().participantID);
         }
 
-        uint32_t limitation = get_max_payload();
+        uint32_t limitation = get_bandwidth_limitation_impl();
 
         if ((std::numeric_limits<uint32_t>::max)() != limitation)
         {
@@ -1005,6 +1478,7 @@ public:
 
     virtual ~FlowControllerImpl() noexcept
     {
+        stop_sender_pool_job();
     }
 
     /*!
@@ -1100,6 +1574,13 @@ public:
         return get_max_payload_impl();
     }
 
+    uint64_t get_deadline_misses(
+            BaseWriter* writer) override
+    {
+        std::unique_lock<fastdds::TimedMutex> lock(mutex_);
+        return get_deadline_misses_impl(writer);
+    }
+
 protected:
 
     /*!
@@ -1110,7 +1591,7 @@ protected:
     initialize_async_thread()
     {
         bool expected = false;
-        if (async_mode.running.compare_exchange_strong(expected, true))
+        if (async_mode.running.compare_exchange_strong(expected, true) && nullptr == sender_pool_)
         {
             // Code for initializing the asynchronous thread.
             async_mode.thread = create_thread([this]()
@@ -1130,6 +1611,45 @@ protected:
         // Do nothing.
     }
 
+    /*!
+     * Removes this flow controller from the shared sender pool, waiting for its current execution to finish.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    stop_sender_pool_job()
+    {
+        if (nullptr != sender_pool_)
+        {
+            sender_pool_->remove(this);
+            // There is no asynchronous thread to be joined.
+            async_mode.running = false;
+        }
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
+    stop_sender_pool_job()
+    {
+        // Do nothing.
+    }
+
+    /*!
+     * Wakes up the asynchronous thread, or submits this flow controller to the shared sender pool.
+     *
+     * @note Before calling this function, async_mode.changes_interested_mutex has to be locked.
+     */
+    void notify_async_sender()
+    {
+        if (nullptr == sender_pool_)
+        {
+            async_mode.cv.notify_one();
+        }
+        else if (async_mode.running)
+        {
+            sender_pool_->submit(this);
+        }
+    }
+
     template<typename PubMode = PublishMode>
     typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value, void>::type
     register_writer_impl(
@@ -1187,7 +1707,7 @@ protected:
 #endif // if HAVE_STRICT_REALTIME{
         {
             sched.add_new_sample(writer, change);
-            async_mode.cv.notify_one();
+            notify_async_sender();
             ret_value = true;
         }
 
@@ -1288,7 +1808,7 @@ protected:
 #endif // if HAVE_STRICT_REALTIME{
             {
                 sched.add_old_sample(writer, change);
-                async_mode.cv.notify_one();
+                notify_async_sender();
                 ret_value = true;
             }
         }
@@ -1430,93 +1950,172 @@ protected:
                 }
             }
 
-            BaseWriter* current_writer = nullptr;
-            while (nullptr != change_to_process)
+            deliver_changes_nts(change_to_process);
+        }
+    }
+
+    /*!
+     * Function run by the shared sender pool each time this flow controller is executed.
+     * Unlike run(), it never blocks waiting for new samples or for the bandwidth limitation to be reset.
+     *
+     * @return Time point when this flow controller has to be executed again.
+     */
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value,
+            JobThreadPool::time_point>::type
+    run_step()
+    {
+        if (!async_mode.running)
+        {
+            return (JobThreadPool::time_point::max)();
+        }
+
+        // There are writers interested in removing a sample.
+        if (0 != async_mode.writers_interested_in_remove)
+        {
+            return std::chrono::steady_clock::now();
+        }
+
+        std::unique_lock<fastdds::TimedMutex> lock(mutex_);
+        CacheChange_t* change_to_process = nullptr;
+
+        {
+            std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+
+            if (async_mode.reset_period_if_expired())
             {
-                // Fast check if next change will enter.
-                if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
-                {
-                    break;
-                }
+                sched.trigger_bandwidth_limit_reset();
+            }
+            // Add interested changes into the queue.
+            sched.add_interested_changes_to_queue_nts();
 
-                if (nullptr == current_writer || current_writer->getGuid() != change_to_process->writerGUID)
-                {
-                    auto writer_it = writers_.find(change_to_process->writerGUID);
-                    assert(writers_.end() != writer_it);
+            if (async_mode.force_wait())
+            {
+                return async_mode.wake_up_time();
+            }
 
-                    current_writer = writer_it->second;
-                }
+            change_to_process = sched.get_next_change_nts();
+            if (nullptr == change_to_process)
+            {
+                return (JobThreadPool::time_point::max)();
+            }
+        }
 
-                if (!current_writer->getMutex().try_lock())
-                {
-                    break;
-                }
+        deliver_changes_nts(change_to_process);
 
-                LocatorSelectorSender& locator_selector =
-                        current_writer->get_async_locator_selector();
-                async_mode.group.sender(current_writer, &locator_selector);
-                locator_selector.lock();
-
-                // Remove previously from queue, because deliver_sample_nts could call FlowController::remove_sample()
-                // provoking a deadlock.
-                CacheChange_t* previous = change_to_process->writer_info.previous;
-                CacheChange_t* next = change_to_process->writer_info.next;
-                previous->writer_info.next = next;
-                next->writer_info.previous = previous;
-                change_to_process->writer_info.previous = nullptr;
-                change_to_process->writer_info.next = nullptr;
-                change_to_process->writer_info.is_linked.store(false);
-
-                DeliveryRetCode ret_delivery = current_writer->deliver_sample_nts(
-                    change_to_process, async_mode.group, locator_selector,
-                    std::chrono::steady_clock::now() + std::chrono::hours(24));
-
-                if (DeliveryRetCode::DELIVERED != ret_delivery)
-                {
-                    // If delivery fails, put the change again in the queue.
-                    change_to_process->writer_info.is_linked.store(true);
-                    previous->writer_info.next = change_to_process;
-                    next->writer_info.previous = change_to_process;
-                    change_to_process->writer_info.previous = previous;
-                    change_to_process->writer_info.next = next;
-
-                    async_mode.process_deliver_retcode(ret_delivery);
-
-                    locator_selector.unlock();
-                    current_writer->getMutex().unlock();
-                    // Unlock mutex_ and try again.
-                    break;
-                }
+        // Check again for pending changes.
+        return std::chrono::steady_clock::now();
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_same<FlowControllerPureSyncPublishMode, PubMode>::value,
+            JobThreadPool::time_point>::type
+    run_step()
+    {
+        return (JobThreadPool::time_point::max)();
+    }
+
+    JobThreadPool::time_point execute() override
+    {
+        return run_step();
+    }
+
+    /*!
+     * Delivers the changes in the queue, starting with the given one, until the queue is empty, the bandwidth
+     * limitation is reached or a writer cannot deliver its change.
+     *
+     * @param change_to_process First change to be delivered. Cannot be nullptr.
+     * @note Before calling this function, mutex_ has to be locked.
+     */
+    void deliver_changes_nts(
+            CacheChange_t* change_to_process)
+    {
+        BaseWriter* current_writer = nullptr;
+        while (nullptr != change_to_process)
+        {
+            // Fast check if next change will enter.
+            if (!async_mode.fast_check_is_there_slot_for_change(change_to_process))
+            {
+                break;
+            }
+
+            if (nullptr == current_writer || current_writer->getGuid() != change_to_process->writerGUID)
+            {
+                auto writer_it = writers_.find(change_to_process->writerGUID);
+                assert(writers_.end() != writer_it);
+
+                current_writer = writer_it->second;
+            }
+
+            if (!current_writer->getMutex().try_lock())
+            {
+                break;
+            }
+
+            LocatorSelectorSender& locator_selector =
+                    current_writer->get_async_locator_selector();
+            async_mode.group.sender(current_writer, &locator_selector);
+            locator_selector.lock();
+
+            // Remove previously from queue, because deliver_sample_nts could call FlowController::remove_sample()
+            // provoking a deadlock.
+            CacheChange_t* previous = change_to_process->writer_info.previous;
+            CacheChange_t* next = change_to_process->writer_info.next;
+            previous->writer_info.next = next;
+            next->writer_info.previous = previous;
+            change_to_process->writer_info.previous = nullptr;
+            change_to_process->writer_info.next = nullptr;
+            change_to_process->writer_info.is_linked.store(false);
+
+            DeliveryRetCode ret_delivery = current_writer->deliver_sample_nts(
+                change_to_process, async_mode.group, locator_selector,
+                std::chrono::steady_clock::now() + std::chrono::hours(24));
+
+            if (DeliveryRetCode::DELIVERED != ret_delivery)
+            {
+                // If delivery fails, put the change again in the queue.
+                change_to_process->writer_info.is_linked.store(true);
+                previous->writer_info.next = change_to_process;
+                next->writer_info.previous = change_to_process;
+                change_to_process->writer_info.previous = previous;
+                change_to_process->writer_info.next = next;
+
+                async_mode.process_deliver_retcode(ret_delivery);
 
                 locator_selector.unlock();
                 current_writer->getMutex().unlock();
+                // Unlock mutex_ and try again.
+                break;
+            }
 
-                sched.work_done();
+            locator_selector.unlock();
+            current_writer->getMutex().unlock();
 
-                if (0 != async_mode.writers_interested_in_remove)
-                {
-                    // There are writers that want to remove samples.
-                    break;
-                }
+            sched.work_done();
 
-                // Add interested changes into the queue.
-                {
-                    std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
-                    sched.add_interested_changes_to_queue_nts();
-                }
+            if (0 != async_mode.writers_interested_in_remove)
+            {
+                // There are writers that want to remove samples.
+                break;
+            }
 
-                change_to_process = sched.get_next_change_nts();
+            // Add interested changes into the queue.
+            {
+                std::unique_lock<fastdds::TimedMutex> in_lock(async_mode.changes_interested_mutex);
+                sched.add_interested_changes_to_queue_nts();
             }
 
-            async_mode.group.sender(nullptr, nullptr);
+            change_to_process = sched.get_next_change_nts();
         }
+
+        async_mode.group.sender(nullptr, nullptr);
     }
 
     template<typename PubMode = PublishMode>
     typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
     get_max_payload_impl()
     {
-        return static_cast<uint32_t>(async_mode.max_bytes_per_period);
+        return async_mode.max_payload();
     }
 
     template<typename PubMode = PublishMode>
@@ -1526,6 +2125,37 @@ protected:
         return (std::numeric_limits<uint32_t>::max)();
     }
 
+    template<typename Sched = SampleScheduling>
+    typename std::enable_if<std::is_same<FlowControllerEarliestDeadlineFirstSchedule, Sched>::value, uint64_t>::type
+    get_deadline_misses_impl(
+            BaseWriter* writer) const
+    {
+        return sched.get_deadline_misses(writer);
+    }
+
+    template<typename Sched = SampleScheduling>
+    typename std::enable_if<!std::is_same<FlowControllerEarliestDeadlineFirstSchedule, Sched>::value, uint64_t>::type
+    constexpr get_deadline_misses_impl(
+            BaseWriter*) const
+    {
+        return 0;
+    }
+
+    //! Number of bytes per period that the scheduler can distribute among writers.
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    get_bandwidth_limitation_impl()
+    {
+        return static_cast<uint32_t>(async_mode.max_bytes_per_period);
+    }
+
+    template<typename PubMode = PublishMode>
+    typename std::enable_if<!std::is_base_of<FlowControllerLimitedAsyncPublishMode, PubMode>::value, uint32_t>::type
+    constexpr get_bandwidth_limitation_impl() const
+    {
+        return (std::numeric_limits<uint32_t>::max)();
+    }
+
     fastdds::TimedMutex mutex_;
 
     RTPSParticipantImpl* participant_ = nullptr;
@@ -1542,6 +2172,9 @@ protected:
 
     //! Thread settings for the sender thread
     ThreadSettings thread_settings_;
+
+    //! Shared sender pool used instead of the sender thread. nullptr when using the sender thread.
+    JobThreadPool* sender_pool_ = nullptr;
 };
 
 } // namespace rtps
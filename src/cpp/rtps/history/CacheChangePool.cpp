@@ -23,6 +23,7 @@
 #include <rtps/history/CacheChangePool.h>
 
 #include <mutex>
+#include <cstdlib>
 #include <cstring>
 #include <cassert>
 #include <limits>
@@ -35,10 +36,25 @@ CacheChangePool::~CacheChangePool()
 {
     EPROSIMA_LOG_INFO(RTPS_UTILS, "ChangePool destructor");
 
-    // Deletion process does not depend on the memory management policy
-    for (CacheChange_t* cache : all_caches_)
+    if (memory_mode_ == PREALLOCATED_MEMORY_MODE ||
+            memory_mode_ == PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
     {
-        destroy_change(cache);
+        // Changes live on slabs, so they are destructed in place and the slabs freed afterwards
+        for (CacheChange_t* cache : all_caches_)
+        {
+            cache->~CacheChange_t();
+        }
+        for (void* slab : slabs_)
+        {
+            free(slab);
+        }
+    }
+    else
+    {
+        for (CacheChange_t* cache : all_caches_)
+        {
+            destroy_change(cache);
+        }
     }
 }
 
@@ -135,12 +151,25 @@ bool CacheChangePool::allocateGroup(
         return false;
     }
 
+    // Changes of the group are laid out contiguously, each one starting on its own cache line, so consecutive
+    // changes do not share cache lines and walking through them is prefetcher friendly.
+    size_t stride = (change_size() + cache_line_size - 1) & ~(cache_line_size - 1);
+    void* slab = malloc(stride * group_size + cache_line_size - 1);
+    if (nullptr == slab)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_HISTORY, "Could not allocate a group of " << group_size << " cache changes");
+        return false;
+    }
+    slabs_.push_back(slab);
+    uintptr_t storage = (reinterpret_cast<uintptr_t>(slab) + cache_line_size - 1) & ~(cache_line_size - 1);
+
     all_caches_.reserve(desired_size);
     free_caches_.reserve(free_caches_.size() + group_size);
 
-    while (current_pool_size_ < desired_size)
+    // Pushed in reverse order so the free list, which is used as a stack, hands out changes in address order
+    for (uint32_t i = group_size; i > 0; --i)
     {
-        CacheChange_t* ch = create_change();
+        CacheChange_t* ch = construct_change(reinterpret_cast<void*>(storage + stride * (i - 1)));
         all_caches_.push_back(ch);
         free_caches_.push_back(ch);
         ++current_pool_size_;
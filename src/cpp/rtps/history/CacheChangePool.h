@@ -29,6 +29,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstddef>
+#include <new>
 
 namespace eprosima {
 namespace fastdds {
@@ -78,17 +79,23 @@ public:
             CacheChange_t* cache_change) override;
 
     //!Get the size of the cache vector; all of them (reserved and not reserved).
-    size_t get_allCachesSize()
+    size_t get_allCachesSize() const
     {
         return all_caches_.size();
     }
 
     //!Get the number of free caches.
-    size_t get_freeCachesSize()
+    size_t get_freeCachesSize() const
     {
         return free_caches_.size();
     }
 
+    //!Get the number of bytes taken by all the caches (reserved and not reserved).
+    size_t get_allCachesBytes() const
+    {
+        return all_caches_.size() * change_size();
+    }
+
 protected:
 
     /**
@@ -99,17 +106,42 @@ protected:
     void init(
             const PoolConfig& config);
 
+    //! Size of the objects created by this pool. Should be overridden together with construct_change.
+    virtual size_t change_size() const
+    {
+        return sizeof(CacheChange_t);
+    }
+
+    /**
+     * Construct a change in the provided storage.
+     * Used on preallocated modes, where changes are placed on contiguous slabs.
+     *
+     * @param storage  Pointer to the storage, holding at least @c change_size() bytes and aligned to a cache line.
+     *
+     * @return Pointer to the constructed change.
+     */
+    virtual CacheChange_t* construct_change(
+            void* storage) const
+    {
+        return new (storage) CacheChange_t();
+    }
+
+    //! Allocate a single change. Used on dynamic modes.
     virtual CacheChange_t* create_change() const
     {
         return new CacheChange_t();
     }
 
+    //! Deallocate a single change created with create_change.
     virtual void destroy_change(
             CacheChange_t* change) const
     {
         delete change;
     }
 
+    //! Alignment of the changes on preallocated slabs.
+    static constexpr size_t cache_line_size = 64u;
+
 private:
 
     uint32_t current_pool_size_ = 0;
@@ -119,6 +151,9 @@ private:
     std::vector<CacheChange_t*> free_caches_;
     std::vector<CacheChange_t*> all_caches_;
 
+    //! Raw memory blocks holding the changes created on preallocated modes.
+    std::vector<void*> slabs_;
+
     bool allocateGroup(
             uint32_t num_caches);
 
@@ -0,0 +1,78 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HistoryMemoryUsage.hpp
+ */
+
+#ifndef FASTDDS_RTPS_HISTORY__HISTORYMEMORYUSAGE_HPP
+#define FASTDDS_RTPS_HISTORY__HISTORYMEMORYUSAGE_HPP
+
+#include <memory>
+
+#include <fastdds/rtps/common/CacheChange.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
+#include <fastdds/rtps/history/IChangePool.hpp>
+#include <fastdds/rtps/history/IPayloadPool.hpp>
+
+#include <rtps/history/CacheChangePool.h>
+#include <rtps/history/ITopicPayloadPool.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * @brief Fill the memory used by the history of an endpoint and its pools.
+ *
+ * Custom pools, which do not expose their size, are reported as empty.
+ *
+ * @param [in]  num_changes   Number of changes on the history.
+ * @param [in]  change_pool   Pool of changes used by the history.
+ * @param [in]  payload_pool  Pool of payloads used by the history.
+ * @param [out] usage         Structure where the history and pools usage is filled.
+ */
+inline void fill_history_memory_usage(
+        size_t num_changes,
+        const std::shared_ptr<IChangePool>& change_pool,
+        const std::shared_ptr<IPayloadPool>& payload_pool,
+        EndpointMemoryUsage& usage)
+{
+    usage.history.elements = num_changes;
+    usage.history.bytes = num_changes * sizeof(CacheChange_t);
+
+    const CacheChangePool* cache_change_pool = dynamic_cast<const CacheChangePool*>(change_pool.get());
+    if (nullptr != cache_change_pool)
+    {
+        usage.change_pool.elements = cache_change_pool->get_allCachesSize();
+        usage.change_pool.bytes = cache_change_pool->get_allCachesBytes();
+        if (0 < usage.change_pool.elements)
+        {
+            usage.history.bytes = num_changes * (usage.change_pool.bytes / usage.change_pool.elements);
+        }
+    }
+
+    const ITopicPayloadPool* topic_payload_pool = dynamic_cast<const ITopicPayloadPool*>(payload_pool.get());
+    if (nullptr != topic_payload_pool)
+    {
+        usage.payload_pool.elements = topic_payload_pool->payload_pool_allocated_size();
+        usage.payload_pool.bytes = topic_payload_pool->payload_pool_allocated_bytes();
+    }
+}
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_HISTORY__HISTORYMEMORYUSAGE_HPP
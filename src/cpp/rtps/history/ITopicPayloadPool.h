@@ -86,6 +86,11 @@ public:
      */
     virtual size_t payload_pool_available_size() const = 0;
 
+    /**
+     * @brief Get the number of bytes reserved for the data of the allocated payloads.
+     */
+    virtual size_t payload_pool_allocated_bytes() const = 0;
+
 };
 
 }  // namespace rtps
@@ -66,7 +66,12 @@ bool TopicPayloadPool::do_get_payload(
     // Resize if needed
     if (resizeable && size > payload_node->data_size())
     {
-        if (!payload_node->resize(size))
+        uint32_t old_size = payload_node->data_size();
+        if (payload_node->resize(size))
+        {
+            allocated_bytes_.fetch_add(size - old_size, std::memory_order_relaxed);
+        }
+        else
         {
             // Failed to resize, but we can still keep it for later.
             free_payloads_.push_back(payload_node);
@@ -193,6 +198,7 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
     {
         payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
         all_payloads_.push_back(payload);
+        allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
     }
     else
     {
@@ -271,6 +277,7 @@ bool TopicPayloadPool::shrink (
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
         all_payloads_.back()->data_index(payload->data_index());
         all_payloads_.pop_back();
+        allocated_bytes_.fetch_sub(payload->data_size(), std::memory_order_relaxed);
         delete payload;
     }
 
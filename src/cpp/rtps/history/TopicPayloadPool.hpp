@@ -127,6 +127,11 @@ public:
         return free_payloads_.size();
     }
 
+    size_t payload_pool_allocated_bytes() const override
+    {
+        return allocated_bytes_.load(std::memory_order_relaxed);
+    }
+
     static std::unique_ptr<ITopicPayloadPool> get(
             const BasicPoolConfig& config);
 
@@ -358,6 +363,8 @@ protected:
     std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
+    std::atomic<size_t> allocated_bytes_{0};  //< Bytes reserved for the data of all payloads
+
     std::mutex mutex_;
 
 };
@@ -51,6 +51,7 @@ public:
                 all_payloads_.at(data_index) = all_payloads_.back();
                 all_payloads_.back()->data_index(data_index);
                 all_payloads_.pop_back();
+                allocated_bytes_.fetch_sub(payload_node->data_size(), std::memory_order_relaxed);
                 lock.unlock();
 
                 // Now delete the data
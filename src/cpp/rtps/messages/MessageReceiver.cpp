@@ -50,9 +50,26 @@ namespace rtps {
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
-    : mtx_()
-    , associated_writers_()
-    , associated_readers_()
+    : MessageReceiver(participant, rec_buffer_size, std::make_shared<AssociatedEndpoints>())
+{
+}
+
+MessageReceiver::MessageReceiver(
+        RTPSParticipantImpl* participant,
+        uint32_t rec_buffer_size,
+        const MessageReceiver& endpoints_owner)
+    : MessageReceiver(participant, rec_buffer_size, endpoints_owner.endpoints_)
+{
+}
+
+MessageReceiver::MessageReceiver(
+        RTPSParticipantImpl* participant,
+        uint32_t rec_buffer_size,
+        const std::shared_ptr<AssociatedEndpoints>& endpoints)
+    : endpoints_(endpoints)
+    , mtx_(endpoints->mtx)
+    , associated_writers_(endpoints->writers)
+    , associated_readers_(endpoints->readers)
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
     , participant_(participant)
 #endif // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
@@ -120,8 +137,9 @@ MessageReceiver::MessageReceiver(
 MessageReceiver::~MessageReceiver()
 {
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, "");
-    assert(associated_writers_.empty());
-    assert(associated_readers_.empty());
+    // Endpoints are only checked by the last receiver sharing them
+    assert(1 < endpoints_.use_count() || associated_writers_.empty());
+    assert(1 < endpoints_.use_count() || associated_readers_.empty());
 }
 
  #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
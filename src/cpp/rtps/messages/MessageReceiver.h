@@ -21,6 +21,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <functional>
+#include <memory>
 #include <unordered_map>
 
 #include <fastdds/rtps/common/CDRMessage_t.hpp>
@@ -71,6 +72,18 @@ public:
             RTPSParticipantImpl* participant,
             uint32_t rec_buffer_size);
 
+    /**
+     * Constructor of a receiver sharing the associated endpoints of another one.
+     * Each receiver keeps the state of the message it is processing, so both can process messages concurrently.
+     * @param participant
+     * @param rec_buffer_size
+     * @param endpoints_owner Receiver whose associated endpoints are shared.
+     */
+    MessageReceiver(
+            RTPSParticipantImpl* participant,
+            uint32_t rec_buffer_size,
+            const MessageReceiver& endpoints_owner);
+
     virtual ~MessageReceiver();
 
     /**
@@ -92,9 +105,23 @@ public:
 
 private:
 
-    mutable eprosima::shared_mutex mtx_;
-    std::vector<BaseWriter*> associated_writers_;
-    std::unordered_map<EntityId_t, std::vector<BaseReader*>> associated_readers_;
+    //! Endpoints associated to a receiver, shared with the receivers created from it.
+    struct AssociatedEndpoints
+    {
+        eprosima::shared_mutex mtx;
+        std::vector<BaseWriter*> writers;
+        std::unordered_map<EntityId_t, std::vector<BaseReader*>> readers;
+    };
+
+    MessageReceiver(
+            RTPSParticipantImpl* participant,
+            uint32_t rec_buffer_size,
+            const std::shared_ptr<AssociatedEndpoints>& endpoints);
+
+    std::shared_ptr<AssociatedEndpoints> endpoints_;
+    eprosima::shared_mutex& mtx_;
+    std::vector<BaseWriter*>& associated_writers_;
+    std::unordered_map<EntityId_t, std::vector<BaseReader*>>& associated_readers_;
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
     //!Pointer to the RTPSParticipantImpl
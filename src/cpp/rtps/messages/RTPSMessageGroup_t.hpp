@@ -117,6 +117,9 @@ public:
 
     //! Mirror vector of buffers_ to store the serialized payloads.
     eprosima::fastdds::ResourceLimitedVector<eprosima::fastdds::rtps::SerializedPayload_t> payloads_;
+
+    //! Position of the buffer on the SendBuffersManager that created it.
+    uint32_t pool_index_ = std::numeric_limits<uint32_t>::max dummy_avoid_winmax ();
 };
 
 } // namespace rtps
@@ -19,20 +19,65 @@
 #include "SendBuffersManager.hpp"
 
 #include "RTPSMessageGroup.hpp"
-#include "../participant/RTPSParticipantImpl.hpp"
+#include <rtps/participant/RTPSParticipantImpl.hpp>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+constexpr uint32_t SendBuffersManager::NO_SLOT;
+constexpr size_t SendBuffersManager::NUM_BUCKETS;
+
+static size_t bucket_of(
+        uint32_t index,
+        uint64_t& offset)
+{
+    uint64_t position = static_cast<uint64_t>(index) + 1u;
+    size_t bucket = 0;
+    while (0u != (position >> (bucket + 1)))
+    {
+        ++bucket;
+    }
+    offset = position - (static_cast<uint64_t>(1u) << bucket);
+    return bucket;
+}
+
+static uint64_t next_tag(
+        uint64_t head)
+{
+    return ((head >> 32) + 1u) << 32;
+}
+
 SendBuffersManager::SendBuffersManager(
         size_t reserved_size,
         bool allow_growing,
         ResourceLimitedContainerConfig network_buffers_config)
-    : allow_growing_(allow_growing)
+    : reserved_size_(reserved_size)
+    , allow_growing_(allow_growing)
     , network_buffers_config_(network_buffers_config)
 {
-    pool_.reserve(reserved_size);
+    for (std::atomic<Slot*>& bucket : buckets_)
+    {
+        bucket.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SendBuffersManager::~SendBuffersManager()
+{
+    std::size_t n_free = 0;
+    std::unique_ptr<RTPSMessageGroup_t> buffer;
+    while (try_pop(buffer))
+    {
+        buffer.reset();
+        ++n_free;
+    }
+    assert(n_free == n_created_);
+    (void)n_free;
+
+    for (std::atomic<Slot*>& bucket : buckets_)
+    {
+        delete[] bucket.load(std::memory_order_relaxed);
+    }
 }
 
 void SendBuffersManager::init(
@@ -40,7 +85,7 @@ void SendBuffersManager::init(
 {
     std::lock_guard<TimedMutex> guard(mutex_);
 
-    if (n_created_ < pool_.capacity())
+    if (n_created_ < reserved_size_)
     {
         const GuidPrefix_t& guid_prefix = participant->getGuid().guidPrefix;
 
@@ -58,21 +103,23 @@ void SendBuffersManager::init(
 #else
         advance *= 2;
 #endif // if HAVE_SECURITY
-        size_t data_size = advance * (pool_.capacity() - n_created_);
+        size_t data_size = advance * (reserved_size_ - n_created_);
         common_buffer_.assign(data_size, 0);
+        allocated_bytes_ += data_size;
 
         octet* raw_buffer = common_buffer_.data();
-        while (n_created_ < pool_.capacity())
+        while (n_created_ < reserved_size_)
         {
-            pool_.emplace_back(new RTPSMessageGroup_t(
-                        raw_buffer,
+            RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
+                raw_buffer,
 #if HAVE_SECURITY
-                        secure,
+                secure,
 #endif // if HAVE_SECURITY
-                        payload_size, guid_prefix, network_buffers_config_
-                        ));
+                payload_size, guid_prefix, network_buffers_config_
+                );
+            add_to_pool(new_item);
+            push(new_item);
             raw_buffer += advance;
-            ++n_created_;
         }
     }
 }
@@ -81,6 +128,14 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
         const RTPSParticipantImpl* participant,
         const std::chrono::steady_clock::time_point& max_blocking_time)
 {
+    std::unique_ptr<RTPSMessageGroup_t> ret_val;
+
+    // Fast path: there is a free buffer on the stack.
+    if (try_pop(ret_val))
+    {
+        return ret_val;
+    }
+
 #if HAVE_STRICT_REALTIME
     std::unique_lock<TimedMutex> lock(mutex_, std::defer_lock);
     if (!lock.try_lock_until(max_blocking_time))
@@ -91,48 +146,145 @@ std::unique_ptr<RTPSMessageGroup_t> SendBuffersManager::get_buffer(
     std::unique_lock<TimedMutex> lock(mutex_);
 #endif // if HAVE_STRICT_REALTIME
 
-    std::unique_ptr<RTPSMessageGroup_t> ret_val;
-
-    while (pool_.empty())
+    bool has_waited = false;
+    while (!try_pop(ret_val))
     {
-        if (allow_growing_ || n_created_ < pool_.capacity())
+        if (allow_growing_ || n_created_ < reserved_size_)
         {
-            add_one_buffer(participant);
+            ret_val.reset(create_one_buffer(participant));
+            buffer_growths_.fetch_add(1u, std::memory_order_relaxed);
+            break;
         }
-        else
+
+        if (!has_waited)
         {
             EPROSIMA_LOG_INFO(RTPS_PARTICIPANT, "Waiting for send buffer");
-            if (std::cv_status::timeout == available_cv_.wait_until(lock, max_blocking_time))
-            {
-                throw RTPSMessageGroup::timeout();
-            }
+            buffer_waits_.fetch_add(1u, std::memory_order_relaxed);
+            has_waited = true;
         }
-    }
 
-    ret_val = std::move(pool_.back());
-    pool_.pop_back();
+        // Announce the wait before checking the stack again, so a buffer returned meanwhile either is popped here or
+        // its owner sees the waiter and notifies it.
+        waiters_.fetch_add(1u);
+        std::cv_status status = std::cv_status::no_timeout;
+        if (!try_pop(ret_val))
+        {
+            status = available_cv_.wait_until(lock, max_blocking_time);
+        }
+        waiters_.fetch_sub(1u);
+
+        if (ret_val)
+        {
+            break;
+        }
+
+        if (std::cv_status::timeout == status)
+        {
+            throw RTPSMessageGroup::timeout();
+        }
+    }
 
     return ret_val;
 }
 
 void SendBuffersManager::return_buffer(
         std::unique_ptr<RTPSMessageGroup_t>&& buffer)
+{
+    push(buffer.release());
+
+    if (0u < waiters_.load())
+    {
+        std::lock_guard<TimedMutex> guard(mutex_);
+        available_cv_.notify_one();
+    }
+}
+
+MemoryUsage SendBuffersManager::get_memory_usage()
 {
     std::lock_guard<TimedMutex> guard(mutex_);
-    pool_.push_back(std::move(buffer));
-    available_cv_.notify_one();
+    MemoryUsage usage;
+    usage.elements = n_created_;
+    usage.bytes = allocated_bytes_;
+    return usage;
+}
+
+SendBuffersManager::Slot& SendBuffersManager::slot(
+        uint32_t index) const
+{
+    uint64_t offset = 0;
+    size_t bucket = bucket_of(index, offset);
+    Slot* slots = buckets_[bucket].load(std::memory_order_acquire);
+    assert(nullptr != slots);
+    return slots[offset];
+}
+
+void SendBuffersManager::add_to_pool(
+        RTPSMessageGroup_t* buffer)
+{
+    assert(n_created_ < NO_SLOT);
+    uint32_t index = static_cast<uint32_t>(n_created_);
+    uint64_t offset = 0;
+    size_t bucket = bucket_of(index, offset);
+    if (nullptr == buckets_[bucket].load(std::memory_order_relaxed))
+    {
+        // Published before the index of any of its slots, so lock-free readers always find it allocated.
+        buckets_[bucket].store(new Slot[static_cast<size_t>(1u) << bucket], std::memory_order_release);
+    }
+
+    slot(index).buffer = buffer;
+    buffer->pool_index_ = index;
+    ++n_created_;
 }
 
-void SendBuffersManager::add_one_buffer(
+bool SendBuffersManager::try_pop(
+        std::unique_ptr<RTPSMessageGroup_t>& buffer)
+{
+    uint64_t head = free_head_.load();
+    while (NO_SLOT != static_cast<uint32_t>(head))
+    {
+        Slot& top = slot(static_cast<uint32_t>(head));
+        // The tag makes the exchange fail if top was popped and pushed again since head was read.
+        uint64_t new_head = next_tag(head) | top.next.load(std::memory_order_relaxed);
+        if (free_head_.compare_exchange_weak(head, new_head))
+        {
+            buffer.reset(top.buffer);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void SendBuffersManager::push(
+        RTPSMessageGroup_t* buffer)
+{
+    uint32_t index = buffer->pool_index_;
+    Slot& node = slot(index);
+    assert(node.buffer == buffer);
+
+    uint64_t head = free_head_.load();
+    do
+    {
+        node.next.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+    } while (!free_head_.compare_exchange_weak(head, next_tag(head) | index));
+}
+
+RTPSMessageGroup_t* SendBuffersManager::create_one_buffer(
         const RTPSParticipantImpl* participant)
 {
+    uint32_t payload_size = participant->getMaxMessageSize();
     RTPSMessageGroup_t* new_item = new RTPSMessageGroup_t(
 #if HAVE_SECURITY
         participant->is_secure(),
 #endif // if HAVE_SECURITY
-        participant->getMaxMessageSize(), participant->getGuid().guidPrefix);
-    pool_.emplace_back(new_item);
-    ++n_created_;
+        payload_size, participant->getGuid().guidPrefix);
+    add_to_pool(new_item);
+#if HAVE_SECURITY
+    allocated_bytes_ += static_cast<size_t>(payload_size) * (participant->is_secure() ? 3 : 2);
+#else
+    allocated_bytes_ += static_cast<size_t>(payload_size) * 2;
+#endif // if HAVE_SECURITY
+    return new_item;
 }
 
 } /* namespace rtps */
@@ -22,11 +22,15 @@
 
 #include "RTPSMessageGroup_t.hpp"
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/utils/TimedMutex.hpp>
 #include <fastdds/utils/TimedConditionVariable.hpp>
 
-#include <vector>              // std::vector
+#include <array>               // std::array
+#include <atomic>              // std::atomic
+#include <cstdint>             // uint32_t, uint64_t
 #include <memory>              // std::unique_ptr
+#include <vector>              // std::vector
 
 
 namespace eprosima {
@@ -37,6 +41,9 @@ class RTPSParticipantImpl;
 
 /**
  * Manages a pool of send buffers.
+ *
+ * Free buffers are kept on a lock-free stack, so getting and returning a buffer does not take the mutex as long as
+ * the pool has free buffers. The mutex is only taken to create new buffers and to wait for a buffer to be returned.
  * @ingroup WRITER_MODULE
  */
 class SendBuffersManager
@@ -55,10 +62,7 @@ public:
             bool allow_growing,
             ResourceLimitedContainerConfig network_buffers_config);
 
-    ~SendBuffersManager()
-    {
-        assert(pool_.size() == n_created_);
-    }
+    ~SendBuffersManager();
 
     /**
      * Initialization of pool.
@@ -85,23 +89,93 @@ public:
     void return_buffer(
             std::unique_ptr<RTPSMessageGroup_t>&& buffer);
 
+    /**
+     * Get the memory used by the buffers created by the pool.
+     * @return Number of buffers created, either in use or free, and the bytes reserved for their messages.
+     */
+    MemoryUsage get_memory_usage();
+
+    /**
+     * Get the number of times a thread had to wait for a buffer to be returned to the pool.
+     * @return Number of waits since the creation of the pool.
+     */
+    uint64_t get_buffer_waits() const
+    {
+        return buffer_waits_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Get the number of buffers created after the initialization of the pool.
+     * @return Number of buffers created on demand since the creation of the pool.
+     */
+    uint64_t get_buffer_growths() const
+    {
+        return buffer_growths_.load(std::memory_order_relaxed);
+    }
+
 private:
 
-    void add_one_buffer(
+    //! Position of a created buffer on the pool, also used as a node of the stack of free buffers.
+    struct Slot
+    {
+        //! The buffer, owned by the pool while it is on the stack of free buffers.
+        RTPSMessageGroup_t* buffer = nullptr;
+        //! Index of the next free buffer, only meaningful while the buffer is on the stack.
+        std::atomic<uint32_t> next{NO_SLOT};
+    };
+
+    //! Index marking the end of the stack of free buffers.
+    static constexpr uint32_t NO_SLOT = 0xFFFFFFFFu;
+
+    //! Number of buckets of slots. Bucket i holds 2^i slots, so they are enough for any 32 bits index.
+    static constexpr size_t NUM_BUCKETS = 32u;
+
+    Slot& slot(
+            uint32_t index) const;
+
+    /**
+     * Give the next free slot to a new buffer.
+     * Should be called with the mutex taken.
+     */
+    void add_to_pool(
+            RTPSMessageGroup_t* buffer);
+
+    //! Pop a buffer from the stack of free buffers without taking the mutex.
+    bool try_pop(
+            std::unique_ptr<RTPSMessageGroup_t>& buffer);
+
+    //! Push a buffer on the stack of free buffers without taking the mutex.
+    void push(
+            RTPSMessageGroup_t* buffer);
+
+    //! Create a buffer in use, without pushing it on the stack of free buffers. Should be called with the mutex taken.
+    RTPSMessageGroup_t* create_one_buffer(
             const RTPSParticipantImpl* participant);
 
-    //!Protects all data
+    //!Protects the creation of buffers and the waits for free ones
     TimedMutex mutex_;
-    //!Send buffers pool
-    std::vector<std::unique_ptr<RTPSMessageGroup_t>> pool_;
+    //!Slots of the created buffers, allocated on demand. Never moved nor released until destruction.
+    std::array<std::atomic<Slot*>, NUM_BUCKETS> buckets_;
+    //!Top of the stack of free buffers: a modification tag on the upper 32 bits to avoid ABA, and a slot index.
+    std::atomic<uint64_t> free_head_{NO_SLOT};
+    //!Number of threads waiting on available_cv_
+    std::atomic<uint32_t> waiters_{0u};
+    //!Number of buffers created on init()
+    std::size_t reserved_size_ = 0;
     //!Raw buffer shared by the buffers created inside init()
     std::vector<octet> common_buffer_;
     //!Creation counter
     std::size_t n_created_ = 0;
-    //!Whether we allow n_created_ to grow beyond the pool_ capacity.
+    //!Bytes reserved for the messages of the created buffers
+    std::size_t allocated_bytes_ = 0;
+    //!Whether we allow n_created_ to grow beyond reserved_size_.
     bool allow_growing_ = true;
     //!To wait for a buffer to be returned to the pool.
     TimedConditionVariable available_cv_;
+    //!Number of times a thread had to wait for a free buffer
+    std::atomic<uint64_t> buffer_waits_{0u};
+    //!Number of buffers created on demand
+    std::atomic<uint64_t> buffer_growths_{0u};
     //!Configuration for the network buffers.
     ResourceLimitedContainerConfig network_buffers_config_ = ResourceLimitedContainerConfig(16u,
                     std::numeric_limits<size_t>::max dummy_avoid_winmax (), 16u);
@@ -0,0 +1,320 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_RTPS_NETWORK__RECEIVEPROCESSINGPOOL_HPP
+#define FASTDDS_RTPS_NETWORK__RECEIVEPROCESSINGPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/CDRMessage_t.hpp>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/Locator.hpp>
+#include <fastdds/rtps/common/Types.hpp>
+
+#include <utils/collections/CircularVector.hpp>
+#include <utils/thread.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/*!
+ * Pool of threads processing the messages received by the transport channels of a participant.
+ *
+ * The channel threads copy each received message into a buffer of the pool and go back to read the next one, so a
+ * slow processing of the message (i.e. user listeners) does not keep them from reading the socket.
+ * Messages are distributed among the threads by the GUID prefix on their RTPS header, so the messages of a remote
+ * participant are processed in the order they were received.
+ */
+class ReceiveProcessingPool
+{
+public:
+
+    //! Destination of the messages processed by the pool.
+    class Processor
+    {
+    public:
+
+        virtual ~Processor() = default;
+
+        /*!
+         * Processes a message from a thread of the pool.
+         *
+         * @param msg Message to process. Its buffer is only valid during the call.
+         * @param local_locator Locator identifying the local endpoint.
+         * @param remote_locator Locator identifying the remote endpoint.
+         * @param thread_index Index of the thread processing the message, lower than @c num_threads.
+         * Messages of the same thread are never processed concurrently.
+         */
+        virtual void process_queued_message(
+                CDRMessage_t& msg,
+                const Locator_t& local_locator,
+                const Locator_t& remote_locator,
+                uint32_t thread_index) = 0;
+    };
+
+    /*!
+     * Constructor. Starts the processing threads.
+     *
+     * @param num_threads Number of processing threads.
+     * @param max_queued_messages Maximum number of messages waiting to be processed.
+     * Buffers for them are allocated on demand and reused afterwards.
+     * @param thread_settings Settings applied to the processing threads.
+     * @param participant_id Identifier of the participant, used to name the processing threads.
+     */
+    ReceiveProcessingPool(
+            uint32_t num_threads,
+            uint32_t max_queued_messages,
+            const ThreadSettings& thread_settings,
+            uint32_t participant_id)
+        : max_queued_messages_(max_queued_messages)
+    {
+        free_buffers_.reserve(max_queued_messages);
+        shards_.reserve(num_threads);
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            shards_.emplace_back(new Shard());
+            shards_.back()->index = i;
+            shards_.back()->jobs.reserve(max_queued_messages);
+        }
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            Shard* shard = shards_[i].get();
+            shard->thread = create_thread([this, shard]()
+                            {
+                                run(*shard);
+                            }, thread_settings, "dds.rcv.%u.%u", participant_id, i);
+        }
+    }
+
+    //! Destructor. Stops the processing threads after processing the pending messages.
+    ~ReceiveProcessingPool()
+    {
+        for (std::unique_ptr<Shard>& shard : shards_)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard->mtx);
+                shard->running = false;
+            }
+            shard->cv.notify_one();
+        }
+
+        for (std::unique_ptr<Shard>& shard : shards_)
+        {
+            shard->thread.join();
+        }
+    }
+
+    /*!
+     * Copies a received message and queues it to be processed.
+     *
+     * @param processor Destination of the message. It should not be destroyed until the message has been processed.
+     * @param data Pointer to the received data.
+     * @param size Number of bytes received.
+     * @param local_locator Locator identifying the local endpoint.
+     * @param remote_locator Locator identifying the remote endpoint.
+     * @return true when the message has been queued.
+     * false when the message has been dropped because @c max_queued_messages were waiting to be processed.
+     * A warning is logged when messages start being dropped.
+     */
+    bool enqueue(
+            Processor* processor,
+            const octet* data,
+            uint32_t size,
+            const Locator_t& local_locator,
+            const Locator_t& remote_locator)
+    {
+        Job job;
+        bool first_drop = false;
+        if (!take_buffer(job.buffer, first_drop))
+        {
+            uint64_t dropped = dropped_messages_.fetch_add(1u, std::memory_order_relaxed) + 1u;
+            if (first_drop)
+            {
+                EPROSIMA_LOG_WARNING(RTPS_MSG_IN, "Receive processing queue full with " << max_queued_messages_
+                        << " messages, dropping received messages (" << dropped << " dropped so far)");
+            }
+            static_cast<void>(dropped); // Might be unused if log is disabled
+            return false;
+        }
+
+        job.buffer.resize(size);
+        memcpy(job.buffer.data(), data, size);
+        job.processor = processor;
+        job.local_locator = local_locator;
+        job.remote_locator = remote_locator;
+
+        Shard& shard = *shards_[shard_index(data, size)];
+        {
+            std::lock_guard<std::mutex> lock(shard.mtx);
+            shard.jobs.push_back(std::move(job));
+        }
+        shard.cv.notify_one();
+        return true;
+    }
+
+    //! Number of messages dropped because the queue was full.
+    uint64_t dropped_messages() const
+    {
+        return dropped_messages_.load(std::memory_order_relaxed);
+    }
+
+    //! Number of processing threads.
+    uint32_t num_threads() const
+    {
+        return static_cast<uint32_t>(shards_.size());
+    }
+
+private:
+
+    struct Job
+    {
+        Processor* processor = nullptr;
+        std::vector<octet> buffer;
+        Locator_t local_locator;
+        Locator_t remote_locator;
+    };
+
+    struct Shard
+    {
+        std::mutex mtx;
+
+        std::condition_variable cv;
+
+        //! Messages waiting to be processed by the thread of this shard, in reception order.
+        CircularVector<Job> jobs;
+
+        bool running = true;
+
+        uint32_t index = 0;
+
+        eprosima::thread thread;
+    };
+
+    size_t shard_index(
+            const octet* data,
+            uint32_t size) const
+    {
+        if (size < RTPSMESSAGE_HEADER_SIZE)
+        {
+            return 0;
+        }
+
+        // FNV-1a over the GUID prefix, which follows the protocol id, version and vendor id on the header.
+        uint32_t hash = 2166136261u;
+        for (uint32_t i = RTPSMESSAGE_HEADER_SIZE - GuidPrefix_t::size; i < RTPSMESSAGE_HEADER_SIZE; ++i)
+        {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash % shards_.size();
+    }
+
+    bool take_buffer(
+            std::vector<octet>& buffer,
+            bool& first_drop)
+    {
+        std::lock_guard<std::mutex> lock(buffers_mtx_);
+        if (!free_buffers_.empty())
+        {
+            buffer = std::move(free_buffers_.back());
+            free_buffers_.pop_back();
+            dropping_ = false;
+            return true;
+        }
+        if (allocated_buffers_ < max_queued_messages_)
+        {
+            ++allocated_buffers_;
+            dropping_ = false;
+            return true;
+        }
+        first_drop = !dropping_;
+        dropping_ = true;
+        return false;
+    }
+
+    void return_buffer(
+            std::vector<octet>&& buffer)
+    {
+        std::lock_guard<std::mutex> lock(buffers_mtx_);
+        free_buffers_.push_back(std::move(buffer));
+    }
+
+    //! Function run by each processing thread.
+    void run(
+            Shard& shard)
+    {
+        std::unique_lock<std::mutex> lock(shard.mtx);
+
+        while (true)
+        {
+            shard.cv.wait(lock, [&shard]()
+                    {
+                        return !shard.running || !shard.jobs.empty();
+                    });
+
+            if (shard.jobs.empty())
+            {
+                break;
+            }
+
+            Job job = std::move(shard.jobs.front());
+            shard.jobs.pop_front();
+            lock.unlock();
+
+            CDRMessage_t msg(0);
+            msg.wraps = true;
+            msg.buffer = job.buffer.data();
+            msg.length = static_cast<uint32_t>(job.buffer.size());
+            msg.max_size = msg.length;
+            msg.reserved_size = msg.length;
+            job.processor->process_queued_message(msg, job.local_locator, job.remote_locator, shard.index);
+            return_buffer(std::move(job.buffer));
+
+            lock.lock();
+        }
+    }
+
+    const uint32_t max_queued_messages_;
+
+    std::mutex buffers_mtx_;
+
+    //! Buffers of processed messages, kept to be reused. Protected by buffers_mtx_.
+    std::vector<std::vector<octet>> free_buffers_;
+
+    //! Number of buffers allocated by the pool. Protected by buffers_mtx_.
+    uint32_t allocated_buffers_ = 0;
+
+    //! Whether the last message was dropped, to only log the first one of a row. Protected by buffers_mtx_.
+    bool dropping_ = false;
+
+    std::atomic<uint64_t> dropped_messages_{0};
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_RTPS_NETWORK__RECEIVEPROCESSINGPOOL_HPP
@@ -74,6 +74,11 @@ ReceiverResource::ReceiverResource(
     max_message_size_ = rValueResource.max_message_size_;
     active_callbacks_ = rValueResource.active_callbacks_;
     rValueResource.active_callbacks_ = 0;
+    processing_pool_ = rValueResource.processing_pool_;
+    rValueResource.processing_pool_ = nullptr;
+    pool_receivers_ = std::move(rValueResource.pool_receivers_);
+    processing_messages_ = rValueResource.processing_messages_;
+    rValueResource.processing_messages_ = 0;
 }
 
 bool ReceiverResource::SupportsLocator(
@@ -100,7 +105,12 @@ void ReceiverResource::RegisterReceiver(
 void ReceiverResource::UnregisterReceiver(
         MessageReceiver* rcv)
 {
-    std::lock_guard<std::mutex> _(mtx);
+    // Wait for the queued messages being processed, as the pool receivers are used without holding mtx.
+    std::unique_lock<std::mutex> lock(mtx);
+    cv_.wait(lock, [this]
+            {
+                return 0 == processing_messages_;
+            });
 
     if (receiver == rcv)
     {
@@ -122,6 +132,16 @@ void ReceiverResource::OnDataReceived(
 
     if (rcv != nullptr && active_callbacks_ >= 0)
     {
+        if (nullptr != processing_pool_)
+        {
+            if (processing_pool_->enqueue(this, data, size, localLocator, remoteLocator))
+            {
+                // Released when the message is processed.
+                ++active_callbacks_;
+            }
+            return;
+        }
+
         ++active_callbacks_;
 
         CDRMessage_t msg(0);
@@ -137,11 +157,56 @@ void ReceiverResource::OnDataReceived(
         // allow disabling
         if (--active_callbacks_ == 0)
         {
-            cv_.notify_one();
+            cv_.notify_all();
         }
     }
 }
 
+void ReceiverResource::process_queued_message(
+        CDRMessage_t& msg,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator,
+        uint32_t thread_index)
+{
+    MessageReceiver* rcv = nullptr;
+    {
+        std::lock_guard<std::mutex> _(mtx);
+        if (receiver != nullptr)
+        {
+            assert(thread_index < pool_receivers_.size());
+            rcv = pool_receivers_[thread_index].get();
+            ++processing_messages_;
+        }
+    }
+
+    // mtx is not held during the processing, so the transport thread can keep queueing messages and the other threads
+    // of the pool can process the messages of this resource with their own receivers.
+    if (rcv != nullptr)
+    {
+        rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+    }
+
+    std::lock_guard<std::mutex> _(mtx);
+    bool notify = (--active_callbacks_ == 0);
+    if (rcv != nullptr)
+    {
+        notify |= (--processing_messages_ == 0);
+    }
+    if (notify)
+    {
+        cv_.notify_all();
+    }
+}
+
+void ReceiverResource::set_processing_pool(
+        ReceiveProcessingPool* pool,
+        std::vector<std::unique_ptr<MessageReceiver>>&& pool_receivers)
+{
+    std::lock_guard<std::mutex> _(mtx);
+    processing_pool_ = pool;
+    pool_receivers_ = std::move(pool_receivers);
+}
+
 void ReceiverResource::disable()
 {
     if (Cleanup)
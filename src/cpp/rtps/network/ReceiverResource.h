@@ -23,6 +23,7 @@
 #include <fastdds/rtps/transport/TransportInterface.hpp>
 
 #include <rtps/messages/MessageReceiver.h>
+#include <rtps/network/ReceiveProcessingPool.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -35,7 +36,7 @@ namespace rtps {
  * closes it.
  * @ingroup NETWORK_MODULE
  */
-class ReceiverResource : public fastdds::rtps::TransportReceiverInterface
+class ReceiverResource : public fastdds::rtps::TransportReceiverInterface, public ReceiveProcessingPool::Processor
 {
     //! Only NetworkFactory is ever allowed to construct a ReceiverResource from scratch.
     //! In doing so, it guarantees the transport and channel are in a valid state for
@@ -57,6 +58,30 @@ public:
             const Locator_t& localLocator,
             const Locator_t& remoteLocator) override;
 
+    /**
+     * Method called by the processing pool with a message queued by OnDataReceived.
+     * @param msg Message to process.
+     * @param localLocator Locator identifying the local endpoint.
+     * @param remoteLocator Locator identifying the remote endpoint.
+     * @param thread_index Index of the pool thread processing the message.
+     */
+    void process_queued_message(
+            CDRMessage_t& msg,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator,
+            uint32_t thread_index) override;
+
+    /**
+     * Sets the pool of threads processing the received messages.
+     * When set, OnDataReceived only queues the message, so the transport can go back to read the next one.
+     * @param pool Pointer to the processing pool. nullptr to process the messages on the transport thread.
+     * @param pool_receivers One receiver per thread of the pool, sharing the endpoints of the registered receiver,
+     * so the threads process the messages of this resource concurrently.
+     */
+    void set_processing_pool(
+            ReceiveProcessingPool* pool,
+            std::vector<std::unique_ptr<MessageReceiver>>&& pool_receivers);
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
@@ -118,6 +143,12 @@ private:
     MessageReceiver* receiver;
     uint32_t max_message_size_;
     int active_callbacks_;
+
+    ReceiveProcessingPool* processing_pool_ = nullptr;
+    //! Receivers used by each thread of the processing pool, as a MessageReceiver keeps the state of its message.
+    std::vector<std::unique_ptr<MessageReceiver>> pool_receivers_;
+    //! Number of queued messages being processed by the pool without holding mtx.
+    uint32_t processing_messages_ = 0;
 };
 
 } // namespace rtps
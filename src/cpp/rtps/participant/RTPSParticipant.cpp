@@ -240,6 +240,12 @@ bool RTPSParticipant::get_subscription_info(
     return mp_impl->get_subscription_info(data, reader_guid);
 }
 
+void RTPSParticipant::get_memory_usage(
+        ParticipantMemoryUsage& usage) const
+{
+    mp_impl->get_memory_usage(usage);
+}
+
 #if HAVE_SECURITY
 
 bool RTPSParticipant::is_security_enabled_for_writer(
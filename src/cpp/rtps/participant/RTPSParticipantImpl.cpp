@@ -320,6 +320,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     setup_timed_events();
+    setup_receive_processing();
 
 #if HAVE_SECURITY
     // Start security
@@ -593,6 +594,76 @@ void RTPSParticipantImpl::setup_timed_events()
     uint32_t id_for_thread = static_cast<uint32_t>(m_att.participantID);
     const ThreadSettings& thr_config = m_att.timed_events_thread;
     mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
+
+#ifdef FASTDDS_STATISTICS
+    const std::string* period_property =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.statistics.counters_publication_period");
+    if (nullptr != period_property)
+    {
+        unsigned long period_ms = 0;
+        try
+        {
+            period_ms = std::stoul(*period_property);
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Error parsing counters_publication_period property: " << e.what());
+        }
+
+        if (0 < period_ms)
+        {
+            // Writers only update their counters, and this event reports them all at once
+            statistics_counters_event_.reset(new TimedEvent(mp_event_thr, [this]() -> bool
+                    {
+                        shared_lock<shared_mutex> _(endpoints_list_mutex);
+                        for (auto writer : m_userWriterList)
+                        {
+                            writer->publish_statistics_counters();
+                        }
+                        return true;
+                    }, static_cast<double>(period_ms)));
+            statistics_counters_event_->restart_timer();
+        }
+    }
+#endif // FASTDDS_STATISTICS
+}
+
+void RTPSParticipantImpl::setup_receive_processing()
+{
+    const std::string* threads_property =
+            PropertyPolicyHelper::find_property(m_att.properties, "fastdds.receive_processing.threads");
+    if (nullptr == threads_property)
+    {
+        return;
+    }
+
+    unsigned long num_threads = 0;
+    unsigned long max_queued_messages = 256;
+    try
+    {
+        num_threads = std::stoul(*threads_property);
+
+        const std::string* max_queued_property = PropertyPolicyHelper::find_property(m_att.properties,
+                        "fastdds.receive_processing.max_queued_messages");
+        if (nullptr != max_queued_property)
+        {
+            max_queued_messages = std::stoul(*max_queued_property);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT, "Error parsing receive_processing properties: " << e.what());
+        return;
+    }
+
+    if (0 < num_threads && 0 < max_queued_messages)
+    {
+        // Transport threads will only queue the received messages, which will be processed by these threads.
+        receive_processing_pool_.reset(new ReceiveProcessingPool(static_cast<uint32_t>(num_threads),
+                static_cast<uint32_t>(max_queued_messages), m_att.builtin_transports_reception_threads,
+                static_cast<uint32_t>(m_att.participantID)));
+    }
 }
 
 void RTPSParticipantImpl::setup_meta_traffic()
@@ -800,6 +871,10 @@ void RTPSParticipantImpl::enable()
 
 void RTPSParticipantImpl::disable()
 {
+#ifdef FASTDDS_STATISTICS
+    statistics_counters_event_.reset();
+#endif // FASTDDS_STATISTICS
+
     // Disabling event thread also disables participant announcement, so there is no need to call
     // stopRTPSParticipantAnnouncement()
     mp_event_thr.stop_thread();
@@ -1071,6 +1146,7 @@ bool RTPSParticipantImpl::create_writer(
                 });
 
         SWriter->set_enabled_statistics_writers_mask(StatisticsParticipantImpl::get_enabled_statistics_writers_mask());
+        SWriter->set_statistics_counters_aggregation(nullptr != statistics_counters_event_);
     }
 
 #endif // FASTDDS_STATISTICS
@@ -2050,6 +2126,17 @@ bool RTPSParticipantImpl::createReceiverResources(
             //Create and init the MessageReceiver
             auto mr = new MessageReceiver(this, (*it_buffer)->max_message_size());
             m_receiverResourcelist.back().mp_receiver = mr;
+            if (receive_processing_pool_)
+            {
+                // Each thread of the pool processes the messages with its own receiver, sharing the endpoints of mr
+                std::vector<std::unique_ptr<MessageReceiver>> pool_receivers;
+                for (uint32_t i = 0; i < receive_processing_pool_->num_threads(); ++i)
+                {
+                    pool_receivers.emplace_back(new MessageReceiver(this, (*it_buffer)->max_message_size(), *mr));
+                }
+                m_receiverResourcelist.back().Receiver->set_processing_pool(receive_processing_pool_.get(),
+                        std::move(pool_receivers));
+            }
             //Start reception
             if (RegisterReceiver)
             {
@@ -2610,10 +2697,10 @@ IPersistenceService* RTPSParticipantImpl::get_persistence_service(
 {
     IPersistenceService* ret_val;
 
-    ret_val = PersistenceFactory::create_persistence_service(param.properties);
+    ret_val = PersistenceFactory::create_persistence_service(param.properties, m_att.persistence_thread);
     return ret_val != nullptr ?
            ret_val :
-           PersistenceFactory::create_persistence_service(m_att.properties);
+           PersistenceFactory::create_persistence_service(m_att.properties, m_att.persistence_thread);
 }
 
 bool RTPSParticipantImpl::get_persistence_service(
@@ -3027,6 +3114,17 @@ bool RTPSParticipantImpl::get_subscription_info(
     return ret;
 }
 
+void RTPSParticipantImpl::get_memory_usage(
+        ParticipantMemoryUsage& usage) const
+{
+    usage = ParticipantMemoryUsage();
+    usage.send_buffers = send_buffers_->get_memory_usage();
+    if (nullptr != mp_builtinProtocols && nullptr != mp_builtinProtocols->mp_PDP)
+    {
+        mp_builtinProtocols->mp_PDP->get_memory_usage(usage);
+    }
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool RTPSParticipantImpl::register_in_writer(
@@ -61,6 +61,7 @@
 #include <rtps/network/ReceiverResource.h>
 #include <rtps/reader/LocalReaderPointer.hpp>
 #include <rtps/resources/ResourceEvent.h>
+#include <rtps/resources/TimedEvent.h>
 #include <statistics/rtps/monitor-service/interfaces/IConnectionsObserver.hpp>
 #include <statistics/rtps/monitor-service/interfaces/IConnectionsQueryable.hpp>
 #include <statistics/rtps/StatisticsBase.hpp>
@@ -669,6 +670,9 @@ protected:
     security::SecurityManager m_security_manager;
 #endif // if HAVE_SECURITY
 
+    //! Pool processing the received messages, when enabled with the fastdds.receive_processing.threads property.
+    //! Declared before the receiver resources, as they use it until they are disabled.
+    std::unique_ptr<ReceiveProcessingPool> receive_processing_pool_;
     //! Encapsulates all associated resources on a Receiving element.
     std::list<ReceiverControlBlock> m_receiverResourcelist;
     //! Receiver resource list needs its own mutext to avoid a race condition.
@@ -706,6 +710,8 @@ protected:
     std::unique_ptr<fastdds::statistics::rtps::MonitorService> monitor_server_;
     std::unique_ptr<fastdds::statistics::rtps::SimpleQueryable> simple_queryable_;
     std::atomic<const fastdds::statistics::rtps::IConnectionsObserver*> conns_observer_;
+    //! Periodically reports the statistics counters of the user writers. Only created when aggregation is enabled.
+    std::unique_ptr<TimedEvent> statistics_counters_event_;
 #endif // ifdef FASTDDS_STATISTICS
 
     /*
@@ -728,6 +734,7 @@ private:
             const GuidPrefix_t& persistence_guid);
     bool setup_transports();
     void setup_timed_events();
+    void setup_receive_processing();
     void setup_meta_traffic();
     void setup_user_traffic();
     void setup_initial_peers();
@@ -1298,6 +1305,14 @@ public:
             SubscriptionBuiltinTopicData& data,
             const GUID_t& reader_guid) const;
 
+    /**
+     * @brief Fills the memory used by the send buffers and the discovery database of this participant.
+     *
+     * @param[out] usage Structure to fill.
+     */
+    void get_memory_usage(
+            ParticipantMemoryUsage& usage) const;
+
     template<EndpointKind_t kind, octet no_key, octet with_key>
     static bool preprocess_endpoint_attributes(
             const EntityId_t& entity_id,
@@ -0,0 +1,1022 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogFilePersistenceService.cpp
+ *
+ */
+
+#include <rtps/persistence/LogFilePersistenceService.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif // ifdef _WIN32
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/history/WriterHistory.hpp>
+
+#include <utils/thread.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+namespace {
+
+//! Value at the beginning of every record, used to detect a corrupted log.
+constexpr uint32_t record_magic = 0x4C504446;
+
+//! Kinds of records stored on the log.
+enum RecordKind : uint32_t
+{
+    //! Change added to a writer history.
+    WRITER_ADD_RECORD = 1,
+    //! Change removed from a writer history.
+    WRITER_REMOVE_RECORD = 2,
+    //! Last sequence number of a writer, only written on compaction.
+    WRITER_STATE_RECORD = 3,
+    //! Sequence number of a writer on a reader.
+    READER_SEQ_RECORD = 4
+};
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t kind;
+    //! Length of the record body, following the header.
+    uint32_t length;
+};
+
+//! Minimum number of removed records on the log before it is compacted.
+constexpr uint64_t min_dead_records_to_compact = 1024;
+
+//! Records bigger than this are not fully read when scanning the log.
+constexpr uint32_t max_scan_read_length = 65536;
+
+//! Size of the blocks used to copy the records appended to the log while it is being compacted.
+constexpr size_t copy_block_length = 65536;
+
+int seek_file(
+        FILE* file,
+        uint64_t offset)
+{
+#ifdef _WIN32
+    return _fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#else
+    return fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif // ifdef _WIN32
+}
+
+uint64_t file_size(
+        FILE* file)
+{
+#ifdef _WIN32
+    _fseeki64(file, 0, SEEK_END);
+    return static_cast<uint64_t>(_ftelli64(file));
+#else
+    fseeko(file, 0, SEEK_END);
+    return static_cast<uint64_t>(ftello(file));
+#endif // ifdef _WIN32
+}
+
+int truncate_file(
+        FILE* file,
+        uint64_t size)
+{
+#ifdef _WIN32
+    return _chsize_s(_fileno(file), static_cast<__int64>(size));
+#else
+    return ftruncate(fileno(file), static_cast<off_t>(size));
+#endif // ifdef _WIN32
+}
+
+template<typename T>
+void append_value(
+        std::vector<octet>& buffer,
+        const T& value)
+{
+    const octet* ptr = reinterpret_cast<const octet*>(&value);
+    buffer.insert(buffer.end(), ptr, ptr + sizeof(T));
+}
+
+void append_guid(
+        std::vector<octet>& buffer,
+        const GUID_t& guid)
+{
+    buffer.insert(buffer.end(), guid.guidPrefix.value, guid.guidPrefix.value + GuidPrefix_t::size);
+    buffer.insert(buffer.end(), guid.entityId.value, guid.entityId.value + EntityId_t::size);
+}
+
+void append_string(
+        std::vector<octet>& buffer,
+        const std::string& value)
+{
+    append_value(buffer, static_cast<uint16_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+/**
+ * Helper to read the fields of a record body.
+ * Every read fails once the end of the body has been reached.
+ */
+class BodyReader
+{
+public:
+
+    BodyReader(
+            const octet* data,
+            size_t length)
+        : data_(data)
+        , length_(length)
+    {
+    }
+
+    template<typename T>
+    bool read(
+            T& value)
+    {
+        return read_raw(&value, sizeof(T));
+    }
+
+    bool read(
+            GUID_t& guid)
+    {
+        return read_raw(guid.guidPrefix.value, GuidPrefix_t::size) && read_raw(guid.entityId.value, EntityId_t::size);
+    }
+
+    bool read(
+            std::string& value)
+    {
+        uint16_t size = 0;
+        if (read(size) && (pos_ + size <= length_))
+        {
+            value.assign(reinterpret_cast<const char*>(data_ + pos_), size);
+            pos_ += size;
+            return true;
+        }
+        return false;
+    }
+
+    bool read_raw(
+            void* dest,
+            size_t size)
+    {
+        if (pos_ + size <= length_)
+        {
+            memcpy(dest, data_ + pos_, size);
+            pos_ += size;
+            return true;
+        }
+        return false;
+    }
+
+
+private:
+
+    const octet* data_;
+    size_t length_;
+    size_t pos_ = 0;
+};
+
+} // namespace
+
+/**
+ * Append-only log shared by all the persistence services created on the same file.
+ *
+ * The log is compacted from a background thread, which only blocks the operations on the log while it copies the
+ * records appended since the compaction started.
+ */
+class PersistenceLogFile
+{
+public:
+
+    static std::shared_ptr<PersistenceLogFile> get(
+            const std::string& filename,
+            const ThreadSettings& thread_settings)
+    {
+        static std::mutex registry_mutex;
+        static std::map<std::string, std::weak_ptr<PersistenceLogFile>> registry;
+
+        std::lock_guard<std::mutex> guard(registry_mutex);
+        std::shared_ptr<PersistenceLogFile> ret_val = registry[filename].lock();
+        if (!ret_val)
+        {
+            ret_val = std::make_shared<PersistenceLogFile>(filename);
+            if (!ret_val->open(thread_settings))
+            {
+                ret_val.reset();
+            }
+            registry[filename] = ret_val;
+        }
+        return ret_val;
+    }
+
+    explicit PersistenceLogFile(
+            const std::string& filename)
+        : filename_(filename)
+    {
+    }
+
+    ~PersistenceLogFile()
+    {
+        if (compaction_thread_.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                running_ = false;
+            }
+            compaction_cond_.notify_one();
+            compaction_thread_.join();
+        }
+
+        if (nullptr != file_)
+        {
+            fclose(file_);
+        }
+    }
+
+    bool load_writer(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            SequenceNumber_t& next_sequence)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto writer_it = writers_.find(persistence_guid);
+        if (writers_.end() == writer_it)
+        {
+            return true;
+        }
+        if (nullptr == file_)
+        {
+            return false;
+        }
+
+        std::vector<CacheChange_t*>& changes = IPersistenceService::get_changes(history);
+        fflush(file_);
+
+        for (const auto& entry : writer_it->second.changes)
+        {
+            RecordHeader header;
+            if ((0 != seek_file(file_, entry.second)) || (1 != fread(&header, sizeof(header), 1, file_)))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Error reading change " << entry.first << " of writer "
+                                                                             << persistence_guid);
+                continue;
+            }
+
+            // Read everything but the payload, which is read directly into the change
+            size_t fixed_length = sizeof(uint16_t) + persistence_guid.size() + sizeof(int64_t) + 16 +
+                    (GuidPrefix_t::size + EntityId_t::size) + 2 * sizeof(int64_t) + sizeof(uint32_t);
+            buffer_.resize(fixed_length);
+            if ((header.length < fixed_length) || (1 != fread(buffer_.data(), fixed_length, 1, file_)))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Error reading change " << entry.first << " of writer "
+                                                                             << persistence_guid);
+                continue;
+            }
+
+            BodyReader reader(buffer_.data(), buffer_.size());
+            std::string guid;
+            int64_t sn = 0;
+            InstanceHandle_t instance;
+            GUID_t related_guid;
+            int64_t related_sn = 0;
+            int64_t timestamp = 0;
+            uint32_t payload_length = 0;
+            reader.read(guid);
+            reader.read(sn);
+            reader.read_raw(instance.value, 16);
+            reader.read(related_guid);
+            reader.read(related_sn);
+            reader.read(timestamp);
+            reader.read(payload_length);
+
+            CacheChange_t* change = history->create_change(payload_length, ALIVE);
+            if (nullptr == change)
+            {
+                continue;
+            }
+
+            if ((0 < payload_length) && (1 != fread(change->serializedPayload.data, payload_length, 1, file_)))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Error reading payload of change " << entry.first
+                                                                                        << " of writer "
+                                                                                        << persistence_guid);
+                history->release_change(change);
+                continue;
+            }
+
+            change->kind = ALIVE;
+            change->writerGUID = writer_guid;
+            change->instanceHandle = instance;
+            change->sequenceNumber = SequenceNumber_t(static_cast<uint64_t>(sn));
+            change->serializedPayload.length = payload_length;
+            change->writer_info.previous = nullptr;
+            change->writer_info.next = nullptr;
+            change->writer_info.num_sent_submessages = 0;
+            change->vendor_id = c_VendorId_eProsima;
+            auto& si = change->write_params.related_sample_identity();
+            si.writer_guid(related_guid);
+            si.sequence_number(SequenceNumber_t(static_cast<uint64_t>(related_sn)));
+            change->sourceTimestamp.from_ns(timestamp);
+
+            IPersistenceService::set_fragments(history, change);
+
+            changes.push_back(change);
+        }
+
+        next_sequence = SequenceNumber_t(static_cast<uint64_t>(writer_it->second.last_sequence_number));
+        return true;
+    }
+
+    bool add_writer_change(
+            const std::string& persistence_guid,
+            const CacheChange_t& change)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        WriterIndex& writer = writers_[persistence_guid];
+        int64_t sn = change.sequenceNumber.to64long();
+        if (writer.changes.end() != writer.changes.find(sn))
+        {
+            return false;
+        }
+
+        const auto& si = change.write_params.related_sample_identity();
+        buffer_.clear();
+        append_string(buffer_, persistence_guid);
+        append_value(buffer_, sn);
+        const octet* instance = change.instanceHandle.value;
+        buffer_.insert(buffer_.end(), instance, instance + 16);
+        append_guid(buffer_, si.writer_guid());
+        append_value(buffer_, si.sequence_number().to64long());
+        append_value(buffer_, change.sourceTimestamp.to_ns());
+        append_value(buffer_, change.serializedPayload.length);
+
+        uint64_t offset = 0;
+        if (!append_record(WRITER_ADD_RECORD, change.serializedPayload.data, change.serializedPayload.length,
+                offset))
+        {
+            return false;
+        }
+
+        // Only a change stored in the log advances the sequence number recovered on load.
+        writer.last_sequence_number = sn;
+        writer.changes.emplace(sn, offset);
+        ++live_records_;
+        return true;
+    }
+
+    bool remove_writer_change(
+            const std::string& persistence_guid,
+            const SequenceNumber_t& sequence_number)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto writer_it = writers_.find(persistence_guid);
+        int64_t sn = sequence_number.to64long();
+        if ((writers_.end() == writer_it) || (0 == writer_it->second.changes.count(sn)))
+        {
+            // Nothing to remove
+            return true;
+        }
+
+        buffer_.clear();
+        append_string(buffer_, persistence_guid);
+        append_value(buffer_, sn);
+
+        uint64_t offset = 0;
+        if (!append_record(WRITER_REMOVE_RECORD, nullptr, 0, offset))
+        {
+            return false;
+        }
+
+        writer_it->second.changes.erase(sn);
+        --live_records_;
+        dead_records_ += 2;
+        compact_if_needed();
+        return true;
+    }
+
+    bool load_reader(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t>& seq_map)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        auto reader_it = readers_.find(reader_guid);
+        if (readers_.end() != reader_it)
+        {
+            for (const auto& entry : reader_it->second)
+            {
+                seq_map[entry.first] = entry.second;
+            }
+        }
+
+        return true;
+    }
+
+    bool update_reader(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        buffer_.clear();
+        append_string(buffer_, reader_guid);
+        append_guid(buffer_, writer_guid);
+        append_value(buffer_, seq_number.to64long());
+
+        uint64_t offset = 0;
+        if (!append_record(READER_SEQ_RECORD, nullptr, 0, offset))
+        {
+            return false;
+        }
+
+        if (readers_[reader_guid].emplace(writer_guid, seq_number).second)
+        {
+            ++live_records_;
+        }
+        else
+        {
+            readers_[reader_guid][writer_guid] = seq_number;
+            ++dead_records_;
+            compact_if_needed();
+        }
+        return true;
+    }
+
+    bool open(
+            const ThreadSettings& thread_settings)
+    {
+        // Create the log if it does not exist, without truncating it. It is then opened to write at any position.
+        FILE* created = fopen(filename_.c_str(), "ab");
+        if (nullptr != created)
+        {
+            fclose(created);
+        }
+        file_ = fopen(filename_.c_str(), "r+b");
+        if (nullptr == file_)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to open persistence log " << filename_);
+            return false;
+        }
+
+        uint64_t size = file_size(file_);
+        if (!scan(size))
+        {
+            // Drop the incomplete records at the end of the log
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Persistence log " << filename_ << " has " << (size - end_offset_)
+                                                                      << " bytes of incomplete records");
+            if (0 != truncate_file(file_, end_offset_))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to truncate persistence log " << filename_);
+                return false;
+            }
+        }
+
+        compaction_thread_ = eprosima::create_thread([this]()
+                        {
+                            run_compaction_thread();
+                        }, thread_settings, "dds.persist.log");
+        return true;
+    }
+
+private:
+
+    struct WriterIndex
+    {
+        //! Position on the log of each change, by sequence number.
+        std::map<int64_t, uint64_t> changes;
+        //! Last sequence number of the writer.
+        int64_t last_sequence_number = 0;
+    };
+
+    /**
+     * Build the index from the records on the log.
+     * @return False if the log ends with an incomplete or corrupted record.
+     */
+    bool scan(
+            uint64_t size)
+    {
+        end_offset_ = 0;
+        seek_file(file_, 0);
+
+        while (end_offset_ < size)
+        {
+            RecordHeader header;
+            uint64_t record_end = end_offset_ + sizeof(header);
+            if ((record_end > size) || (1 != fread(&header, sizeof(header), 1, file_)) ||
+                    (record_magic != header.magic))
+            {
+                return false;
+            }
+
+            record_end += header.length;
+            if (record_end > size)
+            {
+                return false;
+            }
+
+            // Small records are read sequentially. For big ones only the first part is read.
+            size_t read_length = (header.length <= max_scan_read_length) ? header.length : max_scan_read_length;
+            buffer_.resize(read_length);
+            if ((0 < read_length) && (1 != fread(buffer_.data(), read_length, 1, file_)))
+            {
+                return false;
+            }
+            if ((read_length < header.length) && (0 != seek_file(file_, record_end)))
+            {
+                return false;
+            }
+
+            BodyReader reader(buffer_.data(), buffer_.size());
+            std::string guid;
+            if (!reader.read(guid) || !process_record(header.kind, end_offset_, guid, reader))
+            {
+                return false;
+            }
+
+            end_offset_ = record_end;
+        }
+
+        return true;
+    }
+
+    bool process_record(
+            uint32_t kind,
+            uint64_t offset,
+            const std::string& guid,
+            BodyReader& reader)
+    {
+        switch (kind)
+        {
+            case WRITER_ADD_RECORD:
+            {
+                int64_t sn = 0;
+                if (!reader.read(sn))
+                {
+                    return false;
+                }
+                WriterIndex& writer = writers_[guid];
+                writer.last_sequence_number = sn;
+                if (writer.changes.emplace(sn, offset).second)
+                {
+                    ++live_records_;
+                }
+                break;
+            }
+
+            case WRITER_REMOVE_RECORD:
+            {
+                int64_t sn = 0;
+                if (!reader.read(sn))
+                {
+                    return false;
+                }
+                WriterIndex& writer = writers_[guid];
+                if (0 < writer.changes.erase(sn))
+                {
+                    --live_records_;
+                    ++dead_records_;
+                }
+                ++dead_records_;
+                break;
+            }
+
+            case WRITER_STATE_RECORD:
+            {
+                int64_t sn = 0;
+                if (!reader.read(sn))
+                {
+                    return false;
+                }
+                writers_[guid].last_sequence_number = sn;
+                break;
+            }
+
+            case READER_SEQ_RECORD:
+            {
+                GUID_t writer_guid;
+                int64_t sn = 0;
+                if (!reader.read(writer_guid) || !reader.read(sn))
+                {
+                    return false;
+                }
+                auto& reader_map = readers_[guid];
+                if (reader_map.end() == reader_map.find(writer_guid))
+                {
+                    ++live_records_;
+                }
+                else
+                {
+                    ++dead_records_;
+                }
+                reader_map[writer_guid] = SequenceNumber_t(static_cast<uint64_t>(sn));
+                break;
+            }
+
+            default:
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Append a record with the body stored on buffer_ followed by an optional extra buffer.
+     */
+    bool append_record(
+            uint32_t kind,
+            const octet* extra,
+            uint32_t extra_length,
+            uint64_t& offset)
+    {
+        if (nullptr == file_)
+        {
+            return false;
+        }
+
+        RecordHeader header{record_magic, kind, static_cast<uint32_t>(buffer_.size() + extra_length)};
+
+        offset = end_offset_;
+        bool ret_val = (0 == seek_file(file_, end_offset_)) &&
+                (1 == fwrite(&header, sizeof(header), 1, file_)) &&
+                (1 == fwrite(buffer_.data(), buffer_.size(), 1, file_)) &&
+                ((0 == extra_length) || (1 == fwrite(extra, extra_length, 1, file_))) &&
+                (0 == fflush(file_));
+
+        if (!ret_val)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Error writing to persistence log " << filename_);
+
+            // Drop the part of the record already written, so the next records do not follow a corrupted one
+            clearerr(file_);
+            fflush(file_);
+            if (0 != truncate_file(file_, end_offset_))
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to truncate persistence log " << filename_);
+            }
+            clearerr(file_);
+            return false;
+        }
+
+        end_offset_ += sizeof(header) + header.length;
+        return true;
+    }
+
+    void compact_if_needed()
+    {
+        if (!compaction_requested_ && (min_dead_records_to_compact <= dead_records_) &&
+                (live_records_ < dead_records_))
+        {
+            compaction_requested_ = true;
+            compaction_cond_.notify_one();
+        }
+    }
+
+    void run_compaction_thread()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (running_)
+        {
+            compaction_cond_.wait(lock, [this]()
+                    {
+                        return !running_ || compaction_requested_;
+                    });
+
+            if (running_)
+            {
+                bool compacted = compact(lock);
+                compaction_requested_ = false;
+                if (compacted)
+                {
+                    // Changes removed while compacting may require another compaction
+                    compact_if_needed();
+                }
+            }
+        }
+    }
+
+    /**
+     * Rewrite the log keeping only the live records.
+     *
+     * The live records are copied to a temporary file without holding the lock, since the records before the end of
+     * the log are never modified. The records appended meanwhile are then copied with the lock taken, and the
+     * temporary file atomically replaces the log.
+     * On any error the log and its index are kept as they were.
+     *
+     * @param lock Lock on mutex_, taken when calling this method and when it returns.
+     */
+    bool compact(
+            std::unique_lock<std::mutex>& lock)
+    {
+        if (nullptr == file_)
+        {
+            return false;
+        }
+
+        std::string tmp_filename = filename_ + ".tmp";
+        FILE* out = fopen(tmp_filename.c_str(), "w+b");
+        FILE* in = fopen(filename_.c_str(), "rb");
+        if ((nullptr == out) || (nullptr == in) || (0 != fflush(file_)))
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Unable to compact persistence log " << filename_);
+            discard_compaction(in, out, tmp_filename);
+            return false;
+        }
+
+        uint64_t snapshot_end = end_offset_;
+        uint64_t snapshot_dead_records = dead_records_;
+        std::map<std::string, WriterIndex> writers = writers_;
+        std::map<std::string, std::map<GUID_t, SequenceNumber_t>> readers = readers_;
+        lock.unlock();
+
+        // New position of each live change, by its position on the log
+        std::unordered_map<uint64_t, uint64_t> new_offsets;
+        uint64_t out_offset = 0;
+        bool ret_val = true;
+
+        for (auto writer_it = writers.begin(); ret_val && writer_it != writers.end(); ++writer_it)
+        {
+            // Keep the last sequence number, as all changes may have been removed
+            compaction_buffer_.clear();
+            append_string(compaction_buffer_, writer_it->first);
+            append_value(compaction_buffer_, writer_it->second.last_sequence_number);
+            ret_val = write_record(out, WRITER_STATE_RECORD, out_offset);
+
+            for (auto change_it = writer_it->second.changes.begin();
+                    ret_val && change_it != writer_it->second.changes.end(); ++change_it)
+            {
+                RecordHeader header;
+                ret_val = (0 == seek_file(in, change_it->second)) &&
+                        (1 == fread(&header, sizeof(header), 1, in));
+                if (ret_val)
+                {
+                    compaction_buffer_.resize(header.length);
+                    ret_val = ((0 == header.length) || (1 == fread(compaction_buffer_.data(), header.length, 1, in)));
+                }
+                if (ret_val)
+                {
+                    new_offsets[change_it->second] = out_offset;
+                    ret_val = write_record(out, header.kind, out_offset);
+                }
+            }
+        }
+
+        for (auto reader_it = readers.begin(); ret_val && reader_it != readers.end(); ++reader_it)
+        {
+            for (auto seq_it = reader_it->second.begin(); ret_val && seq_it != reader_it->second.end(); ++seq_it)
+            {
+                compaction_buffer_.clear();
+                append_string(compaction_buffer_, reader_it->first);
+                append_guid(compaction_buffer_, seq_it->first);
+                append_value(compaction_buffer_, seq_it->second.to64long());
+                ret_val = write_record(out, READER_SEQ_RECORD, out_offset);
+            }
+        }
+
+        lock.lock();
+
+        // Copy the records appended while the live ones were copied
+        ret_val = ret_val && (nullptr != file_) && (0 == fflush(file_)) &&
+                copy_records(in, snapshot_end, end_offset_, out) && (0 == fflush(out));
+        if (!ret_val)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Error compacting persistence log " << filename_);
+            discard_compaction(in, out, tmp_filename);
+            return false;
+        }
+        fclose(in);
+
+#ifdef _WIN32
+        // Open files cannot be replaced on Windows
+        fclose(out);
+        fclose(file_);
+        bool replaced = (0 != MoveFileExA(tmp_filename.c_str(), filename_.c_str(),
+                MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH));
+        file_ = fopen(filename_.c_str(), "r+b");
+        if (nullptr == file_)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Unable to open persistence log " << filename_);
+        }
+#else
+        bool replaced = (0 == std::rename(tmp_filename.c_str(), filename_.c_str()));
+        if (replaced)
+        {
+            // The temporary file is now the log
+            fclose(file_);
+            file_ = out;
+        }
+        else
+        {
+            fclose(out);
+        }
+#endif // ifdef _WIN32
+
+        if (!replaced)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Unable to replace persistence log " << filename_);
+            std::remove(tmp_filename.c_str());
+            return false;
+        }
+
+        // The records appended meanwhile follow the live ones
+        for (auto& writer : writers_)
+        {
+            for (auto& change : writer.second.changes)
+            {
+                change.second = (change.second < snapshot_end) ?
+                        new_offsets[change.second] :
+                        change.second - snapshot_end + out_offset;
+            }
+        }
+        end_offset_ = out_offset + (end_offset_ - snapshot_end);
+        dead_records_ -= snapshot_dead_records;
+        return true;
+    }
+
+    /**
+     * Copy a range of the log to the end of another file.
+     */
+    bool copy_records(
+            FILE* in,
+            uint64_t begin,
+            uint64_t end,
+            FILE* out)
+    {
+        if (0 != seek_file(in, begin))
+        {
+            return false;
+        }
+
+        compaction_buffer_.resize(copy_block_length);
+        while (begin < end)
+        {
+            size_t length = static_cast<size_t>(std::min<uint64_t>(end - begin, copy_block_length));
+            if ((1 != fread(compaction_buffer_.data(), length, 1, in)) ||
+                    (1 != fwrite(compaction_buffer_.data(), length, 1, out)))
+            {
+                return false;
+            }
+            begin += length;
+        }
+        return true;
+    }
+
+    void discard_compaction(
+            FILE* in,
+            FILE* out,
+            const std::string& tmp_filename)
+    {
+        if (nullptr != in)
+        {
+            fclose(in);
+        }
+        if (nullptr != out)
+        {
+            fclose(out);
+            std::remove(tmp_filename.c_str());
+        }
+    }
+
+    /**
+     * Write a record with the body stored on compaction_buffer_ to a file.
+     */
+    bool write_record(
+            FILE* out,
+            uint32_t kind,
+            uint64_t& offset)
+    {
+        RecordHeader header{record_magic, kind, static_cast<uint32_t>(compaction_buffer_.size())};
+        bool ret_val = (1 == fwrite(&header, sizeof(header), 1, out)) &&
+                (compaction_buffer_.empty() ||
+                (1 == fwrite(compaction_buffer_.data(), compaction_buffer_.size(), 1, out)));
+        offset += sizeof(header) + header.length;
+        return ret_val;
+    }
+
+    std::string filename_;
+
+    FILE* file_ = nullptr;
+
+    //! Position where the next record will be written.
+    uint64_t end_offset_ = 0;
+
+    std::map<std::string, WriterIndex> writers_;
+
+    std::map<std::string, std::map<GUID_t, SequenceNumber_t>> readers_;
+
+    //! Number of records that would be kept on compaction.
+    uint64_t live_records_ = 0;
+
+    //! Number of records that would be discarded on compaction.
+    uint64_t dead_records_ = 0;
+
+    //! Scratch buffer to build and read records.
+    std::vector<octet> buffer_;
+
+    //! Scratch buffer of the compaction thread.
+    std::vector<octet> compaction_buffer_;
+
+    std::mutex mutex_;
+
+    std::condition_variable compaction_cond_;
+
+    bool compaction_requested_ = false;
+
+    bool running_ = true;
+
+    eprosima::thread compaction_thread_;
+};
+
+IPersistenceService* create_LogFile_persistence_service(
+        const char* filename,
+        const ThreadSettings& thread_settings)
+{
+    std::shared_ptr<PersistenceLogFile> log = PersistenceLogFile::get(filename, thread_settings);
+    return (nullptr == log) ? nullptr : new LogFilePersistenceService(log);
+}
+
+LogFilePersistenceService::LogFilePersistenceService(
+        const std::shared_ptr<PersistenceLogFile>& log)
+    : log_(log)
+{
+}
+
+bool LogFilePersistenceService::load_writer_from_storage(
+        const std::string& persistence_guid,
+        const GUID_t& writer_guid,
+        WriterHistory* history,
+        SequenceNumber_t& next_sequence)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
+    return log_->load_writer(persistence_guid, writer_guid, history, next_sequence);
+}
+
+bool LogFilePersistenceService::add_writer_change_to_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
+    return log_->add_writer_change(persistence_guid, change);
+}
+
+bool LogFilePersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+    return log_->remove_writer_change(persistence_guid, change.sequenceNumber);
+}
+
+bool LogFilePersistenceService::load_reader_from_storage(
+        const std::string& reader_guid,
+        foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
+    return log_->load_reader(reader_guid, seq_map);
+}
+
+bool LogFilePersistenceService::update_writer_seq_on_storage(
+        const std::string& reader_guid,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& seq_number)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
+    return log_->update_reader(reader_guid, writer_guid, seq_number);
+}
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
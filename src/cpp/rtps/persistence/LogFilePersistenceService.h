@@ -0,0 +1,101 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LogFilePersistenceService.h
+ */
+
+#ifndef LOGFILEPERSISTENCESERVICE_H_
+#define LOGFILEPERSISTENCESERVICE_H_
+
+#include <memory>
+#include <string>
+
+#include <rtps/persistence/PersistenceService.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class PersistenceLogFile;
+
+/**
+ * Create a new append-only log file implementation of persistence service
+ * @param filename         Name of the log file.
+ * @param thread_settings  Settings of the thread compacting the log file.
+ * @return A pointer to the persistence service. nullptr if the log file could not be opened.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+IPersistenceService* create_LogFile_persistence_service(
+        const char* filename,
+        const ThreadSettings& thread_settings);
+
+/**
+ * Persistence service implementation over an append-only log file.
+ *
+ * Every operation appends a record to the end of the file, and an in-memory index keeps the position of the live
+ * records of each writer and reader.
+ * Restarting only requires a sequential scan of the record headers, and payloads are read straight into the changes.
+ * When removed records outnumber the live ones, a background thread compacts the file by rewriting only the live
+ * records to a temporary file, which then atomically replaces the log. A record that could not be fully written is
+ * truncated from the log.
+ *
+ * Records are flushed to the operating system after every operation, but not synced to disk.
+ * All the services created on the same file in a process share the same log, but the file cannot be shared between
+ * processes.
+ * Records are stored with the native byte order.
+ * @ingroup RTPS_PERSISTENCE_MODULE
+ */
+class LogFilePersistenceService : public IPersistenceService
+{
+public:
+
+    LogFilePersistenceService(
+            const std::shared_ptr<PersistenceLogFile>& log);
+
+    virtual ~LogFilePersistenceService() override = default;
+
+    bool load_writer_from_storage(
+            const std::string& persistence_guid,
+            const GUID_t& writer_guid,
+            WriterHistory* history,
+            SequenceNumber_t& next_sequence) final;
+
+    bool add_writer_change_to_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool remove_writer_change_from_storage(
+            const std::string& persistence_guid,
+            const CacheChange_t& change) final;
+
+    bool load_reader_from_storage(
+            const std::string& reader_guid,
+            foonathan::memory::map<GUID_t, SequenceNumber_t, map_allocator_t>& seq_map) final;
+
+    bool update_writer_seq_on_storage(
+            const std::string& reader_guid,
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& seq_number) final;
+
+private:
+
+    std::shared_ptr<PersistenceLogFile> log_;
+};
+
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* LOGFILEPERSISTENCESERVICE_H_ */
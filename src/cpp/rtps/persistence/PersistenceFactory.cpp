@@ -18,6 +18,7 @@
  */
 
 #include <rtps/persistence/PersistenceService.h>
+#include <rtps/persistence/LogFilePersistenceService.h>
 
 #if HAVE_SQLITE3
 #include <rtps/persistence/SQLite3PersistenceService.h>
@@ -26,6 +27,8 @@
 #include <fastdds/rtps/attributes/PropertyPolicy.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
+#include <cstdlib>
+
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
@@ -44,7 +47,8 @@ void IPersistenceService::set_fragments(
 }
 
 IPersistenceService* PersistenceFactory::create_persistence_service(
-        const PropertyPolicy& property_policy)
+        const PropertyPolicy& property_policy,
+        const ThreadSettings& thread_settings)
 {
     IPersistenceService* ret_val = nullptr;
     const std::string* plugin_property = PropertyPolicyHelper::find_property(property_policy, "dds.persistence.plugin");
@@ -72,9 +76,31 @@ IPersistenceService* PersistenceFactory::create_persistence_service(
             {
                 update_schema = true;
             }
-            ret_val = create_SQLite3_persistence_service(filename, update_schema);
+            uint32_t max_commit_latency_ms = 0;
+            const std::string* commit_latency_value = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.sqlite3.max_commit_latency_ms");
+            if (commit_latency_value != nullptr)
+            {
+                max_commit_latency_ms = static_cast<uint32_t>(std::strtoul(commit_latency_value->c_str(), nullptr,
+                        10));
+            }
+            ret_val = create_SQLite3_persistence_service(filename, update_schema, max_commit_latency_ms,
+                            thread_settings);
         }
 #endif // if HAVE_SQLITE3
+        if (plugin_property->compare("builtin.LOGFILE") == 0)
+        {
+            const std::string* filename_property = PropertyPolicyHelper::find_property(property_policy,
+                            "dds.persistence.logfile.filename");
+#ifdef ANDROID
+            const char* filename = (filename_property == nullptr) ?
+                    "/data/local/tmp/persistence.log" : filename_property->c_str();
+#else
+            const char* filename = (filename_property == nullptr) ?
+                    "persistence.log" : filename_property->c_str();
+#endif // if ANDROID
+            ret_val = create_LogFile_persistence_service(filename, thread_settings);
+        }
     }
 
     return ret_val;
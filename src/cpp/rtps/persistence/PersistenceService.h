@@ -22,12 +22,14 @@
 #include <fastdds/rtps/common/Guid.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
 #include <fastdds/rtps/attributes/PropertyPolicy.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/IChangePool.hpp>
 #include <fastdds/rtps/history/IPayloadPool.hpp>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <chrono>
 #include <map>
 
 namespace eprosima {
@@ -107,6 +109,18 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) = 0;
 
+    /**
+     * Wait until all the changes added to or removed from storage before this call are durably stored.
+     * Implementations that store changes synchronously have nothing to wait for.
+     * @param max_blocking_time Maximum time point to wait for the changes to be stored.
+     * @return True if the changes were stored before @c max_blocking_time.
+     */
+    virtual bool flush(
+            const std::chrono::steady_clock::time_point& /*max_blocking_time*/)
+    {
+        return true;
+    }
+
     static std::vector<CacheChange_t*>& get_changes(
             WriterHistory* history);
 
@@ -127,10 +141,12 @@ public:
     /**
      * Create a persistence service implementation
      * @param property_policy PropertyPolicy where the persistence configuration will be searched
+     * @param thread_settings Settings of the thread the persistence service may create to store changes
      * @return A pointer to a persistence service implementation. nullptr when policy does not contain the necessary properties or if persistence service could not be created
      */
     static IPersistenceService* create_persistence_service(
-            const PropertyPolicy& property_policy);
+            const PropertyPolicy& property_policy,
+            const ThreadSettings& thread_settings);
 };
 
 
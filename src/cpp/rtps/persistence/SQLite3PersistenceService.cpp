@@ -20,16 +20,28 @@
 #include <rtps/persistence/SQLite3PersistenceService.h>
 #include <rtps/persistence/SQLite3PersistenceServiceStatements.h>
 #include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <rtps/persistence/sqlite3.h>
+#include <utils/threading.hpp>
 
+#include <iterator>
 #include <sstream>
 
 namespace eprosima {
 namespace fastdds {
 namespace rtps {
 
+//! Number of queued writer changes which are committed without waiting for the maximum commit latency.
+constexpr size_t max_batched_operations = 1024;
+
+//! Number of times a transaction of writer changes is committed before committing its changes one by one.
+constexpr uint32_t max_commit_attempts = 3;
+
+//! Time the commit thread waits for the database to be unlocked by another connection, in milliseconds.
+constexpr int commit_busy_timeout_ms = 1000;
+
 /**
  * @brief Retrieve the schema version of the database
  * @param db [IN] Database of which we want to get the schema version
@@ -184,14 +196,18 @@ static void finalize_statement(
 
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema)
+        bool update_schema,
+        uint32_t max_commit_latency_ms,
+        const ThreadSettings& thread_settings)
 {
     sqlite3* db = open_or_create_database(filename, update_schema);
-    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db);
+    return (db == NULL) ? nullptr : new SQLite3PersistenceService(db, max_commit_latency_ms, thread_settings);
 }
 
 SQLite3PersistenceService::SQLite3PersistenceService(
-        sqlite3* db)
+        sqlite3* db,
+        uint32_t max_commit_latency_ms,
+        const ThreadSettings& thread_settings)
     : db_(db)
     , load_writer_stmt_(NULL)
     , add_writer_change_stmt_(NULL)
@@ -200,6 +216,9 @@ SQLite3PersistenceService::SQLite3PersistenceService(
     , update_writer_last_seq_num_stmt_(NULL)
     , load_reader_stmt_(NULL)
     , update_reader_stmt_(NULL)
+    , begin_transaction_stmt_(NULL)
+    , commit_transaction_stmt_(NULL)
+    , max_commit_latency_(max_commit_latency_ms)
 {
     // Prepare writer statements
     sqlite3_prepare_v3(db_,
@@ -223,10 +242,42 @@ SQLite3PersistenceService::SQLite3PersistenceService(
             SQLITE_PREPARE_PERSISTENT, &load_reader_stmt_, NULL);
     sqlite3_prepare_v3(db_, "INSERT OR REPLACE INTO readers VALUES(?,?,?,?);", -1, SQLITE_PREPARE_PERSISTENT,
             &update_reader_stmt_, NULL);
+
+    if (0 < max_commit_latency_.count())
+    {
+        // Wait for other connections instead of failing the commit when the database is locked
+        sqlite3_busy_timeout(db_, commit_busy_timeout_ms);
+
+        // Prepare group commit statements
+        sqlite3_prepare_v3(db_, "BEGIN TRANSACTION;", -1, SQLITE_PREPARE_PERSISTENT, &begin_transaction_stmt_, NULL);
+        sqlite3_prepare_v3(db_, "COMMIT TRANSACTION;", -1, SQLITE_PREPARE_PERSISTENT, &commit_transaction_stmt_,
+                NULL);
+
+        running_ = true;
+        commit_thread_ = eprosima::create_thread([this]()
+                        {
+                            run_commit_thread();
+                        }, thread_settings, "dds.persist");
+    }
 }
 
 SQLite3PersistenceService::~SQLite3PersistenceService()
 {
+    // Stop the commit thread, which commits the writer changes still queued
+    if (commit_thread_.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> guard(pending_mutex_);
+            running_ = false;
+        }
+        pending_cond_.notify_all();
+        commit_thread_.join();
+    }
+
+    // Finalize group commit statements
+    finalize_statement(begin_transaction_stmt_);
+    finalize_statement(commit_transaction_stmt_);
+
     // Finalize writer statements
     finalize_statement(load_writer_stmt_);
     finalize_statement(add_writer_change_stmt_);
@@ -266,6 +317,13 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading writer " << writer_guid);
 
+    // Changes still queued should also be loaded
+    if (!flush(std::chrono::steady_clock::time_point::max()))
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(statements_mutex_);
     if (load_writer_stmt_ != NULL)
     {
         sqlite3_reset(load_writer_stmt_);
@@ -346,44 +404,145 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Writer " << change.writerGUID << " storing change for seq " << change.sequenceNumber);
 
+    // related sample identity
+    std::ostringstream os;
+    auto& si = change.write_params.related_sample_identity();
+    os << si.writer_guid();
+
+    if (commit_thread_.joinable())
+    {
+        // The change may be released before it is committed, so its contents are copied
+        PendingWriterOperation operation;
+        operation.persistence_guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber.to64long();
+        operation.instance = change.instanceHandle;
+        operation.payload.assign(change.serializedPayload.data,
+                change.serializedPayload.data + change.serializedPayload.length);
+        operation.related_guid = os.str();
+        operation.related_sequence_number = si.sequence_number().to64long();
+        operation.source_timestamp = change.sourceTimestamp.to_ns();
+
+        enqueue_writer_operation(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(statements_mutex_);
+    return store_writer_change(persistence_guid, change.sequenceNumber.to64long(), change.instanceHandle,
+                   change.serializedPayload.data, change.serializedPayload.length, os.str(),
+                   si.sequence_number().to64long(), change.sourceTimestamp.to_ns());
+}
+
+/**
+ * Remove a change from storage.
+ * @param change The cache change to remove.
+ * @return True if operation was successful.
+ */
+bool SQLite3PersistenceService::remove_writer_change_from_storage(
+        const std::string& persistence_guid,
+        const CacheChange_t& change)
+{
+    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
+            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
+
+    if (commit_thread_.joinable())
+    {
+        PendingWriterOperation operation;
+        operation.is_add = false;
+        operation.persistence_guid = persistence_guid;
+        operation.sequence_number = change.sequenceNumber.to64long();
+
+        enqueue_writer_operation(std::move(operation));
+        return true;
+    }
+
+    std::lock_guard<std::mutex> guard(statements_mutex_);
+    return delete_writer_change(persistence_guid, change.sequenceNumber.to64long());
+}
+
+bool SQLite3PersistenceService::flush(
+        const std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    if (!commit_thread_.joinable())
+    {
+        return true;
+    }
+
+    std::unique_lock<std::mutex> lock(pending_mutex_);
+    uint64_t last_operation = queued_operations_;
+    if (committed_operations_ >= last_operation)
+    {
+        return true;
+    }
+
+    flush_requested_ = true;
+    pending_cond_.notify_one();
+    auto is_committed = [&]()
+            {
+                return committed_operations_ >= last_operation;
+            };
+    if (std::chrono::steady_clock::time_point::max() == max_blocking_time)
+    {
+        committed_cond_.wait(lock, is_committed);
+        return true;
+    }
+    return committed_cond_.wait_until(lock, max_blocking_time, is_committed);
+}
+
+void SQLite3PersistenceService::enqueue_writer_operation(
+        PendingWriterOperation&& operation)
+{
+    std::lock_guard<std::mutex> guard(pending_mutex_);
+    pending_operations_.push_back(std::move(operation));
+    ++queued_operations_;
+
+    // The commit thread only waits for the first operation of a transaction, or for enough of them to commit
+    // before the maximum commit latency
+    if (1u == pending_operations_.size() || max_batched_operations == pending_operations_.size())
+    {
+        pending_cond_.notify_one();
+    }
+}
+
+bool SQLite3PersistenceService::store_writer_change(
+        const std::string& persistence_guid,
+        int64_t sequence_number,
+        const InstanceHandle_t& instance,
+        const octet* payload,
+        uint32_t payload_length,
+        const std::string& related_guid,
+        int64_t related_sequence_number,
+        int64_t source_timestamp)
+{
     if (add_writer_change_stmt_ != NULL)
     {
         //First add the last seq number, it is needed for the foreign key on writers_histories
         sqlite3_reset(update_writer_last_seq_num_stmt_);
         sqlite3_bind_text(update_writer_last_seq_num_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(update_writer_last_seq_num_stmt_, 2, sequence_number);
 
         if (sqlite3_step(update_writer_last_seq_num_stmt_) == SQLITE_DONE)
         {
             sqlite3_reset(add_writer_change_stmt_);
             sqlite3_bind_text(add_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 2, change.sequenceNumber.to64long());
-            if (change.instanceHandle.isDefined())
+            sqlite3_bind_int64(add_writer_change_stmt_, 2, sequence_number);
+            if (instance.isDefined())
             {
-                sqlite3_bind_blob(add_writer_change_stmt_, 3, change.instanceHandle.value, 16, SQLITE_STATIC);
+                sqlite3_bind_blob(add_writer_change_stmt_, 3, instance.value, 16, SQLITE_STATIC);
             }
             else
             {
                 sqlite3_bind_zeroblob(add_writer_change_stmt_, 3, 16);
             }
-            sqlite3_bind_blob(add_writer_change_stmt_, 4, change.serializedPayload.data,
-                    change.serializedPayload.length, SQLITE_STATIC);
+            sqlite3_bind_blob(add_writer_change_stmt_, 4, payload, payload_length, SQLITE_STATIC);
 
-            // related sample identity
-            std::ostringstream os;
-            auto& si = change.write_params.related_sample_identity();
-            os << si.writer_guid();
-
-            // IMPORTANT: this element must survive until the call (sqlite3_step) has been fulfilled.
+            // IMPORTANT: the bound strings must survive until the call (sqlite3_step) has been fulfilled.
             // Another way would be to use SQLITE_TRANSIENT instead of static, forcing an internal copy,
             // but this way a copy is saved (with cost of taking care that this string should survive)
-            std::string guids = os.str();
-
-            sqlite3_bind_text(add_writer_change_stmt_, 5, guids.c_str(), -1, SQLITE_STATIC);
-            sqlite3_bind_int64(add_writer_change_stmt_, 6, si.sequence_number().to64long());
+            sqlite3_bind_text(add_writer_change_stmt_, 5, related_guid.c_str(), -1, SQLITE_STATIC);
+            sqlite3_bind_int64(add_writer_change_stmt_, 6, related_sequence_number);
 
             // source time stamp
-            sqlite3_bind_int64(add_writer_change_stmt_, 7, change.sourceTimestamp.to_ns());
+            sqlite3_bind_int64(add_writer_change_stmt_, 7, source_timestamp);
 
             return sqlite3_step(add_writer_change_stmt_) == SQLITE_DONE;
         }
@@ -392,29 +551,131 @@ bool SQLite3PersistenceService::add_writer_change_to_storage(
     return false;
 }
 
-/**
- * Remove a change from storage.
- * @param change The cache change to remove.
- * @return True if operation was successful.
- */
-bool SQLite3PersistenceService::remove_writer_change_from_storage(
+bool SQLite3PersistenceService::delete_writer_change(
         const std::string& persistence_guid,
-        const CacheChange_t& change)
+        int64_t sequence_number)
 {
-    EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
-            "Writer " << change.writerGUID << " removing change for seq " << change.sequenceNumber);
-
     if (remove_writer_change_stmt_ != NULL)
     {
         sqlite3_reset(remove_writer_change_stmt_);
         sqlite3_bind_text(remove_writer_change_stmt_, 1, persistence_guid.c_str(), -1, SQLITE_STATIC);
-        sqlite3_bind_int64(remove_writer_change_stmt_, 2, change.sequenceNumber.to64long());
+        sqlite3_bind_int64(remove_writer_change_stmt_, 2, sequence_number);
         return sqlite3_step(remove_writer_change_stmt_) == SQLITE_DONE;
     }
 
     return false;
 }
 
+void SQLite3PersistenceService::run_commit_thread()
+{
+    std::vector<PendingWriterOperation> operations;
+    uint32_t failed_commits = 0;
+
+    std::unique_lock<std::mutex> lock(pending_mutex_);
+    while (running_ || !pending_operations_.empty())
+    {
+        pending_cond_.wait(lock, [this]()
+                {
+                    return !running_ || !pending_operations_.empty();
+                });
+
+        // Let more changes join the transaction, up to the maximum commit latency
+        pending_cond_.wait_for(lock, max_commit_latency_, [this]()
+                {
+                    return !running_ || flush_requested_ || max_batched_operations <= pending_operations_.size();
+                });
+
+        flush_requested_ = false;
+        operations.swap(pending_operations_);
+        uint64_t last_operation = queued_operations_;
+        lock.unlock();
+
+        bool committed = operations.empty() ||
+                commit_writer_operations(operations, failed_commits < max_commit_attempts);
+
+        lock.lock();
+        if (committed)
+        {
+            failed_commits = 0;
+            operations.clear();
+            committed_operations_ = last_operation;
+            committed_cond_.notify_all();
+        }
+        else
+        {
+            // Retry the failed operations in the next transaction, before the ones queued meanwhile
+            ++failed_commits;
+            operations.insert(operations.end(), std::make_move_iterator(pending_operations_.begin()),
+                    std::make_move_iterator(pending_operations_.end()));
+            pending_operations_.swap(operations);
+            operations.clear();
+        }
+    }
+}
+
+bool SQLite3PersistenceService::commit_writer_operations(
+        const std::vector<PendingWriterOperation>& operations,
+        bool use_transaction)
+{
+    std::lock_guard<std::mutex> guard(statements_mutex_);
+
+    bool in_transaction = use_transaction;
+    if (in_transaction)
+    {
+        sqlite3_reset(begin_transaction_stmt_);
+        if (sqlite3_step(begin_transaction_stmt_) != SQLITE_DONE)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not begin transaction: " << sqlite3_errmsg(db_));
+            return false;
+        }
+    }
+    else
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not commit " << operations.size() << " writer changes after "
+                                                                   << max_commit_attempts
+                                                                   << " attempts. Committing changes one by one");
+    }
+
+    for (const PendingWriterOperation& operation : operations)
+    {
+        bool ret = operation.is_add ?
+                store_writer_change(operation.persistence_guid, operation.sequence_number, operation.instance,
+                operation.payload.data(), static_cast<uint32_t>(operation.payload.size()),
+                operation.related_guid, operation.related_sequence_number, operation.source_timestamp) :
+                delete_writer_change(operation.persistence_guid, operation.sequence_number);
+
+        if (!ret && in_transaction)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not " << (operation.is_add ? "store" : "remove")
+                                                                << " change for seq " << operation.sequence_number
+                                                                << " of writer " << operation.persistence_guid
+                                                                << ": " << sqlite3_errmsg(db_));
+            sqlite3_exec(db_, "ROLLBACK TRANSACTION;", 0, 0, 0);
+            return false;
+        }
+        else if (!ret)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PERSISTENCE, "Could not " << (operation.is_add ? "store" : "remove")
+                                                              << " change for seq " << operation.sequence_number
+                                                              << " of writer " << operation.persistence_guid);
+        }
+    }
+
+    if (in_transaction)
+    {
+        sqlite3_reset(commit_transaction_stmt_);
+        if (sqlite3_step(commit_transaction_stmt_) != SQLITE_DONE)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_PERSISTENCE, "Could not commit " << operations.size() << " writer changes: "
+                                                                       << sqlite3_errmsg(db_));
+            sqlite3_exec(db_, "ROLLBACK TRANSACTION;", 0, 0, 0);
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /**
  * Get all data stored for a reader.
  * @param reader_guid GUID of the reader to load.
@@ -426,6 +687,7 @@ bool SQLite3PersistenceService::load_reader_from_storage(
 {
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE, "Loading reader " << reader_guid);
 
+    std::lock_guard<std::mutex> guard(statements_mutex_);
     if (load_reader_stmt_ != NULL)
     {
         sqlite3_reset(load_reader_stmt_);
@@ -460,6 +722,7 @@ bool SQLite3PersistenceService::update_writer_seq_on_storage(
     EPROSIMA_LOG_INFO(RTPS_PERSISTENCE,
             "Reader " << reader_guid << " setting seq for writer " << writer_guid << " to " << seq_number);
 
+    std::lock_guard<std::mutex> guard(statements_mutex_);
     if (update_reader_stmt_ != NULL)
     {
         sqlite3_reset(update_reader_stmt_);
@@ -19,8 +19,16 @@
 #ifndef SQLITE3PERSISTENCESERVICE_H_
 #define SQLITE3PERSISTENCESERVICE_H_
 
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/persistence/sqlite3.h>
+#include <utils/thread.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -28,15 +36,30 @@ namespace rtps {
 
 /**
  * Create a new SQLite3 implementation of persistence service
+ * @param filename               Name of the database file.
+ * @param update_schema          Whether an old database schema should be upgraded.
+ * @param max_commit_latency_ms  Maximum time, in milliseconds, writer changes are kept in memory before being
+ *                               committed. 0 means each change is committed synchronously.
+ * @param thread_settings        Settings of the thread committing the changes when max_commit_latency_ms is not 0.
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 IPersistenceService* create_SQLite3_persistence_service(
         const char* filename,
-        bool update_schema);
+        bool update_schema,
+        uint32_t max_commit_latency_ms = 0,
+        const ThreadSettings& thread_settings = ThreadSettings());
 
 
 /**
  * Persistence service implementation over SQLite3
+ *
+ * By default every writer change is committed on its own, inline with the write or removal.
+ * When a maximum commit latency is given, writer changes are queued and a background thread commits them in a single
+ * transaction at most that time after the first one was queued, or as soon as enough of them are queued.
+ * In this mode a change may be lost if the process crashes before it is committed, and errors are only logged.
+ * A transaction which fails is rolled back and retried with the changes queued meanwhile, and its changes are
+ * committed one by one after several failed attempts.
+ * Calling flush() waits until every previous change has been committed.
  * @ingroup RTPS_PERSISTENCE_MODULE
  */
 class SQLite3PersistenceService : public IPersistenceService
@@ -44,7 +67,9 @@ class SQLite3PersistenceService : public IPersistenceService
 public:
 
     SQLite3PersistenceService(
-            sqlite3* db);
+            sqlite3* db,
+            uint32_t max_commit_latency_ms = 0,
+            const ThreadSettings& thread_settings = ThreadSettings());
     virtual ~SQLite3PersistenceService() override;
 
     bool load_writer_from_storage(
@@ -92,10 +117,63 @@ public:
             const GUID_t& writer_guid,
             const SequenceNumber_t& seq_number) final;
 
+    /**
+     * Wait until all the writer changes queued before this call have been committed.
+     * @param max_blocking_time Maximum time point to wait for the changes to be committed.
+     * @return True if the changes were committed before @c max_blocking_time.
+     */
+    bool flush(
+            const std::chrono::steady_clock::time_point& max_blocking_time) final;
+
 private:
 
+    //! Writer change waiting to be committed by the background thread.
+    struct PendingWriterOperation
+    {
+        bool is_add = true;
+        std::string persistence_guid;
+        int64_t sequence_number = 0;
+        InstanceHandle_t instance;
+        std::vector<octet> payload;
+        std::string related_guid;
+        int64_t related_sequence_number = 0;
+        int64_t source_timestamp = 0;
+    };
+
+    bool store_writer_change(
+            const std::string& persistence_guid,
+            int64_t sequence_number,
+            const InstanceHandle_t& instance,
+            const octet* payload,
+            uint32_t payload_length,
+            const std::string& related_guid,
+            int64_t related_sequence_number,
+            int64_t source_timestamp);
+
+    bool delete_writer_change(
+            const std::string& persistence_guid,
+            int64_t sequence_number);
+
+    void enqueue_writer_operation(
+            PendingWriterOperation&& operation);
+
+    void run_commit_thread();
+
+    /**
+     * Stores and removes a batch of writer changes.
+     * @param operations Writer changes to store or remove.
+     * @param use_transaction Whether to apply the changes in a single transaction, or one by one.
+     * @return False if any of the changes or the transaction failed, so none of the changes were applied.
+     */
+    bool commit_writer_operations(
+            const std::vector<PendingWriterOperation>& operations,
+            bool use_transaction);
+
     sqlite3* db_;
 
+    //! Protects the use of the prepared statements.
+    std::mutex statements_mutex_;
+
     sqlite3_stmt* load_writer_stmt_;
     sqlite3_stmt* add_writer_change_stmt_;
     sqlite3_stmt* remove_writer_change_stmt_;
@@ -105,6 +183,25 @@ private:
 
     sqlite3_stmt* load_reader_stmt_;
     sqlite3_stmt* update_reader_stmt_;
+
+    sqlite3_stmt* begin_transaction_stmt_;
+    sqlite3_stmt* commit_transaction_stmt_;
+
+    //! Maximum time a queued writer change waits before being committed.
+    std::chrono::milliseconds max_commit_latency_;
+
+    std::mutex pending_mutex_;
+    //! Wakes up the commit thread.
+    std::condition_variable pending_cond_;
+    //! Wakes up the threads waiting in flush().
+    std::condition_variable committed_cond_;
+    std::vector<PendingWriterOperation> pending_operations_;
+    uint64_t queued_operations_ = 0;
+    uint64_t committed_operations_ = 0;
+    bool flush_requested_ = false;
+    bool running_ = false;
+
+    eprosima::thread commit_thread_;
 };
 
 } /* namespace rtps */
@@ -42,6 +42,7 @@
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
+#include <rtps/history/HistoryMemoryUsage.hpp>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
 #include <rtps/reader/ReaderHistoryState.hpp>
 #include <statistics/rtps/StatisticsBase.hpp>
@@ -162,6 +163,15 @@ ReaderHistory* BaseReader::get_history() const
     return history_;
 }
 
+void BaseReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    usage = EndpointMemoryUsage();
+    fill_history_memory_usage(history_->getHistorySize(), change_pool_, payload_pool_, usage);
+}
+
 //! @return The content filter associated to this reader.
 IReaderDataFilter* BaseReader::get_content_filter() const
 {
@@ -86,6 +86,9 @@ public:
 
     fastdds::rtps::ReaderHistory* get_history() const override;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
     IReaderDataFilter* get_content_filter() const override;
 
     void set_content_filter(
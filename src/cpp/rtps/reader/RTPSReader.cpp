@@ -48,6 +48,11 @@ RTPSReader::~RTPSReader()
     history_->mp_mutex = nullptr;
 }
 
+void RTPSReader::get_memory_usage(
+        EndpointMemoryUsage& /*usage*/) const
+{
+}
+
 } /* namespace rtps */
 } /* namespace fastdds */
 } /* namespace eprosima */
@@ -19,6 +19,7 @@
 
 #include <rtps/reader/StatefulReader.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <mutex>
 #include <thread>
@@ -138,6 +139,7 @@ StatefulReader::StatefulReader(
     , times_(att.times)
     , matched_writers_(att.matched_writers_allocation)
     , matched_writers_pool_(att.matched_writers_allocation)
+    , matched_writers_by_guid_(att.matched_writers_allocation)
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
@@ -158,6 +160,7 @@ StatefulReader::StatefulReader(
     , times_(att.times)
     , matched_writers_(att.matched_writers_allocation)
     , matched_writers_pool_(att.matched_writers_allocation)
+    , matched_writers_by_guid_(att.matched_writers_allocation)
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
@@ -179,6 +182,7 @@ StatefulReader::StatefulReader(
     , times_(att.times)
     , matched_writers_(att.matched_writers_allocation)
     , matched_writers_pool_(att.matched_writers_allocation)
+    , matched_writers_by_guid_(att.matched_writers_allocation)
     , proxy_changes_config_(resource_limits_from_history(hist->m_att, 0))
     , disable_positive_acks_(att.disable_positive_acks)
     , is_alive_(true)
@@ -215,46 +219,44 @@ bool StatefulReader::matched_writer_add_edp(
         bool is_same_process = RTPSDomainImpl::should_intraprocess_between(m_guid, wdata.guid);
         bool is_datasharing = is_datasharing_compatible_with(wdata);
 
-        for (WriterProxy* it : matched_writers_)
+        WriterProxy* it = matched_writers_by_guid_.find(wdata.guid);
+        if (nullptr != it)
         {
-            if (it->guid() == wdata.guid)
+            EPROSIMA_LOG_INFO(RTPS_READER, "Attempting to add existing writer, updating information");
+            // If Ownership strength changes then update all history instances.
+            if (dds::EXCLUSIVE_OWNERSHIP_QOS == m_att.ownershipKind &&
+                    it->ownership_strength() != wdata.ownership_strength.value)
             {
-                EPROSIMA_LOG_INFO(RTPS_READER, "Attempting to add existing writer, updating information");
-                // If Ownership strength changes then update all history instances.
-                if (dds::EXCLUSIVE_OWNERSHIP_QOS == m_att.ownershipKind &&
-                        it->ownership_strength() != wdata.ownership_strength.value)
-                {
-                    history_->writer_update_its_ownership_strength_nts(
-                        it->guid(), wdata.ownership_strength.value);
-                }
-                it->update(wdata);
-                if (!is_same_process)
+                history_->writer_update_its_ownership_strength_nts(
+                    it->guid(), wdata.ownership_strength.value);
+            }
+            it->update(wdata);
+            if (!is_same_process)
+            {
+                for (const Locator_t& locator : it->remote_locators_shrinked())
                 {
-                    for (const Locator_t& locator : it->remote_locators_shrinked())
-                    {
-                        getRTPSParticipant()->createSenderResources(locator);
-                    }
+                    getRTPSParticipant()->createSenderResources(locator);
                 }
+            }
 
-                if (nullptr != listener)
-                {
-                    // call the listener without the lock taken
-                    guard.unlock();
-                    listener->on_writer_discovery(
-                        this, WriterDiscoveryStatus::CHANGED_QOS_WRITER, wdata.guid, &wdata);
-                }
+            if (nullptr != listener)
+            {
+                // call the listener without the lock taken
+                guard.unlock();
+                listener->on_writer_discovery(
+                    this, WriterDiscoveryStatus::CHANGED_QOS_WRITER, wdata.guid, &wdata);
+            }
 
 #ifdef FASTDDS_STATISTICS
-                // notify monitor service so that the connectionlist for this entity
-                // could be updated
-                if (nullptr != mp_RTPSParticipant->get_connections_observer() && !m_guid.is_builtin())
-                {
-                    mp_RTPSParticipant->get_connections_observer()->on_local_entity_connections_change(m_guid);
-                }
+            // notify monitor service so that the connectionlist for this entity
+            // could be updated
+            if (nullptr != mp_RTPSParticipant->get_connections_observer() && !m_guid.is_builtin())
+            {
+                mp_RTPSParticipant->get_connections_observer()->on_local_entity_connections_change(m_guid);
+            }
 #endif //FASTDDS_STATISTICS
 
-                return false;
-            }
+            return false;
         }
 
         // Get a writer proxy from the inactive pool (or create a new one if necessary and allowed)
@@ -302,6 +304,7 @@ bool StatefulReader::matched_writer_add_edp(
                     history_->m_att.maximumReservedCaches))
             {
                 matched_writers_.push_back(wp);
+                matched_writers_by_guid_.add(wp);
                 EPROSIMA_LOG_INFO(RTPS_READER, "Writer Proxy " << wdata.guid << " added to " << this->m_guid.entityId
                                                                << " with data sharing");
             }
@@ -342,6 +345,7 @@ bool StatefulReader::matched_writer_add_edp(
         else
         {
             matched_writers_.push_back(wp);
+            matched_writers_by_guid_.add(wp);
             EPROSIMA_LOG_INFO(RTPS_READER, "Writer Proxy " << wp->guid() << " added to " << m_guid.entityId);
         }
     }
@@ -391,18 +395,11 @@ bool StatefulReader::matched_writer_remove(
         //Remove cachechanges belonging to the unmatched writer
         history_->writer_unmatched(writer_guid, get_last_notified(writer_guid));
 
-        for (ResourceLimitedVector<WriterProxy*>::iterator it = matched_writers_.begin();
-                it != matched_writers_.end();
-                ++it)
+        wproxy = matched_writers_by_guid_.remove(writer_guid);
+        if (nullptr != wproxy)
         {
-            if ((*it)->guid() == writer_guid)
-            {
-                EPROSIMA_LOG_INFO(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
-                wproxy = *it;
-                matched_writers_.erase(it);
-
-                break;
-            }
+            EPROSIMA_LOG_INFO(RTPS_READER, "Writer proxy " << writer_guid << " removed from " << m_guid.entityId);
+            matched_writers_.erase(std::find(matched_writers_.begin(), matched_writers_.end(), wproxy));
         }
 
         if (wproxy != nullptr)
@@ -488,13 +485,8 @@ bool StatefulReader::matched_writer_is_matched(
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     if (is_alive_)
     {
-        for (WriterProxy* it : matched_writers_)
-        {
-            if (it->guid() == writer_guid && it->is_alive())
-            {
-                return true;
-            }
-        }
+        WriterProxy* writer = matched_writers_by_guid_.find(writer_guid);
+        return nullptr != writer && writer->is_alive();
     }
 
     return false;
@@ -534,13 +526,11 @@ bool StatefulReader::findWriterProxy(
 {
     assert(WP);
 
-    for (WriterProxy* it : matched_writers_)
+    WriterProxy* writer = matched_writers_by_guid_.find(writerGUID);
+    if (nullptr != writer && writer->is_alive())
     {
-        if (it->guid() == writerGUID && it->is_alive())
-        {
-            *WP = it;
-            return true;
-        }
+        *WP = writer;
+        return true;
     }
     return false;
 }
@@ -995,13 +985,11 @@ bool StatefulReader::acceptMsgFrom(
 {
     assert(wp != nullptr);
 
-    for (WriterProxy* it : matched_writers_)
+    WriterProxy* writer = matched_writers_by_guid_.find(writerId);
+    if (nullptr != writer && writer->is_alive())
     {
-        if (it->guid() == writerId && it->is_alive())
-        {
-            *wp = it;
-            return true;
-        }
+        *wp = writer;
+        return true;
     }
 
     // Check if it's a framework's one. In this case, accept_messages_from_unkown_writers_
@@ -1536,6 +1524,15 @@ bool StatefulReader::matched_writers_guids(
     return true;
 }
 
+void StatefulReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    BaseReader::get_memory_usage(usage);
+    usage.matched_proxies.elements = matched_writers_.size() + matched_writers_pool_.size();
+    usage.matched_proxies.bytes = usage.matched_proxies.elements * sizeof(WriterProxy);
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool StatefulReader::get_connections(
@@ -29,6 +29,7 @@
 #include <fastdds/rtps/reader/RTPSReader.hpp>
 #include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
+#include <rtps/common/ProxiesByGuid.hpp>
 #include <rtps/reader/BaseReader.hpp>
 
 namespace eprosima {
@@ -321,6 +322,9 @@ public:
     bool matched_writers_guids(
             std::vector<GUID_t>& guids) const final;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const final;
+
 #ifdef FASTDDS_STATISTICS
     bool get_connections(
             fastdds::statistics::rtps::ConnectionList& connection_list) override;
@@ -377,6 +381,8 @@ private:
     ResourceLimitedVector<WriterProxy*> matched_writers_;
     //! Vector containing pointers to all the inactive, ready for reuse, WriterProxies.
     ResourceLimitedVector<WriterProxy*> matched_writers_pool_;
+    //! Index of the active WriterProxies by GUID, used to find them on the reception path.
+    ProxiesByGuid<WriterProxy> matched_writers_by_guid_;
     //!
     ResourceLimitedContainerConfig proxy_changes_config_;
     //! True to disable positive ACKs
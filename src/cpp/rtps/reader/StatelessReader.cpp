@@ -545,6 +545,15 @@ bool StatelessReader::matched_writers_guids(
     return true;
 }
 
+void StatelessReader::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    BaseReader::get_memory_usage(usage);
+    usage.matched_proxies.elements = matched_writers_.capacity();
+    usage.matched_proxies.bytes = usage.matched_proxies.elements * sizeof(RemoteWriterInfo_t);
+}
+
 #ifdef FASTDDS_STATISTICS
 
 bool StatelessReader::get_connections(
@@ -240,6 +240,9 @@ public:
     bool matched_writers_guids(
             std::vector<GUID_t>& guids) const final;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const final;
+
 #ifdef FASTDDS_STATISTICS
     bool get_connections(
             fastdds::statistics::rtps::ConnectionList& connection_list) override;
@@ -45,7 +45,10 @@ ChannelResource::ChannelResource(
     : message_buffer_(rec_buffer_size)
     , alive_(true)
 {
-    memset(message_buffer_.buffer, 0, rec_buffer_size);
+    if (nullptr != message_buffer_.buffer)
+    {
+        memset(message_buffer_.buffer, 0, rec_buffer_size);
+    }
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, "Created with CDRMessage of size: " << message_buffer_.max_size);
 }
 
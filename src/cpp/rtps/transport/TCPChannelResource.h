@@ -15,6 +15,8 @@
 #ifndef _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 #define _FASTDDS_TCP_CHANNEL_RESOURCE_BASE_
 
+#include <functional>
+
 #include "../network/asio.hpp"
 #include <fastdds/rtps/transport/TCPTransportDescriptor.hpp>
 #include <fastdds/rtps/transport/TransportReceiverInterface.hpp>
@@ -74,6 +76,9 @@ protected:
     std::recursive_mutex pending_logical_mutex_;
     std::atomic<eConnectionStatus> connection_status_;
 
+    //! Incremented each time the channel starts being serviced by the reactor threads of the transport.
+    std::atomic<uint32_t> async_listen_generation_{0};
+
 public:
 
     void add_logical_port(
@@ -147,6 +152,25 @@ public:
             std::size_t size,
             asio::error_code& ec) = 0;
 
+    //! Handler called when an asynchronous read finishes, with the error and the number of bytes read.
+    using AsyncReadHandler = std::function<void (const asio::error_code&, std::size_t)>;
+
+    /**
+     * Reads exactly @c size bytes without blocking the calling thread.
+     * The handler is called from one of the threads running the io_context of the channel.
+     * @param buffer Buffer where the data is written. It must be kept alive until the handler is called.
+     * @param size Number of bytes to read.
+     * @param handler Handler called when the read finishes.
+     */
+    virtual void async_read(
+            octet* buffer,
+            std::size_t size,
+            const AsyncReadHandler& handler)
+    {
+        static_cast<void>(buffer);
+        handler(asio::error::operation_not_supported, 0);
+    }
+
     /**
      * Sends the provided TCP header and data over the TCP channel.
      * Used solely during TCP connection negotiations.
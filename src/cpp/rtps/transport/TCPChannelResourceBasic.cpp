@@ -17,6 +17,7 @@
 #include <array>
 #include <future>
 #include <mutex>
+#include <vector>
 
 #include "../network/asio.hpp"
 #include <fastdds/utils/IPLocator.hpp>
@@ -129,6 +130,27 @@ uint32_t TCPChannelResourceBasic::read(
     return 0;
 }
 
+void TCPChannelResourceBasic::async_read(
+        octet* buffer,
+        std::size_t size,
+        const AsyncReadHandler& handler)
+{
+    if (connected())
+    {
+        // Only the initiation is protected, so close() does not have to wait for the read to finish.
+        std::unique_lock<std::mutex> read_lock(read_mutex_);
+        asio::async_read(*socket_, asio::buffer(buffer, size), transfer_exactly(size), handler);
+    }
+    else
+    {
+        AsyncReadHandler not_connected_handler = handler;
+        asio::post(context_, [not_connected_handler]()
+                {
+                    not_connected_handler(asio::error::not_connected, 0);
+                });
+    }
+}
+
 size_t TCPChannelResourceBasic::send(
         const octet* header,
         size_t header_size,
@@ -148,8 +170,10 @@ size_t TCPChannelResourceBasic::send(
             return 0;
         }
 
-        // Use a list of const_buffers to send the message
-        std::list<asio::const_buffer> asio_buffers;
+        // Use a vector of const_buffers to send the message, so the gather list is built with a single allocation.
+        // Payloads are referenced, not copied, and kept alive by the caller until this call returns.
+        std::vector<asio::const_buffer> asio_buffers;
+        asio_buffers.reserve(buffers.size() + 1);
         if (header_size > 0)
         {
             asio_buffers.push_back(asio::buffer(header, header_size));
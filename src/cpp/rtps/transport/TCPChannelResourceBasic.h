@@ -59,6 +59,11 @@ public:
             std::size_t size,
             asio::error_code& ec) override;
 
+    void async_read(
+            octet* buffer,
+            std::size_t size,
+            const AsyncReadHandler& handler) override;
+
     size_t send(
             const octet* header,
             size_t header_size,
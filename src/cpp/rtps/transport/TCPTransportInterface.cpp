@@ -90,6 +90,7 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , check_crc(true)
     , apply_security(false)
     , non_blocking_send(false)
+    , reactor_threads(0)
 {
 }
 
@@ -111,6 +112,7 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
     , non_blocking_send(t.non_blocking_send)
+    , reactor_threads(t.reactor_threads)
 {
 }
 
@@ -133,6 +135,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
     non_blocking_send = t.non_blocking_send;
+    reactor_threads = t.reactor_threads;
     return *this;
 }
 
@@ -154,6 +157,7 @@ bool TCPTransportDescriptor::operator ==(
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->reactor_threads == t.reactor_threads &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -243,6 +247,15 @@ void TCPTransportInterface::clean()
         io_context_.stop();
         io_context_thread_.join();
     }
+
+    for (auto& reactor_thread : reactor_threads_)
+    {
+        if (reactor_thread.joinable())
+        {
+            reactor_thread.join();
+        }
+    }
+    reactor_threads_.clear();
 }
 
 Locator TCPTransportInterface::remote_endpoint_to_locator(
@@ -562,6 +575,13 @@ bool TCPTransportInterface::init(
         rtcp_message_manager_ = std::make_shared<RTCPMessageManager>(this);
     }
 
+    reactor_enabled_ = 0 < configuration()->reactor_threads;
+    if (reactor_enabled_ && configuration()->apply_security)
+    {
+        EPROSIMA_LOG_WARNING(TRANSPORT_TCP, "reactor_threads is not applied when TLS is enabled.");
+        reactor_enabled_ = false;
+    }
+
     auto ioContextFunction = [&]()
             {
                 asio::executor_work_guard<asio::io_context::executor_type> work = make_work_guard(io_context_);
@@ -569,6 +589,19 @@ bool TCPTransportInterface::init(
             };
     io_context_thread_ = create_thread(ioContextFunction, configuration()->accept_thread, "dds.tcp_accept");
 
+    if (reactor_enabled_)
+    {
+        // The accept thread is one of the reactor threads.
+        // Bursts on many connections may need more buffers, but only one per thread is kept afterwards.
+        reactor_buffers_ = std::make_shared<ReceiveBufferPool>(configuration()->maxMessageSize,
+                        configuration()->reactor_threads);
+        for (uint16_t i = 1; i < configuration()->reactor_threads; ++i)
+        {
+            reactor_threads_.push_back(create_thread(ioContextFunction, configuration()->accept_thread,
+                    "dds.tcp_rx.%u", i));
+        }
+    }
+
     if (0 < configuration()->keep_alive_frequency_ms)
     {
         EPROSIMA_LOG_WARNING(RTCP, "Keep alive feature only available in Fast DDS Pro.");
@@ -872,11 +905,11 @@ bool TCPTransportInterface::OpenOutputChannel(
                 (configuration()->apply_security) ?
                 static_cast<TCPChannelResource*>(
                     new TCPChannelResourceSecure(this, io_context_, ssl_context_,
-                    physical_locator, configuration()->maxMessageSize)) :
+                    physical_locator, channel_message_buffer_size())) :
 #endif // if TLS_FOUND
                 static_cast<TCPChannelResource*>(
                     new TCPChannelResourceBasic(this, io_context_, physical_locator,
-                    configuration()->maxMessageSize))
+                    channel_message_buffer_size()))
                 );
 
             channel_resources_[physical_locator] = channel;
@@ -994,11 +1027,11 @@ bool TCPTransportInterface::CreateInitialConnect(
         (configuration()->apply_security) ?
         static_cast<TCPChannelResource*>(
             new TCPChannelResourceSecure(this, io_context_, ssl_context_,
-            physical_locator, configuration()->maxMessageSize)) :
+            physical_locator, channel_message_buffer_size())) :
 #endif // if TLS_FOUND
         static_cast<TCPChannelResource*>(
             new TCPChannelResourceBasic(this, io_context_, physical_locator,
-            configuration()->maxMessageSize))
+            channel_message_buffer_size()))
         );
 
     EPROSIMA_LOG_INFO(RTCP, "CreateInitialConnect: [CONNECT] @ " << IPLocator::to_string(locator));
@@ -1059,6 +1092,12 @@ bool TCPTransportInterface::OpenInputChannel(
 void TCPTransportInterface::create_listening_thread(
         const std::shared_ptr<TCPChannelResource>& channel)
 {
+    if (reactor_enabled_)
+    {
+        start_async_listen_operation(channel);
+        return;
+    }
+
     std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
     auto fn = [this, channel_weak_ptr, rtcp_manager_weak_ptr]()
@@ -1075,35 +1114,9 @@ void TCPTransportInterface::perform_listen_operation(
         std::weak_ptr<RTCPMessageManager> rtcp_manager)
 {
     Locator remote_locator;
-    uint16_t logicalPort(0);
-    std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
     std::shared_ptr<TCPChannelResource> channel;
-    rtcp_message_manager = rtcp_manager.lock();
-
-    // RTCP Control Message
-    if (rtcp_message_manager)
-    {
-        channel = channel_weak.lock();
-
-        if (channel)
-        {
-            remote_locator = remote_endpoint_to_locator(channel);
-
-            if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
-            {
-                rtcp_message_manager->sendConnectionRequest(channel);
-            }
-            else
-            {
-                channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
-            }
-        }
 
-        std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-        rtcp_message_manager.reset();
-        rtcp_message_manager_cv_.notify_one();
-    }
-    else
+    if (!begin_listen_operation(channel_weak, rtcp_manager, channel, remote_locator))
     {
         return;
     }
@@ -1121,28 +1134,80 @@ void TCPTransportInterface::perform_listen_operation(
         if (channel->connected())
         {
             // Processes the data through the CDR Message interface.
-            logicalPort = IPLocator::getLogicalPort(remote_locator);
-            std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
-            auto it = receiver_resources_.find(logicalPort);
-            if (it != receiver_resources_.end())
-            {
-                TransportReceiverInterface* receiver = it->second.first;
-                ReceiverInUseCV* receiver_in_use = it->second.second;
-                receiver_in_use->in_use++;
-                scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
-                scopedLock.lock();
-                receiver_in_use->in_use--;
-                receiver_in_use->cv.notify_one();
-            }
-            else
-            {
-                EPROSIMA_LOG_WARNING(RTCP,
-                        "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
-            }
+            deliver_received_message(channel, msg.buffer, msg.length, remote_locator);
+        }
+    }
+
+    end_listen_operation(channel_weak, channel);
+}
+
+bool TCPTransportInterface::begin_listen_operation(
+        const std::weak_ptr<TCPChannelResource>& channel_weak,
+        const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        Locator& remote_locator)
+{
+    std::shared_ptr<RTCPMessageManager> rtcp_message_manager = rtcp_manager.lock();
+
+    // RTCP Control Message
+    if (!rtcp_message_manager)
+    {
+        return false;
+    }
+
+    channel = channel_weak.lock();
+
+    if (channel)
+    {
+        remote_locator = remote_endpoint_to_locator(channel);
+
+        if (channel->tcp_connection_type() == TCPChannelResource::TCPConnectionType::TCP_CONNECT_TYPE)
+        {
+            rtcp_message_manager->sendConnectionRequest(channel);
         }
+        else
+        {
+            channel->change_status(TCPChannelResource::eConnectionStatus::eWaitingForBind);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+    rtcp_message_manager.reset();
+    rtcp_message_manager_cv_.notify_one();
+    return true;
+}
+
+void TCPTransportInterface::deliver_received_message(
+        const std::shared_ptr<TCPChannelResource>& channel,
+        const octet* buffer,
+        uint32_t length,
+        const Locator& remote_locator)
+{
+    uint16_t logicalPort = IPLocator::getLogicalPort(remote_locator);
+    std::unique_lock<std::mutex> scopedLock(sockets_map_mutex_);
+    auto it = receiver_resources_.find(logicalPort);
+    if (it != receiver_resources_.end())
+    {
+        TransportReceiverInterface* receiver = it->second.first;
+        ReceiverInUseCV* receiver_in_use = it->second.second;
+        receiver_in_use->in_use++;
+        scopedLock.unlock();
+        receiver->OnDataReceived(buffer, length, channel->locator(), remote_locator);
+        scopedLock.lock();
+        receiver_in_use->in_use--;
+        receiver_in_use->cv.notify_one();
+    }
+    else
+    {
+        EPROSIMA_LOG_WARNING(RTCP,
+                "Received Message, but no TransportReceiverInterface attached: " << logicalPort);
     }
+}
 
+void TCPTransportInterface::end_listen_operation(
+        const std::weak_ptr<TCPChannelResource>& channel_weak,
+        std::shared_ptr<TCPChannelResource>& channel)
+{
     EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
 
     // If we get here, the channel has been disconnected. We might need to clean it up if
@@ -1384,54 +1449,8 @@ bool TCPTransportInterface::Receive(
 
                 if (success)
                 {
-                    if (configuration()->check_crc
-                            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
-                    {
-                        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
-                    }
-
-                    if (tcp_header.logical_port == 0)
-                    {
-                        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
-                        if (!channel->disconnected())
-                        {
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager = rtcp_manager.lock();
-                        }
-
-                        if (rtcp_message_manager)
-                        {
-                            // The channel is not going to be deleted because we lock it for reading.
-                            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
-                                channel, receive_buffer, body_size, msg_endian);
-
-                            if (responseCode != RETCODE_OK)
-                            {
-                                close_tcp_socket(channel);
-                            }
-                            success = false;
-
-                            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
-                            rtcp_message_manager.reset();
-                            rtcp_message_manager_cv_.notify_one();
-                        }
-                        else
-                        {
-                            success = false;
-                            close_tcp_socket(channel);
-                        }
-
-                    }
-                    else
-                    {
-                        if (!IsLocatorValid(remote_locator))
-                        {
-                            remote_locator = remote_endpoint_to_locator(channel);
-                        }
-                        IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
-                        EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
-                                                                          << " - " << receive_buffer_size << " bytes.");
-                    }
+                    success = process_received_message(rtcp_manager, channel, tcp_header, receive_buffer,
+                                    receive_buffer_size, msg_endian, remote_locator);
                 }
                 // Error message already shown by read_body method.
             }
@@ -1463,6 +1482,351 @@ bool TCPTransportInterface::Receive(
     return success;
 }
 
+bool TCPTransportInterface::process_received_message(
+        std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+        std::shared_ptr<TCPChannelResource>& channel,
+        const TCPHeader& tcp_header,
+        octet* receive_buffer,
+        uint32_t receive_buffer_size,
+        fastdds::rtps::Endianness_t msg_endian,
+        Locator& remote_locator)
+{
+    if (configuration()->check_crc
+            && !check_crc(tcp_header, receive_buffer, receive_buffer_size))
+    {
+        EPROSIMA_LOG_WARNING(RTCP_MSG_IN, "Bad TCP header CRC");
+    }
+
+    if (tcp_header.logical_port == 0)
+    {
+        std::shared_ptr<RTCPMessageManager> rtcp_message_manager;
+        if (!channel->disconnected())
+        {
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager = rtcp_manager.lock();
+        }
+
+        if (rtcp_message_manager)
+        {
+            // The channel is not going to be deleted because we lock it for reading.
+            ResponseCode responseCode = rtcp_message_manager->processRTCPMessage(
+                channel, receive_buffer, receive_buffer_size, msg_endian);
+
+            if (responseCode != RETCODE_OK)
+            {
+                close_tcp_socket(channel);
+            }
+
+            std::unique_lock<std::mutex> lock(rtcp_message_manager_mutex_);
+            rtcp_message_manager.reset();
+            rtcp_message_manager_cv_.notify_one();
+        }
+        else
+        {
+            close_tcp_socket(channel);
+        }
+
+        return false;
+    }
+
+    if (!IsLocatorValid(remote_locator))
+    {
+        remote_locator = remote_endpoint_to_locator(channel);
+    }
+    IPLocator::setLogicalPort(remote_locator, tcp_header.logical_port);
+    EPROSIMA_LOG_INFO(RTCP_MSG_IN, "[RECEIVE] From: " << remote_locator \
+                                                      << " - " << receive_buffer_size << " bytes.");
+    return true;
+}
+
+struct TCPTransportInterface::AsyncReceiveState
+{
+    //! Part of the message being read.
+    enum Step
+    {
+        SYNC,   // Looking for the RTCP sync characters.
+        HEADER, // Reading the rest of the TCP header.
+        BODY,   // Reading the body of the message.
+        DROP    // Discarding the body of a message that does not fit in the receive buffer.
+    };
+
+    ~AsyncReceiveState()
+    {
+        release_message();
+    }
+
+    //! Prepares the reception of the next message.
+    void reset()
+    {
+        release_message();
+        memset(tcp_header.address(), 0, sizeof(TCPHeader));
+        step = SYNC;
+        header_bytes = 0;
+        body_size = 0;
+    }
+
+    void release_message()
+    {
+        if (message)
+        {
+            buffers->release(std::move(message));
+        }
+    }
+
+    std::weak_ptr<TCPChannelResource> channel;
+    std::weak_ptr<RTCPMessageManager> rtcp_manager;
+    std::shared_ptr<ReceiveBufferPool> buffers;
+    //! Listen operation of the channel this state belongs to.
+    uint32_t generation = 0;
+    Locator remote_locator;
+    TCPHeader tcp_header;
+    Step step = SYNC;
+    //! Bytes of tcp_header already read.
+    size_t header_bytes = 0;
+    //! Bytes of the body still to be read (DROP) or to be read (BODY).
+    size_t body_size = 0;
+    //! Receive buffer taken from the pool while the body is being read.
+    std::unique_ptr<CDRMessage_t> message;
+};
+
+std::unique_ptr<CDRMessage_t> TCPTransportInterface::ReceiveBufferPool::acquire()
+{
+    std::unique_ptr<CDRMessage_t> buffer;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_buffers_.empty())
+        {
+            buffer = std::move(free_buffers_.back());
+            free_buffers_.pop_back();
+        }
+    }
+
+    if (!buffer)
+    {
+        buffer.reset(new CDRMessage_t(buffer_size_));
+    }
+
+    fastdds::rtps::CDRMessage::initCDRMsg(buffer.get());
+    return buffer;
+}
+
+void TCPTransportInterface::ReceiveBufferPool::release(
+        std::unique_ptr<CDRMessage_t>&& buffer)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_buffers_.size() < max_free_buffers_)
+        {
+            free_buffers_.push_back(std::move(buffer));
+            return;
+        }
+    }
+
+    // Freed outside the lock
+    buffer.reset();
+}
+
+void TCPTransportInterface::start_async_listen_operation(
+        const std::shared_ptr<TCPChannelResource>& channel)
+{
+    std::shared_ptr<AsyncReceiveState> state = std::make_shared<AsyncReceiveState>();
+    state->channel = channel;
+    state->rtcp_manager = rtcp_message_manager_;
+    state->buffers = reactor_buffers_;
+    state->generation = ++channel->async_listen_generation_;
+    state->reset();
+
+    // The connection request is sent from a reactor thread, so the caller is not blocked.
+    asio::post(io_context_, [this, state]()
+            {
+                std::shared_ptr<TCPChannelResource> channel;
+                bool started = begin_listen_operation(state->channel, state->rtcp_manager, channel,
+                state->remote_locator);
+                if (started && channel)
+                {
+                    async_receive(state);
+                }
+            });
+}
+
+void TCPTransportInterface::async_receive(
+        const std::shared_ptr<AsyncReceiveState>& state)
+{
+    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+    if (!channel || state->generation != channel->async_listen_generation_)
+    {
+        // The channel was released, or it reconnected and is serviced by a new listen operation.
+        return;
+    }
+
+    if (!channel->connected())
+    {
+        end_listen_operation(state->channel, channel);
+        return;
+    }
+
+    octet* buffer = nullptr;
+    size_t size = 0;
+
+    switch (state->step)
+    {
+        case AsyncReceiveState::SYNC:
+            buffer = state->tcp_header.address() + state->header_bytes;
+            size = 4 - state->header_bytes;
+            break;
+        case AsyncReceiveState::HEADER:
+            buffer = state->tcp_header.address() + state->header_bytes;
+            size = TCPHeader::size() - state->header_bytes;
+            break;
+        case AsyncReceiveState::BODY:
+            buffer = state->message->buffer;
+            size = state->body_size;
+            break;
+        case AsyncReceiveState::DROP:
+            buffer = state->message->buffer;
+            size = std::min(state->body_size, static_cast<size_t>(state->message->max_size));
+            break;
+    }
+
+    channel->async_read(buffer, size, [this, state](const asio::error_code& ec, std::size_t bytes_read)
+            {
+                on_async_receive(state, ec, bytes_read);
+            });
+}
+
+void TCPTransportInterface::on_async_receive(
+        const std::shared_ptr<AsyncReceiveState>& state,
+        const asio::error_code& ec,
+        std::size_t bytes_read)
+{
+    std::shared_ptr<TCPChannelResource> channel = state->channel.lock();
+    if (!channel || state->generation != channel->async_listen_generation_)
+    {
+        return;
+    }
+
+    try
+    {
+        if (ec)
+        {
+            if (ec != asio::error::operation_aborted && !channel->disconnected())
+            {
+                if (AsyncReceiveState::BODY == state->step || AsyncReceiveState::DROP == state->step)
+                {
+                    EPROSIMA_LOG_WARNING(RTCP, "Error reading RTCP body: " << ec.message());
+                }
+                else if (ec != asio::error::eof)
+                {
+                    EPROSIMA_LOG_WARNING(DEBUG, "Failed to read TCP header: " << ec.message());
+                }
+            }
+
+            // The socket cannot be read anymore.
+            close_tcp_socket(channel);
+            state->reset();
+            end_listen_operation(state->channel, channel);
+            return;
+        }
+        else
+        {
+            switch (state->step)
+            {
+                case AsyncReceiveState::SYNC:
+                {
+                    TCPHeader& tcp_header = state->tcp_header;
+                    state->header_bytes += bytes_read;
+                    if (4 == state->header_bytes)
+                    {
+                        size_t skip =                                 // Same search as receive_header
+                                (tcp_header.rtcp[0] != 'R') ? 1 :
+                                (tcp_header.rtcp[1] != 'T') ? 1 :
+                                (tcp_header.rtcp[2] != 'C') ? 2 :
+                                (tcp_header.rtcp[3] != 'P') ? 3 : 0;
+
+                        if (skip)
+                        {
+                            octet* ptr = tcp_header.address();
+                            memmove(ptr, &ptr[skip], 4 - skip);
+                            state->header_bytes -= skip;
+                        }
+                        else
+                        {
+                            state->step = AsyncReceiveState::HEADER;
+                        }
+                    }
+                    break;
+                }
+                case AsyncReceiveState::HEADER:
+                {
+                    state->header_bytes += bytes_read;
+                    if (TCPHeader::size() == state->header_bytes)
+                    {
+                        state->message = state->buffers->acquire();
+                        TCPHeader& tcp_header = state->tcp_header;
+                        tcp_header.valid_endianness(state->message->msg_endian);
+
+                        if (tcp_header.length < TCPHeader::size())
+                        {
+                            EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "Invalid TCP header length: " << tcp_header.length);
+                            close_tcp_socket(channel);
+                            state->reset();
+                            break;
+                        }
+
+                        state->body_size = tcp_header.length - static_cast<uint32_t>(TCPHeader::size());
+                        if (state->body_size > state->message->max_size)
+                        {
+                            EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "Size of incoming TCP message is bigger than buffer "
+                                    << "capacity: " << static_cast<uint32_t>(state->body_size) << " vs. "
+                                    << state->message->max_size << ". The full message will be dropped.");
+                            state->step = AsyncReceiveState::DROP;
+                        }
+                        else
+                        {
+                            EPROSIMA_LOG_INFO(RTCP_MSG_IN, "Received RTCP MSG. Logical Port "
+                                    << tcp_header.logical_port);
+                            state->step = AsyncReceiveState::BODY;
+                        }
+                    }
+                    break;
+                }
+                case AsyncReceiveState::BODY:
+                {
+                    CDRMessage_t& msg = *state->message;
+                    msg.length = static_cast<uint32_t>(bytes_read);
+                    if (process_received_message(state->rtcp_manager, channel, state->tcp_header, msg.buffer,
+                            msg.length, msg.msg_endian, state->remote_locator) &&
+                            0 < msg.length && channel->connected())
+                    {
+                        // Runs the receiver on this reactor thread, see TCPTransportDescriptor::reactor_threads
+                        deliver_received_message(channel, msg.buffer, msg.length, state->remote_locator);
+                    }
+                    state->reset();
+                    break;
+                }
+                case AsyncReceiveState::DROP:
+                {
+                    state->body_size -= bytes_read;
+                    if (0 == state->body_size)
+                    {
+                        state->reset();
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    catch (const asio::system_error& error)
+    {
+        (void)error;
+        EPROSIMA_LOG_ERROR(RTCP_MSG_IN, "ASIO SYSTEM_ERROR [RECEIVE]: " << error.what());
+        close_tcp_socket(channel);
+        state->reset();
+    }
+
+    async_receive(state);
+}
+
 bool TCPTransportInterface::send(
         const std::vector<NetworkBuffer>& buffers,
         uint32_t total_bytes,
@@ -1646,7 +2010,7 @@ void TCPTransportInterface::SocketAccepted(
         {
             // Always create a new channel, it might be replaced later in bind_socket()
             std::shared_ptr<TCPChannelResource> channel(new TCPChannelResourceBasic(this,
-                    io_context_, socket, configuration()->maxMessageSize));
+                    io_context_, socket, channel_message_buffer_size()));
 
             {
                 std::unique_lock<std::mutex> unbound_lock(unbound_map_mutex_);
@@ -1690,7 +2054,7 @@ void TCPTransportInterface::SecureSocketAccepted(
         {
             // Always create a new secure_channel, it might be replaced later in bind_socket()
             std::shared_ptr<TCPChannelResource> secure_channel(new TCPChannelResourceSecure(this,
-                    io_context_, ssl_context_, socket, configuration()->maxMessageSize));
+                    io_context_, ssl_context_, socket, channel_message_buffer_size()));
 
             {
                 std::unique_lock<std::mutex> unbound_lock(unbound_map_mutex_);
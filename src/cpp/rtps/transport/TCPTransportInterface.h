@@ -30,6 +30,7 @@
 #include "../network/asio.hpp"
 #include <asio/steady_timer.hpp>
 
+#include <fastdds/rtps/common/CDRMessage_t.hpp>
 #include <fastdds/rtps/common/LocatorWithMask.hpp>
 #include <fastdds/rtps/transport/network/AllowedNetworkInterface.hpp>
 #include <fastdds/rtps/transport/network/NetmaskFilterKind.hpp>
@@ -81,6 +82,43 @@ class TCPTransportInterface : public TransportInterface
         std::condition_variable cv;
     };
 
+    /**
+     * Pool of receive buffers shared by the channels serviced by the reactor threads, so a connection only holds a
+     * receive buffer while it is reading the body of a message.
+     */
+    class ReceiveBufferPool
+    {
+    public:
+
+        ReceiveBufferPool(
+                uint32_t buffer_size,
+                size_t max_free_buffers)
+            : buffer_size_(buffer_size)
+            , max_free_buffers_(max_free_buffers)
+        {
+        }
+
+        //! Takes a buffer from the pool, allocating a new one when the pool is empty.
+        std::unique_ptr<CDRMessage_t> acquire();
+
+        //! Returns a buffer to the pool, or frees it when the pool already keeps the maximum number of buffers.
+        void release(
+                std::unique_ptr<CDRMessage_t>&& buffer);
+
+    private:
+
+        uint32_t buffer_size_;
+
+        size_t max_free_buffers_;
+
+        std::mutex mutex_;
+
+        std::vector<std::unique_ptr<CDRMessage_t>> free_buffers_;
+    };
+
+    //! State of the asynchronous reception of a channel serviced by the reactor threads.
+    struct AsyncReceiveState;
+
     std::atomic<bool> alive_;
 
     using TransportInterface::transform_remote_locator;
@@ -96,6 +134,12 @@ protected:
     asio::ssl::context ssl_context_;
 #endif // if TLS_FOUND
     eprosima::thread io_context_thread_;
+    //! Whether channels are serviced asynchronously by the reactor threads instead of a thread per channel.
+    bool reactor_enabled_ = false;
+    //! Threads running io_context_ together with io_context_thread_ when the reactor is enabled.
+    std::vector<eprosima::thread> reactor_threads_;
+    //! Receive buffers of the channels serviced by the reactor threads.
+    std::shared_ptr<ReceiveBufferPool> reactor_buffers_;
     std::shared_ptr<RTCPMessageManager> rtcp_message_manager_;
     std::mutex rtcp_message_manager_mutex_;
     std::condition_variable rtcp_message_manager_cv_;
@@ -175,6 +219,56 @@ protected:
             std::weak_ptr<TCPChannelResource> channel,
             std::weak_ptr<RTCPMessageManager> rtcp_manager);
 
+    /**
+     * Starts the listen operation of a channel, requesting the connection or waiting for the bind request.
+     * @return false when the transport is being destroyed.
+     */
+    bool begin_listen_operation(
+            const std::weak_ptr<TCPChannelResource>& channel_weak,
+            const std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            Locator& remote_locator);
+
+    //! Delivers a received message to the receiver attached to its logical port.
+    void deliver_received_message(
+            const std::shared_ptr<TCPChannelResource>& channel,
+            const octet* buffer,
+            uint32_t length,
+            const Locator& remote_locator);
+
+    //! Finishes the listen operation of a disconnected channel, releasing it when it was accepted.
+    void end_listen_operation(
+            const std::weak_ptr<TCPChannelResource>& channel_weak,
+            std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Starts servicing a channel from the reactor threads.
+    void start_async_listen_operation(
+            const std::shared_ptr<TCPChannelResource>& channel);
+
+    //! Requests the next asynchronous read of a channel serviced by the reactor threads.
+    void async_receive(
+            const std::shared_ptr<AsyncReceiveState>& state);
+
+    //! Processes the completion of an asynchronous read of a channel serviced by the reactor threads.
+    void on_async_receive(
+            const std::shared_ptr<AsyncReceiveState>& state,
+            const asio::error_code& ec,
+            std::size_t bytes_read);
+
+    /**
+     * Processes a message whose body has been read: checks its CRC and handles it when it is an RTCP control
+     * message.
+     * @return true when the message has to be delivered to the receiver of its logical port.
+     */
+    bool process_received_message(
+            std::weak_ptr<RTCPMessageManager>& rtcp_manager,
+            std::shared_ptr<TCPChannelResource>& channel,
+            const TCPHeader& tcp_header,
+            octet* receive_buffer,
+            uint32_t receive_buffer_size,
+            Endianness_t msg_endian,
+            Locator& remote_locator);
+
     bool read_body(
             octet* receive_buffer,
             uint32_t receive_buffer_capacity,
@@ -235,6 +329,12 @@ protected:
     void create_listening_thread(
             const std::shared_ptr<TCPChannelResource>& channel);
 
+    //! Size of the receive buffer of new channels. Channels serviced by the reactor threads use reactor_buffers_.
+    uint32_t channel_message_buffer_size() const
+    {
+        return reactor_enabled_ ? 0 : configuration()->maxMessageSize;
+    }
+
 public:
 
     friend class RTCPMessageManager;
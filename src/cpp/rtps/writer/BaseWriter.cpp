@@ -53,6 +53,7 @@
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/DataSharing/WriterPool.hpp>
 #include <rtps/flowcontrol/FlowController.hpp>
+#include <rtps/history/HistoryMemoryUsage.hpp>
 #include <rtps/participant/RTPSParticipantImpl.hpp>
 #include <rtps/writer/LocatorSelectorSender.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
@@ -145,6 +146,21 @@ int32_t BaseWriter::get_transport_priority() const
     return transport_priority_;
 }
 
+void BaseWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+
+    usage = EndpointMemoryUsage();
+    fill_history_memory_usage(history_->getHistorySize(), history_->get_change_pool(), history_->get_payload_pool(),
+            usage);
+}
+
+uint64_t BaseWriter::get_flow_controller_deadline_misses() const
+{
+    return flow_controller_->get_deadline_misses(const_cast<BaseWriter*>(this));
+}
+
 void BaseWriter::update_attributes(
         const WriterAttributes& att)
 {
@@ -171,6 +187,17 @@ void BaseWriter::set_enabled_statistics_writers_mask(
     set_enabled_statistics_writers_mask_impl(enabled_writers);
 }
 
+void BaseWriter::set_statistics_counters_aggregation(
+        bool aggregate)
+{
+    set_statistics_counters_aggregation_impl(aggregate);
+}
+
+void BaseWriter::publish_statistics_counters()
+{
+    publish_statistics_counters_impl();
+}
+
 #endif // FASTDDS_STATISTICS
 
 uint32_t BaseWriter::get_max_allowed_payload_size()
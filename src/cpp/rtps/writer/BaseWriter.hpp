@@ -82,6 +82,11 @@ public:
 
     int32_t get_transport_priority() const final;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const override;
+
+    uint64_t get_flow_controller_deadline_misses() const final;
+
     void update_attributes(
             const WriterAttributes& att) override;
 
@@ -98,6 +103,20 @@ public:
     void set_enabled_statistics_writers_mask(
             uint32_t enabled_writers) final;
 
+    /**
+     * @brief Select whether the statistics counters of this writer are reported on every event or only when
+     * publish_statistics_counters is called.
+     *
+     * @param aggregate true to only report the counters periodically.
+     */
+    void set_statistics_counters_aggregation(
+            bool aggregate);
+
+    /**
+     * @brief Report the statistics counters of this writer that changed since the last call.
+     */
+    void publish_statistics_counters();
+
 #endif // FASTDDS_STATISTICS
 
     //^^^^^^^^^^^^^^^^^^^^^^^ [Exported API] ^^^^^^^^^^^^^^^^^^^^^^^
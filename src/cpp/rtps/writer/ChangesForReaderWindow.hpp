@@ -0,0 +1,812 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ChangesForReaderWindow.hpp
+ */
+
+#ifndef RTPS_WRITER__CHANGESFORREADERWINDOW_HPP
+#define RTPS_WRITER__CHANGESFORREADERWINDOW_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+#include <fastdds/rtps/common/CacheChange.hpp>
+#include <fastdds/rtps/common/FragmentNumber.hpp>
+#include <fastdds/rtps/common/SequenceNumber.hpp>
+#include <fastdds/utils/collections/ResourceLimitedContainerConfig.hpp>
+
+#include <rtps/writer/ChangeForReader.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Compact state of the changes of a writer with respect to a remote reader.
+ *
+ * The changes are kept sorted by sequence number in a sliding window. Each change only takes its sequence number and
+ * the pointer to the CacheChange_t. Its status and delivery flags are kept on bitmaps, one bit per change, so the
+ * operations affecting many changes (acknowledgements, nack supression, acknack responses) work on whole words.
+ * The state of the fragments is only kept for fragmented changes.
+ *
+ * Changes are addressed by their position in the window. Positions are invalidated by any method modifying the
+ * window, except the ones changing the status or the fragments of a change.
+ *
+ * @ingroup WRITER_MODULE
+ */
+class ChangesForReaderWindow
+{
+public:
+
+    /**
+     * Constructor.
+     * @param allocation Allocation limits for the number of changes in the window.
+     * The memory of the window never grows beyond the one needed for the maximum number of changes.
+     * @param track_times Whether to keep the time of the first sending of each change.
+     */
+    ChangesForReaderWindow(
+            const ResourceLimitedContainerConfig& allocation,
+            bool track_times)
+        : max_changes_(allocation.maximum)
+        , increment_((std::max)(allocation.increment, size_t(1u)))
+        , track_times_(track_times)
+    {
+        size_t initial = (std::min)(allocation.initial, allocation.maximum);
+        entries_.reserve(initial);
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            plane.reserve(words_for(initial));
+        }
+        if (track_times_)
+        {
+            times_.reserve(initial);
+        }
+    }
+
+    //! @return Whether there are no changes in the window.
+    bool empty() const
+    {
+        return entries_.size() == head_;
+    }
+
+    //! @return Number of changes in the window.
+    size_t size() const
+    {
+        return entries_.size() - head_;
+    }
+
+    //! Removes all the changes from the window.
+    void clear()
+    {
+        head_ = 0;
+        entries_.clear();
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            plane.clear();
+        }
+        times_.clear();
+        fragmented_.clear();
+    }
+
+    //! @return Position of the first change.
+    size_t begin() const
+    {
+        return head_;
+    }
+
+    //! @return Position after the last change.
+    size_t end() const
+    {
+        return entries_.size();
+    }
+
+    /**
+     * @param seq_num Sequence number to look for.
+     * @return Position of the first change with a sequence number not less than seq_num. end() if there is none.
+     */
+    size_t lower_bound(
+            const SequenceNumber_t& seq_num) const
+    {
+        if (empty() || entries_.back().seq_num < seq_num)
+        {
+            return end();
+        }
+
+        // Fast path: the window has no holes between the first change and the one looked for.
+        SequenceNumber_t first = entries_[head_].seq_num;
+        if (seq_num <= first)
+        {
+            return head_;
+        }
+        uint64_t offset = seq_num.to64long() - first.to64long();
+        if (offset < size() && entries_[head_ + static_cast<size_t>(offset)].seq_num == seq_num)
+        {
+            return head_ + static_cast<size_t>(offset);
+        }
+
+        auto it = std::lower_bound(entries_.begin() + static_cast<std::ptrdiff_t>(head_), entries_.end(), seq_num,
+                        [](const Entry& entry, const SequenceNumber_t& value)
+                        {
+                            return entry.seq_num < value;
+                        });
+        return static_cast<size_t>(it - entries_.begin());
+    }
+
+    /**
+     * @param seq_num Sequence number to look for.
+     * @return Position of the change with the given sequence number. end() if there is none.
+     */
+    size_t find(
+            const SequenceNumber_t& seq_num) const
+    {
+        size_t pos = lower_bound(seq_num);
+        return (end() != pos && entries_[pos].seq_num == seq_num) ? pos : end();
+    }
+
+    const SequenceNumber_t& sequence_number(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        return entries_[pos].seq_num;
+    }
+
+    CacheChange_t* change(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        return entries_[pos].change;
+    }
+
+    ChangeForReaderStatus_t status(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        for (size_t plane = 0; plane < NUM_STATUS_PLANES; ++plane)
+        {
+            if (test_bit(planes_[plane], pos))
+            {
+                return static_cast<ChangeForReaderStatus_t>(plane + 1);
+            }
+        }
+        return UNSENT;
+    }
+
+    void status(
+            size_t pos,
+            ChangeForReaderStatus_t status)
+    {
+        assert(pos >= head_ && pos < end());
+        for (size_t plane = 0; plane < NUM_STATUS_PLANES; ++plane)
+        {
+            clear_bit(planes_[plane], pos);
+        }
+        if (UNSENT != status)
+        {
+            set_bit(planes_[status_plane(status)], pos);
+        }
+    }
+
+    /**
+     * @param status Status to look for.
+     * @return Whether there is a change with the given status. status cannot be UNSENT.
+     */
+    bool any(
+            ChangeForReaderStatus_t status) const
+    {
+        assert(UNSENT != status);
+        const std::vector<uint64_t>& plane = planes_[status_plane(status)];
+        for (size_t word = head_ / BITS_PER_WORD; word < plane.size(); ++word)
+        {
+            if (0 != plane[word])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Changes the status of all the changes with a given status.
+     * @param previous Status to change. Cannot be UNSENT.
+     * @param next Status to adopt.
+     * @param func Functor called with the position of each change which changed its status.
+     * @return Number of changes which changed their status.
+     */
+    template<typename Functor>
+    uint32_t convert_status(
+            ChangeForReaderStatus_t previous,
+            ChangeForReaderStatus_t next,
+            Functor func)
+    {
+        assert(UNSENT != previous);
+        assert(previous != next);
+
+        std::vector<uint64_t>& from = planes_[status_plane(previous)];
+        std::vector<uint64_t>* to = (UNSENT == next) ? nullptr : &planes_[status_plane(next)];
+        uint32_t changed = 0;
+        for (size_t word = head_ / BITS_PER_WORD; word < from.size(); ++word)
+        {
+            uint64_t bits = from[word];
+            if (0 == bits)
+            {
+                continue;
+            }
+
+            from[word] = 0;
+            if (nullptr != to)
+            {
+                (*to)[word] |= bits;
+            }
+
+            while (0 != bits)
+            {
+                ++changed;
+                func(word * BITS_PER_WORD + lowest_bit_set(bits));
+                bits &= bits - 1u;
+            }
+        }
+        return changed;
+    }
+
+    /**
+     * Looks for the end of a run of acknowledged changes with consecutive sequence numbers.
+     * @param pos Position of the first change of the run.
+     * @param seq_num Sequence number the change at pos should have for the run to start.
+     * @return Position after the last change of the run. pos if the run is empty.
+     */
+    size_t acknowledged_run_end(
+            size_t pos,
+            const SequenceNumber_t& seq_num) const
+    {
+        if (end() == pos || entries_[pos].seq_num != seq_num)
+        {
+            return pos;
+        }
+
+        // First change not acknowledged.
+        const std::vector<uint64_t>& acked = planes_[status_plane(ACKNOWLEDGED)];
+        size_t run_end = end();
+        for (size_t word = pos / BITS_PER_WORD; word < acked.size(); ++word)
+        {
+            uint64_t bits = ~acked[word];
+            if (word == pos / BITS_PER_WORD)
+            {
+                bits &= ~low_mask(pos % BITS_PER_WORD);
+            }
+            if (0 != bits)
+            {
+                run_end = (std::min)(run_end, word * BITS_PER_WORD + lowest_bit_set(bits));
+                break;
+            }
+        }
+        if (run_end == pos)
+        {
+            return pos;
+        }
+
+        // The run also stops on the first hole in the sequence numbers.
+        uint64_t first = seq_num.to64long();
+        if (entries_[run_end - 1].seq_num.to64long() - first != run_end - 1 - pos)
+        {
+            auto it = std::partition_point(entries_.begin() + static_cast<std::ptrdiff_t>(pos),
+                            entries_.begin() + static_cast<std::ptrdiff_t>(run_end),
+                            [&](const Entry& entry)
+                            {
+                                return entry.seq_num.to64long() - first ==
+                                static_cast<uint64_t>(&entry - &entries_[pos]);
+                            });
+            run_end = static_cast<size_t>(it - entries_.begin());
+        }
+        return run_end;
+    }
+
+    /**
+     * Adds a change after the last one.
+     * @param change Change to add. Its sequence number should be greater than the one of the last change.
+     * @return false when the maximum number of changes was reached, true otherwise.
+     */
+    bool push_back(
+            const ChangeForReader_t& change)
+    {
+        assert(empty() || entries_.back().seq_num < change.getSequenceNumber());
+        return insert_at(end(), change);
+    }
+
+    /**
+     * Adds a change keeping the window sorted.
+     * @param change Change to add. There should not be another change with the same sequence number.
+     * @return false when the maximum number of changes was reached, true otherwise.
+     */
+    bool insert(
+            const ChangeForReader_t& change)
+    {
+        size_t pos = lower_bound(change.getSequenceNumber());
+        assert(end() == pos || entries_[pos].seq_num != change.getSequenceNumber());
+        return insert_at(pos, change);
+    }
+
+    /**
+     * Removes a change.
+     * @param pos Position of the change to remove.
+     */
+    void erase(
+            size_t pos)
+    {
+        assert(pos >= head_ && pos < end());
+        if (head_ == pos)
+        {
+            erase_front(pos + 1);
+            return;
+        }
+
+        remove_fragmented(entries_[pos].seq_num);
+        entries_.erase(entries_.begin() + static_cast<std::ptrdiff_t>(pos));
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            remove_bit(plane, pos);
+            plane.resize(words_for(entries_.size()));
+        }
+        if (track_times_)
+        {
+            times_.erase(times_.begin() + static_cast<std::ptrdiff_t>(pos));
+        }
+    }
+
+    /**
+     * Removes all the changes before a position.
+     * @param pos Position of the first change to keep.
+     */
+    void erase_front(
+            size_t pos)
+    {
+        assert(pos >= head_ && pos <= end());
+        if (end() == pos)
+        {
+            clear();
+            return;
+        }
+
+        auto fragmented_end = std::lower_bound(fragmented_.begin(), fragmented_.end(), entries_[pos].seq_num,
+                        [](const ChangeForReader_t& fragmented, const SequenceNumber_t& value)
+                        {
+                            return fragmented.getSequenceNumber() < value;
+                        });
+        fragmented_.erase(fragmented_.begin(), fragmented_end);
+
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            clear_bits(plane, head_, pos);
+        }
+        head_ = pos;
+
+        // Discard the space of removed changes once it is at least half of the window.
+        if (head_ >= BITS_PER_WORD && head_ >= size())
+        {
+            discard_head((head_ / BITS_PER_WORD) * BITS_PER_WORD);
+        }
+    }
+
+    //! @return Whether the change was delivered, at least once, to all its fragments.
+    bool has_been_delivered(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        return test_bit(planes_[DELIVERED_PLANE], pos);
+    }
+
+    void set_delivered(
+            size_t pos)
+    {
+        assert(pos >= head_ && pos < end());
+        set_first_send_time(pos);
+        set_bit(planes_[DELIVERED_PLANE], pos);
+        ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        if (nullptr != fragmented)
+        {
+            fragmented->set_delivered();
+        }
+    }
+
+    FragmentNumber_t next_unsent_fragment(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        const ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        return (nullptr != fragmented) ? fragmented->get_next_unsent_fragment() :
+               entries_[pos].change->getFragmentCount() + 1;
+    }
+
+    FragmentNumberSet_t unsent_fragments(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        const ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        return (nullptr != fragmented) ? fragmented->getUnsentFragments() : FragmentNumberSet_t();
+    }
+
+    void mark_all_fragments_as_unsent(
+            size_t pos)
+    {
+        assert(pos >= head_ && pos < end());
+        ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        if (nullptr != fragmented)
+        {
+            fragmented->markAllFragmentsAsUnsent();
+        }
+    }
+
+    /**
+     * Marks a fragment as sent.
+     * @param pos Position of the change.
+     * @param frag_num Fragment number to mark as sent.
+     * @return Whether there are no more fragments pending to be sent.
+     */
+    bool mark_fragment_as_sent(
+            size_t pos,
+            FragmentNumber_t frag_num)
+    {
+        assert(pos >= head_ && pos < end());
+        set_first_send_time(pos);
+        ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        if (nullptr == fragmented)
+        {
+            return true;
+        }
+        fragmented->markFragmentsAsSent(frag_num);
+        return fragmented->getUnsentFragments().empty();
+    }
+
+    void mark_fragments_as_unsent(
+            size_t pos,
+            const FragmentNumberSet_t& frag_set)
+    {
+        assert(pos >= head_ && pos < end());
+        ChangeForReader_t* fragmented = find_fragmented(entries_[pos].seq_num);
+        if (nullptr != fragmented)
+        {
+            fragmented->markFragmentsAsUnsent(frag_set);
+        }
+    }
+
+    /**
+     * @return Time since the change was first sent, or since it was added if it was not sent yet.
+     * Zero when the window does not track times.
+     */
+    std::chrono::steady_clock::duration time_since_first_send(
+            size_t pos) const
+    {
+        assert(pos >= head_ && pos < end());
+        if (!track_times_)
+        {
+            return std::chrono::steady_clock::duration::zero();
+        }
+        return std::chrono::steady_clock::now() - times_[pos];
+    }
+
+private:
+
+    struct Entry
+    {
+        SequenceNumber_t seq_num;
+        CacheChange_t* change;
+    };
+
+    //! There is one bit plane for each status except UNSENT, and then the delivery flags.
+    static constexpr size_t NUM_STATUS_PLANES = 4u;
+    static constexpr size_t DELIVERED_PLANE = NUM_STATUS_PLANES;
+    static constexpr size_t SENT_PLANE = NUM_STATUS_PLANES + 1u;
+    static constexpr size_t NUM_PLANES = NUM_STATUS_PLANES + 2u;
+
+    static constexpr size_t BITS_PER_WORD = 64u;
+
+    static size_t status_plane(
+            ChangeForReaderStatus_t status)
+    {
+        assert(UNSENT != status);
+        return static_cast<size_t>(status) - 1u;
+    }
+
+    static size_t words_for(
+            size_t bits)
+    {
+        return bits / BITS_PER_WORD + ((0u == bits % BITS_PER_WORD) ? 0u : 1u);
+    }
+
+    /**
+     * Makes room for a number of elements on a collection, growing its capacity geometrically but never beyond
+     * the given maximum.
+     */
+    template<typename T>
+    void reserve(
+            std::vector<T>& collection,
+            size_t needed,
+            size_t maximum) const
+    {
+        if (needed > collection.capacity())
+        {
+            size_t capacity = (std::max)(collection.capacity() + increment_, 2u * collection.capacity());
+            collection.reserve((std::max)(needed, (std::min)(capacity, maximum)));
+        }
+    }
+
+    static uint64_t low_mask(
+            size_t bits)
+    {
+        return (0u == bits) ? 0u : ((~uint64_t(0u)) >> (BITS_PER_WORD - bits));
+    }
+
+    static size_t lowest_bit_set(
+            uint64_t bits)
+    {
+        assert(0u != bits);
+#if _MSC_VER
+        unsigned long bit;
+        if (_BitScanForward(&bit, static_cast<unsigned long>(bits)))
+        {
+            return bit;
+        }
+        _BitScanForward(&bit, static_cast<unsigned long>(bits >> 32u));
+        return 32u + bit;
+#else
+        return static_cast<size_t>(__builtin_ctzll(bits));
+#endif // if _MSC_VER
+    }
+
+    static bool test_bit(
+            const std::vector<uint64_t>& plane,
+            size_t pos)
+    {
+        return 0u != (plane[pos / BITS_PER_WORD] & (uint64_t(1u) << (pos % BITS_PER_WORD)));
+    }
+
+    static void set_bit(
+            std::vector<uint64_t>& plane,
+            size_t pos)
+    {
+        plane[pos / BITS_PER_WORD] |= uint64_t(1u) << (pos % BITS_PER_WORD);
+    }
+
+    static void clear_bit(
+            std::vector<uint64_t>& plane,
+            size_t pos)
+    {
+        plane[pos / BITS_PER_WORD] &= ~(uint64_t(1u) << (pos % BITS_PER_WORD));
+    }
+
+    //! Clears the bits on positions [from, to).
+    static void clear_bits(
+            std::vector<uint64_t>& plane,
+            size_t from,
+            size_t to)
+    {
+        while (from < to)
+        {
+            size_t word = from / BITS_PER_WORD;
+            size_t first_bit = from % BITS_PER_WORD;
+            size_t last_bit = (std::min)(size_t(BITS_PER_WORD), first_bit + (to - from));
+            plane[word] &= ~(low_mask(last_bit) & ~low_mask(first_bit));
+            from += last_bit - first_bit;
+        }
+    }
+
+    //! Inserts a zero bit on a position, moving the following bits up. The plane should have room for the new bit.
+    static void insert_bit(
+            std::vector<uint64_t>& plane,
+            size_t pos)
+    {
+        size_t word = pos / BITS_PER_WORD;
+        for (size_t i = plane.size() - 1u; i > word; --i)
+        {
+            plane[i] = (plane[i] << 1u) | (plane[i - 1u] >> (BITS_PER_WORD - 1u));
+        }
+        uint64_t mask = low_mask(pos % BITS_PER_WORD);
+        plane[word] = (plane[word] & mask) | ((plane[word] & ~mask) << 1u);
+    }
+
+    //! Removes the first bits of a plane, moving the following bits down.
+    static void remove_low_bits(
+            std::vector<uint64_t>& plane,
+            size_t count)
+    {
+        size_t words = (std::min)(count / BITS_PER_WORD, plane.size());
+        plane.erase(plane.begin(), plane.begin() + static_cast<std::ptrdiff_t>(words));
+        size_t bits = count % BITS_PER_WORD;
+        if (0u != bits)
+        {
+            for (size_t i = 0; i < plane.size(); ++i)
+            {
+                plane[i] >>= bits;
+                if (i + 1u < plane.size())
+                {
+                    plane[i] |= plane[i + 1u] << (BITS_PER_WORD - bits);
+                }
+            }
+        }
+    }
+
+    //! Removes the bit on a position, moving the following bits down.
+    static void remove_bit(
+            std::vector<uint64_t>& plane,
+            size_t pos)
+    {
+        size_t word = pos / BITS_PER_WORD;
+        uint64_t mask = low_mask(pos % BITS_PER_WORD);
+        plane[word] = (plane[word] & mask) | ((plane[word] >> 1u) & ~mask);
+        for (size_t i = word + 1u; i < plane.size(); ++i)
+        {
+            plane[i - 1u] |= (plane[i] & 1u) << (BITS_PER_WORD - 1u);
+            plane[i] >>= 1u;
+        }
+    }
+
+    bool insert_at(
+            size_t pos,
+            const ChangeForReader_t& change)
+    {
+        if (size() >= max_changes_)
+        {
+            return false;
+        }
+
+        // The limit also applies to the removed changes not discarded yet, so the memory stays bounded.
+        if (entries_.size() >= max_changes_)
+        {
+            pos -= head_;
+            discard_head(head_);
+        }
+
+        CacheChange_t* cache_change = change.getChange();
+        reserve(entries_, entries_.size() + 1u, max_changes_);
+        entries_.insert(entries_.begin() + static_cast<std::ptrdiff_t>(pos),
+                Entry{change.getSequenceNumber(), cache_change});
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            reserve(plane, words_for(entries_.size()), words_for(max_changes_));
+            plane.resize(words_for(entries_.size()), 0u);
+            insert_bit(plane, pos);
+        }
+        if (UNSENT != change.getStatus())
+        {
+            set_bit(planes_[status_plane(change.getStatus())], pos);
+        }
+        if (change.has_been_delivered())
+        {
+            set_bit(planes_[DELIVERED_PLANE], pos);
+        }
+        if (track_times_)
+        {
+            reserve(times_, times_.size() + 1u, max_changes_);
+            times_.insert(times_.begin() + static_cast<std::ptrdiff_t>(pos), std::chrono::steady_clock::now());
+        }
+
+        if (nullptr != cache_change && 0 != cache_change->getFragmentSize())
+        {
+            auto it = std::lower_bound(fragmented_.begin(), fragmented_.end(), change.getSequenceNumber(),
+                            [](const ChangeForReader_t& fragmented, const SequenceNumber_t& value)
+                            {
+                                return fragmented.getSequenceNumber() < value;
+                            });
+            size_t index = static_cast<size_t>(it - fragmented_.begin());
+            reserve(fragmented_, fragmented_.size() + 1u, max_changes_);
+            fragmented_.insert(fragmented_.begin() + static_cast<std::ptrdiff_t>(index), change);
+        }
+
+        return true;
+    }
+
+    //! Discards the first changes, which should have been removed already.
+    void discard_head(
+            size_t count)
+    {
+        assert(count <= head_);
+        entries_.erase(entries_.begin(), entries_.begin() + static_cast<std::ptrdiff_t>(count));
+        for (std::vector<uint64_t>& plane : planes_)
+        {
+            remove_low_bits(plane, count);
+            plane.resize(words_for(entries_.size()));
+        }
+        if (track_times_)
+        {
+            times_.erase(times_.begin(), times_.begin() + static_cast<std::ptrdiff_t>(count));
+        }
+        head_ -= count;
+    }
+
+    //! @return Index on fragmented_ of the change with the given sequence number. fragmented_.size() if there is none.
+    size_t fragmented_index(
+            const SequenceNumber_t& seq_num) const
+    {
+        auto it = std::lower_bound(fragmented_.begin(), fragmented_.end(), seq_num,
+                        [](const ChangeForReader_t& fragmented, const SequenceNumber_t& value)
+                        {
+                            return fragmented.getSequenceNumber() < value;
+                        });
+        return (fragmented_.end() != it && it->getSequenceNumber() == seq_num) ?
+               static_cast<size_t>(it - fragmented_.begin()) : fragmented_.size();
+    }
+
+    ChangeForReader_t* find_fragmented(
+            const SequenceNumber_t& seq_num)
+    {
+        size_t index = fragmented_index(seq_num);
+        return (fragmented_.size() != index) ? &fragmented_[index] : nullptr;
+    }
+
+    const ChangeForReader_t* find_fragmented(
+            const SequenceNumber_t& seq_num) const
+    {
+        size_t index = fragmented_index(seq_num);
+        return (fragmented_.size() != index) ? &fragmented_[index] : nullptr;
+    }
+
+    void remove_fragmented(
+            const SequenceNumber_t& seq_num)
+    {
+        size_t index = fragmented_index(seq_num);
+        if (fragmented_.size() != index)
+        {
+            fragmented_.erase(fragmented_.begin() + static_cast<std::ptrdiff_t>(index));
+        }
+    }
+
+    void set_first_send_time(
+            size_t pos)
+    {
+        if (track_times_ && !test_bit(planes_[SENT_PLANE], pos))
+        {
+            set_bit(planes_[SENT_PLANE], pos);
+            times_[pos] = std::chrono::steady_clock::now();
+        }
+    }
+
+    //! Maximum number of changes in the window, including the removed ones not discarded yet.
+    size_t max_changes_;
+
+    //! Minimum number of elements added to the capacity of the collections when they grow.
+    size_t increment_;
+
+    //! Whether the time of the first sending of each change is kept.
+    bool track_times_;
+
+    //! Position of the first change. Previous entries are discarded lazily.
+    size_t head_ = 0;
+
+    //! Changes sorted by sequence number.
+    std::vector<Entry> entries_;
+
+    //! Bit planes with the status and the delivery flags of each change.
+    std::array<std::vector<uint64_t>, NUM_PLANES> planes_;
+
+    //! Time each change was first sent, or added while it was not sent. Only used when tracking times.
+    std::vector<std::chrono::steady_clock::time_point> times_;
+
+    //! State of the fragments of the fragmented changes, sorted by sequence number.
+    std::vector<ChangeForReader_t> fragmented_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // RTPS_WRITER__CHANGESFORREADERWINDOW_HPP
@@ -83,6 +83,12 @@ void PersistentWriter::remove_persistent_change(
     persistence_->remove_writer_change_from_storage(persistence_guid_, *change);
 }
 
+bool PersistentWriter::flush_persistent_changes(
+        const std::chrono::steady_clock::time_point& max_blocking_time)
+{
+    return persistence_->flush(max_blocking_time);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
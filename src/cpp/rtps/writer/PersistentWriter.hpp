@@ -19,6 +19,7 @@
 #ifndef RTPS_WRITER__PERSISTENTWRITER_HPP
 #define RTPS_WRITER__PERSISTENTWRITER_HPP
 
+#include <chrono>
 #include <string>
 
 #include <fastdds/rtps/writer/RTPSWriter.hpp>
@@ -64,6 +65,14 @@ public:
     void remove_persistent_change(
             CacheChange_t* change);
 
+    /**
+     * Wait until all previously added or removed changes are durably stored.
+     * @param max_blocking_time Maximum time point to wait for the changes to be stored.
+     * @return True if the changes were stored before @c max_blocking_time.
+     */
+    bool flush_persistent_changes(
+            const std::chrono::steady_clock::time_point& max_blocking_time);
+
 private:
 
     //!Persistence service
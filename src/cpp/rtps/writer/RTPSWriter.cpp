@@ -41,6 +41,21 @@ RTPSWriter::~RTPSWriter()
 {
 }
 
+void RTPSWriter::get_memory_usage(
+        EndpointMemoryUsage& /*usage*/) const
+{
+}
+
+uint64_t RTPSWriter::get_merged_repairs_count() const
+{
+    return 0;
+}
+
+uint64_t RTPSWriter::get_flow_controller_deadline_misses() const
+{
+    return 0;
+}
+
 }  // namespace rtps
 }  // namespace fastdds
 }  // namespace eprosima
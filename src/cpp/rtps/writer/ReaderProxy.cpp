@@ -56,7 +56,7 @@ ReaderProxy::ReaderProxy(
     , is_reliable_(false)
     , disable_positive_acks_(false)
     , writer_(writer)
-    , changes_for_reader_(resource_limits_from_history(writer->get_history()->m_att, 0))
+    , changes_for_reader_(resource_limits_from_history(writer->get_history()->m_att, 0), nullptr != stateful_listener)
     , nack_supression_event_(nullptr)
     , initial_heartbeat_event_(nullptr)
     , timers_enabled_(false)
@@ -236,8 +236,6 @@ void ReaderProxy::add_change(
 {
     SequenceNumber_t seq_num {change.getSequenceNumber()};
     assert(seq_num > changes_low_mark_);
-    assert(changes_for_reader_.empty() ? true :
-            seq_num > changes_for_reader_.back().getSequenceNumber());
 
     // Irrelevant changes are not added to the collection
     if (!is_relevant)
@@ -264,7 +262,7 @@ void ReaderProxy::add_change(
         return;
     }
 
-    if (changes_for_reader_.push_back(change) == nullptr)
+    if (!changes_for_reader_.push_back(change))
     {
         // This should never happen
         EPROSIMA_LOG_ERROR(RTPS_READER_PROXY, "Error adding change " << seq_num
@@ -287,15 +285,15 @@ bool ReaderProxy::change_is_acked(
         return true;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    size_t pos = changes_for_reader_.find(seq_num);
+    if (pos == changes_for_reader_.end())
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed, or was not relevant.
         return true;
     }
 
-    return chit->getStatus() == ACKNOWLEDGED;
+    return changes_for_reader_.status(pos) == ACKNOWLEDGED;
 }
 
 bool ReaderProxy::change_is_unsent(
@@ -310,31 +308,31 @@ bool ReaderProxy::change_is_unsent(
         return false;
     }
 
-    ChangeConstIterator chit = find_change(seq_num);
-    if (chit == changes_for_reader_.end())
+    size_t pos = changes_for_reader_.find(seq_num);
+    if (pos == changes_for_reader_.end())
     {
         // There is a hole in changes_for_reader_
         // This means a change was removed.
         return false;
     }
 
-    bool returned_value = chit->getStatus() == UNSENT;
+    bool returned_value = changes_for_reader_.status(pos) == UNSENT;
 
     if (returned_value)
     {
-        next_unsent_frag = chit->get_next_unsent_fragment();
+        next_unsent_frag = changes_for_reader_.next_unsent_fragment(pos);
         gap_seq = SequenceNumber_t::unknown();
 
-        if (is_reliable_ && !chit->has_been_delivered())
+        if (is_reliable_ && !changes_for_reader_.has_been_delivered(pos))
         {
             need_reactivate_periodic_heartbeat |= true;
             SequenceNumber_t prev =
-                    (changes_for_reader_.begin() != chit ?
-                    std::prev(chit)->getSequenceNumber() :
+                    (changes_for_reader_.begin() != pos ?
+                    changes_for_reader_.sequence_number(pos - 1) :
                     changes_low_mark_
                     ) + 1;
 
-            if (prev != chit->getSequenceNumber())
+            if (prev != seq_num)
             {
                 gap_seq = prev;
 
@@ -382,23 +380,18 @@ void ReaderProxy::acked_changes_set(
 
     if (seq_num > changes_low_mark_)
     {
-        ChangeIterator chit = find_change(seq_num, false);
+        size_t first_pos = changes_for_reader_.lower_bound(seq_num);
         // continue advancing until next change is not acknowledged
-        while (chit != changes_for_reader_.end()
-                && chit->getSequenceNumber() == future_low_mark
-                && chit->getStatus() == ACKNOWLEDGED)
-        {
-            ++chit;
-            ++future_low_mark;
-        }
+        size_t end_pos = changes_for_reader_.acknowledged_run_end(first_pos, future_low_mark);
+        future_low_mark = future_low_mark + static_cast<uint32_t>(end_pos - first_pos);
         if (stateful_writer_listener_ != nullptr)
         {
-            for (auto it = changes_for_reader_.begin(); it != chit; ++it)
+            for (size_t pos = changes_for_reader_.begin(); pos != end_pos; ++pos)
             {
-                notify_acknowledged(*it);
+                notify_acknowledged(pos);
             }
         }
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        changes_for_reader_.erase_front(end_pos);
     }
     else
     {
@@ -419,17 +412,16 @@ void ReaderProxy::acked_changes_set(
                 }
                 future_low_mark = current_sequence;
 
-                bool should_sort = false;
                 for (; current_sequence <= changes_low_mark_; ++current_sequence)
                 {
                     // Skip all consecutive changes already in the collection
-                    ChangeConstIterator it = find_change(current_sequence);
-                    while ( it != changes_for_reader_.end() &&
+                    size_t pos = changes_for_reader_.find(current_sequence);
+                    while ( pos != changes_for_reader_.end() &&
                             current_sequence <= changes_low_mark_ &&
-                            it->getSequenceNumber() == current_sequence)
+                            changes_for_reader_.sequence_number(pos) == current_sequence)
                     {
                         ++current_sequence;
-                        ++it;
+                        ++pos;
                     }
 
                     if (current_sequence <= changes_low_mark_)
@@ -437,18 +429,13 @@ void ReaderProxy::acked_changes_set(
                         CacheChange_t* change = nullptr;
                         if (writer_->get_history()->get_change(current_sequence, writer_->getGuid(), &change))
                         {
-                            should_sort = true;
+                            // The window keeps the changes sorted by sequence number
                             ChangeForReader_t cr(change);
                             cr.setStatus(UNACKNOWLEDGED);
-                            changes_for_reader_.push_back(cr);
+                            changes_for_reader_.insert(cr);
                         }
                     }
                 }
-                // Keep changes sorted by sequence number
-                if (should_sort)
-                {
-                    std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
-                }
             }
             else if (!is_local_reader())
             {
@@ -470,13 +457,13 @@ bool ReaderProxy::requested_changes_set(
     {
         seq_num_set.for_each([&](SequenceNumber_t sit)
                 {
-                    ChangeIterator chit = find_change(sit, true);
-                    if (chit != changes_for_reader_.end())
+                    size_t pos = changes_for_reader_.find(sit);
+                    if (pos != changes_for_reader_.end())
                     {
-                        if (UNACKNOWLEDGED == chit->getStatus())
+                        if (UNACKNOWLEDGED == changes_for_reader_.status(pos))
                         {
-                            chit->setStatus(REQUESTED);
-                            chit->markAllFragmentsAsUnsent();
+                            changes_for_reader_.status(pos, REQUESTED);
+                            changes_for_reader_.mark_all_fragments_as_unsent(pos);
                             isSomeoneWasSetRequested = true;
                         }
                     }
@@ -513,7 +500,7 @@ bool ReaderProxy::requested_changes_set(
 }
 
 bool ReaderProxy::process_initial_acknack(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     if (is_local_reader())
     {
@@ -541,25 +528,25 @@ void ReaderProxy::from_unsent_to_status(
 
     // Called when delivering an UNSENT sample, the seq_number must exists in the ReaderProxy.
     assert(seq_num > changes_low_mark_);
-    ChangeIterator it = find_change(seq_num, true);
-    assert(changes_for_reader_.end() != it);
-    assert(UNSENT == it->getStatus());
+    size_t pos = changes_for_reader_.find(seq_num);
+    assert(changes_for_reader_.end() != pos);
+    assert(UNSENT == changes_for_reader_.status(pos));
     assert(UNSENT != status);
 
     if (ACKNOWLEDGED == status && seq_num == changes_low_mark_ + 1)
     {
-        assert(changes_for_reader_.begin() == it);
-        notify_acknowledged(*it);
-        changes_for_reader_.erase(it);
+        assert(changes_for_reader_.begin() == pos);
+        notify_acknowledged(pos);
+        changes_for_reader_.erase(pos);
         acked_changes_set(seq_num + 1);
         return;
     }
 
-    it->setStatus(status);
+    changes_for_reader_.status(pos, status);
 
     if (delivered)
     {
-        it->set_delivered();
+        changes_for_reader_.set_delivered(pos);
     }
 }
 
@@ -576,13 +563,12 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
     }
 
     bool change_found = false;
-    ChangeIterator it = find_change(seq_num, true);
+    size_t pos = changes_for_reader_.find(seq_num);
 
-    if (it != changes_for_reader_.end())
+    if (pos != changes_for_reader_.end())
     {
         change_found = true;
-        it->markFragmentsAsSent(frag_num);
-        was_last_fragment = it->getUnsentFragments().empty();
+        was_last_fragment = changes_for_reader_.mark_fragment_as_sent(pos, frag_num);
     }
 
     return change_found;
@@ -594,7 +580,7 @@ bool ReaderProxy::perform_nack_supression()
 }
 
 uint32_t ReaderProxy::perform_acknack_response(
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     return convert_status_on_all_changes(REQUESTED, UNSENT, nullptr != stateful_writer_listener_, func);
 }
@@ -603,61 +589,54 @@ uint32_t ReaderProxy::convert_status_on_all_changes(
         ChangeForReaderStatus_t previous,
         ChangeForReaderStatus_t next,
         bool notify_resend,
-        const std::function<void(ChangeForReader_t& change)>& func)
+        const std::function<void(CacheChange_t* change)>& func)
 {
     assert(previous > next);
 
     // NOTE: This is only called for REQUESTED=>UNSENT (acknack response) or
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
-    uint32_t changed = 0;
-    for (ChangeForReader_t& change : changes_for_reader_)
-    {
-        if (change.getStatus() == previous)
-        {
-            ++changed;
-            change.setStatus(next);
-
-            if (notify_resend)
-            {
-                notify_resent(change);
-            }
+    return changes_for_reader_.convert_status(previous, next,
+                   [this, notify_resend, &func](size_t pos)
+                   {
+                       if (notify_resend)
+                       {
+                           notify_resent(pos);
+                       }
 
-            if (func)
-            {
-                func(change);
-            }
-        }
-    }
-
-    return changed;
+                       if (func)
+                       {
+                           func(changes_for_reader_.change(pos));
+                       }
+                   });
 }
 
 void ReaderProxy::change_has_been_removed(
         const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (changes_for_reader_.empty() ||
+            seq_num < changes_for_reader_.sequence_number(changes_for_reader_.begin()))
     {
         return;
     }
 
-    auto chit = find_change(seq_num);
+    size_t pos = changes_for_reader_.find(seq_num);
 
-    if (chit == this->changes_for_reader_.end())
+    if (pos == changes_for_reader_.end())
     {
         // No change for this sequence number
         return;
     }
 
     // In intraprocess, if there is an UNACKNOWLEDGED, a GAP has to be send because there is no reliable mechanism.
-    if (is_local_reader() && ACKNOWLEDGED > chit->getStatus())
+    if (is_local_reader() && ACKNOWLEDGED > changes_for_reader_.status(pos))
     {
         writer_->intraprocess_gap(this, seq_num);
     }
 
     // Element may not be in the container when marked as irrelevant.
-    changes_for_reader_.erase(chit);
+    changes_for_reader_.erase(pos);
 
     // When removing the next-to-be-acknowledged, we should auto-acknowledge it.
     if ((changes_low_mark_ + 1) == seq_num)
@@ -674,15 +653,7 @@ bool ReaderProxy::has_unacknowledged(
         return true;
     }
 
-    for (const ChangeForReader_t& it : changes_for_reader_)
-    {
-        if (it.getStatus() == UNACKNOWLEDGED)
-        {
-            return true;
-        }
-    }
-
-    return false;
+    return changes_for_reader_.any(UNACKNOWLEDGED);
 }
 
 bool ReaderProxy::requested_fragment_set(
@@ -690,18 +661,18 @@ bool ReaderProxy::requested_fragment_set(
         const FragmentNumberSet_t& frag_set)
 {
     // Locate the outbound change referenced by the NACK_FRAG
-    ChangeIterator changeIter = find_change(seq_num, true);
-    if (changeIter == changes_for_reader_.end())
+    size_t pos = changes_for_reader_.find(seq_num);
+    if (pos == changes_for_reader_.end())
     {
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    changes_for_reader_.mark_fragments_as_unsent(pos, frag_set);
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (changeIter->getStatus() != UNSENT)
+    if (changes_for_reader_.status(pos) != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        changes_for_reader_.status(pos, REQUESTED);
     }
 
     return true;
@@ -728,40 +699,6 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
-static bool change_less_than_sequence(
-        const ChangeForReader_t& change,
-        const SequenceNumber_t& seq_num)
-{
-    return change.getSequenceNumber() < seq_num;
-}
-
-ReaderProxy::ChangeIterator ReaderProxy::find_change(
-        const SequenceNumber_t& seq_num,
-        bool exact)
-{
-    ReaderProxy::ChangeIterator it;
-    ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return (!exact)
-           ? it
-           : it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
-}
-
-ReaderProxy::ChangeConstIterator ReaderProxy::find_change(
-        const SequenceNumber_t& seq_num) const
-{
-    ReaderProxy::ChangeConstIterator it;
-    ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
-
-    return it == end
-           ? it
-           : it->getSequenceNumber() == seq_num ? it : end;
-}
-
 bool ReaderProxy::has_been_delivered(
         const SequenceNumber_t& seq_number,
         bool& found) const
@@ -772,44 +709,44 @@ bool ReaderProxy::has_been_delivered(
         return true;
     }
 
-    ChangeConstIterator it = find_change(seq_number);
-    if (it != changes_for_reader_.end())
+    size_t pos = changes_for_reader_.find(seq_number);
+    if (pos != changes_for_reader_.end())
     {
         found = true;
-        return it->has_been_delivered();
+        return changes_for_reader_.has_been_delivered(pos);
     }
 
     return false;
 }
 
 void ReaderProxy::notify_acknowledged(
-        const ChangeForReader_t& change) const
+        size_t pos) const
 {
     if (stateful_writer_listener_ != nullptr)
     {
-        CacheChange_t* sample = change.getChange();
+        CacheChange_t* sample = changes_for_reader_.change(pos);
         uint32_t payload_length = sample ? sample->serializedPayload.length : 0;
         stateful_writer_listener_->on_writer_data_acknowledged(
             writer_->getGuid(),
             guid(),
-            change.getSequenceNumber(),
+            changes_for_reader_.sequence_number(pos),
             payload_length,
-            change.time_since_first_send(),
+            changes_for_reader_.time_since_first_send(pos),
             locator_info_.general_locator_selector_entry());
     }
 }
 
 void ReaderProxy::notify_resent(
-        const ChangeForReader_t& change) const
+        size_t pos) const
 {
     assert (stateful_writer_listener_ != nullptr);
 
-    const CacheChange_t* sample = change.getChange();
+    const CacheChange_t* sample = changes_for_reader_.change(pos);
     assert(sample != nullptr);
 
     // Calc number of bytes to resend
     uint64_t resent_bytes = 0;
-    const FragmentNumberSet_t& fragments = change.getUnsentFragments();
+    const FragmentNumberSet_t fragments = changes_for_reader_.unsent_fragments(pos);
     if (fragments.empty())
     {
         resent_bytes = sample->serializedPayload.length;
@@ -34,6 +34,7 @@
 
 #include <rtps/builtin/data/ReaderProxyData.hpp>
 #include <rtps/writer/ChangeForReader.hpp>
+#include <rtps/writer/ChangesForReaderWindow.hpp>
 #include <rtps/writer/ReaderLocator.hpp>
 
 namespace eprosima {
@@ -172,7 +173,7 @@ public:
      * @return true if a heartbeat should be sent, false otherwise.
      */
     bool process_initial_acknack(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /*!
      * @brief Sets a change to a particular status (if present in the ReaderProxy)
@@ -213,7 +214,7 @@ public:
      * @return the number of changes that changed its status.
      */
     uint32_t perform_acknack_response(
-            const std::function<void(ChangeForReader_t& change)>& func);
+            const std::function<void(CacheChange_t* change)>& func);
 
     /**
      * Call this to inform a change was removed from history.
@@ -465,7 +466,7 @@ private:
     //!Pointer to the associated StatefulWriter.
     StatefulWriter* writer_;
     //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    ChangesForReaderWindow changes_for_reader_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     TimedEvent* nack_supression_event_;
     TimedEvent* initial_heartbeat_event_;
@@ -489,9 +490,6 @@ private:
     //! Listener to notify about data acknowledgements and resends.
     StatefulWriterListener* const stateful_writer_listener_ = nullptr;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
-
     void disable_timers();
 
     /*
@@ -505,7 +503,7 @@ private:
             ChangeForReaderStatus_t previous,
             ChangeForReaderStatus_t next,
             bool notify_resend,
-            const std::function<void(ChangeForReader_t& change)>& func = {});
+            const std::function<void(CacheChange_t* change)>& func = {});
 
     /*!
      * @brief Adds requested fragments. These fragments will be sent in next NackResponseDelay.
@@ -521,40 +519,21 @@ private:
             const ChangeForReader_t& change,
             bool is_relevant);
 
-    /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @param exact When false, the first change with a sequence number not less than seq_num will be returned.
-     * When true, the change with a sequence number value of seq_num will be returned.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
-     */
-    ChangeIterator find_change(
-            const SequenceNumber_t& seq_num,
-            bool exact);
-
-    /**
-     * @brief Find a change with the specified sequence number.
-     * @param seq_num Sequence number to find.
-     * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
-     */
-    ChangeConstIterator find_change(
-            const SequenceNumber_t& seq_num) const;
-
     /**
      * @brief Notifies that a change has been acknowledged by this ReaderProxy.
      *
-     * @param chiange  Reference to the ChangeForReader_t that has been acknowledged.
+     * @param pos  Position in changes_for_reader_ of the change that has been acknowledged.
      */
     void notify_acknowledged(
-            const ChangeForReader_t& change) const;
+            size_t pos) const;
 
     /**
      * @brief Notifies that a change has been resent to this ReaderProxy.
      *
-     * @param change  Reference to the ChangeForReader_t that has been resent.
+     * @param pos  Position in changes_for_reader_ of the change that has been resent.
      */
     void notify_resent(
-            const ChangeForReader_t& change) const;
+            size_t pos) const;
 
 };
 
@@ -22,6 +22,7 @@
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <rtps/persistence/PersistenceService.h>
+#include <utils/TimeConversion.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -67,6 +68,17 @@ bool StatefulPersistentWriter::change_removed_by_history(
     return StatefulWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+bool StatefulPersistentWriter::wait_for_all_acked(
+        const dds::Duration_t& max_wait)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(TimeConv::Duration_t2MicroSecondsInt64(max_wait));
+    bool ret_val = StatefulWriter::wait_for_all_acked(max_wait);
+
+    // Changes committed asynchronously should be stored before reporting them as acknowledged
+    return flush_persistent_changes(max_blocking_time) && ret_val;
+}
+
 void StatefulPersistentWriter::print_inconsistent_acknack(
         const GUID_t& writer_guid,
         const GUID_t& reader_guid,
@@ -74,6 +74,14 @@ public:
     bool change_removed_by_history(
             CacheChange_t* a_change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) final;
+
+    /**
+     * Wait until all changes are stored and acknowledged.
+     * @param max_wait Maximum time to wait for the acknowledgments.
+     * @return True if all changes were stored and acknowledged.
+     */
+    bool wait_for_all_acked(
+            const dds::Duration_t& max_wait) final;
 };
 
 } // namespace rtps
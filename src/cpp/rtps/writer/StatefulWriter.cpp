@@ -19,6 +19,9 @@
 
 #include "StatefulWriter.hpp"
 
+#include <algorithm>
+#include <cstdlib>
+#include <initializer_list>
 #include <mutex>
 #include <stdexcept>
 #include <vector>
@@ -185,6 +188,8 @@ StatefulWriter::StatefulWriter(
     , nack_response_event_(nullptr)
     , ack_event_(nullptr)
     , heartbeat_count_(0)
+    , merged_repairs_count_(0)
+    , nack_coalescing_window_ms_(0.0)
     , times_(att.times)
     , matched_remote_readers_(att.matched_readers_allocation)
     , matched_readers_pool_(att.matched_readers_allocation)
@@ -199,6 +204,7 @@ StatefulWriter::StatefulWriter(
     , biggest_removed_sequence_number_()
     , matched_local_readers_(att.matched_readers_allocation)
     , matched_datasharing_readers_(att.matched_readers_allocation)
+    , matched_readers_by_guid_(att.matched_readers_allocation)
     , locator_selector_general_(*this, att.matched_readers_allocation)
     , locator_selector_async_(*this, att.matched_readers_allocation)
     , stateful_writer_listener_(stateful_listener)
@@ -215,6 +221,13 @@ void StatefulWriter::init(
     auto push_mode = PropertyPolicyHelper::find_property(att.endpoint.properties, "fastdds.push_mode");
     push_mode_ = !((nullptr != push_mode) && ("false" == *push_mode));
 
+    auto nack_coalescing_window = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.nack_coalescing_window_us");
+    if (nullptr != nack_coalescing_window)
+    {
+        nack_coalescing_window_ms_ = std::strtoul(nack_coalescing_window->c_str(), nullptr, 10) * 1e-3;
+    }
+
     periodic_hb_event_ = new TimedEvent(
         pimpl->getEventResource(),
         [&]() -> bool
@@ -230,7 +243,7 @@ void StatefulWriter::init(
             perform_nack_response();
             return false;
         },
-        fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(times_.nack_response_delay));
+        nack_response_interval_ms(times_.nack_response_delay));
 
     if (disable_positive_acks_)
     {
@@ -300,6 +313,7 @@ void StatefulWriter::local_actions_on_writer_removed()
             remote_reader->stop();
             matched_readers_pool_.push_back(remote_reader);
         }
+        matched_readers_by_guid_.clear();
     }
 
     // PeriodicHeartbeatEvent must be released after releasing all proxies
@@ -1066,6 +1080,7 @@ bool StatefulWriter::matched_reader_add_edp(
     locator_selector_general_.locator_selector.add_entry(rp->general_locator_selector_entry());
     locator_selector_async_.locator_selector.add_entry(rp->async_locator_selector_entry());
 
+    matched_readers_by_guid_.add(rp);
     if (rp->is_local_reader())
     {
         matched_local_readers_.push_back(rp);
@@ -1234,43 +1249,17 @@ bool StatefulWriter::matched_reader_remove(
         std::lock_guard<LocatorSelectorSender> guard_locator_selector_general(locator_selector_general_);
         std::lock_guard<LocatorSelectorSender> guard_locator_selector_async(locator_selector_async_);
 
-        for (ReaderProxyIterator it = matched_local_readers_.begin();
-                it != matched_local_readers_.end(); ++it)
-        {
-            if ((*it)->guid() == reader_guid)
-            {
-                EPROSIMA_LOG_INFO(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
-                rproxy = std::move(*it);
-                it = matched_local_readers_.erase(it);
-                break;
-            }
-        }
-
-        if (rproxy == nullptr)
+        rproxy = matched_readers_by_guid_.remove(reader_guid);
+        if (nullptr != rproxy)
         {
-            for (ReaderProxyIterator it = matched_datasharing_readers_.begin();
-                    it != matched_datasharing_readers_.end(); ++it)
+            EPROSIMA_LOG_INFO(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
+            for (ResourceLimitedVector<ReaderProxy*>* readers :
+                    {&matched_local_readers_, &matched_datasharing_readers_, &matched_remote_readers_})
             {
-                if ((*it)->guid() == reader_guid)
+                ReaderProxyIterator it = std::find(readers->begin(), readers->end(), rproxy);
+                if (readers->end() != it)
                 {
-                    EPROSIMA_LOG_INFO(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
-                    rproxy = std::move(*it);
-                    it = matched_datasharing_readers_.erase(it);
-                    break;
-                }
-            }
-        }
-
-        if (rproxy == nullptr)
-        {
-            for (ReaderProxyIterator it = matched_remote_readers_.begin();
-                    it != matched_remote_readers_.end(); ++it)
-            {
-                if ((*it)->guid() == reader_guid)
-                {
-                    EPROSIMA_LOG_INFO(RTPS_WRITER, "Reader Proxy removed: " << reader_guid);
-                    rproxy = std::move(*it);
-                    it = matched_remote_readers_.erase(it);
+                    readers->erase(it);
                     break;
                 }
             }
@@ -1321,12 +1310,7 @@ bool StatefulWriter::matched_reader_is_matched(
         const GUID_t& reader_guid)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    return for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                   [&reader_guid](ReaderProxy* reader)
-                   {
-                       return (reader->guid() == reader_guid);
-                   }
-                   );
+    return nullptr != matched_readers_by_guid_.find(reader_guid);
 }
 
 bool StatefulWriter::matched_reader_lookup(
@@ -1334,17 +1318,13 @@ bool StatefulWriter::matched_reader_lookup(
         ReaderProxy** RP)
 {
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
-    return for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                   [&readerGuid, RP](ReaderProxy* reader)
-                   {
-                       if (reader->guid() == readerGuid)
-                       {
-                           *RP = reader;
-                           return true;
-                       }
-                       return false;
-                   }
-                   );
+    ReaderProxy* reader = matched_readers_by_guid_.find(readerGuid);
+    if (nullptr != reader)
+    {
+        *RP = reader;
+        return true;
+    }
+    return false;
 }
 
 bool StatefulWriter::has_been_fully_delivered(
@@ -1652,6 +1632,16 @@ bool StatefulWriter::matched_readers_guids(
     return true;
 }
 
+void StatefulWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    BaseWriter::get_memory_usage(usage);
+    usage.matched_proxies.elements = matched_local_readers_.size() + matched_datasharing_readers_.size() +
+            matched_remote_readers_.size() + matched_readers_pool_.size();
+    usage.matched_proxies.bytes = usage.matched_proxies.elements * sizeof(ReaderProxy);
+}
+
 void StatefulWriter::update_positive_acks_times(
         const WriterAttributes& att)
 {
@@ -1674,7 +1664,7 @@ void StatefulWriter::update_times(
     {
         if (nack_response_event_ != nullptr)
         {
-            nack_response_event_->update_interval(times.nack_response_delay);
+            nack_response_event_->update_interval_millisec(nack_response_interval_ms(times.nack_response_delay));
         }
     }
     if (times_.nack_supression_duration != times.nack_supression_duration)
@@ -1914,41 +1904,76 @@ void StatefulWriter::perform_nack_response()
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
+    // Gather the repairs requested by all the readers during the coalescing window.
+    pending_repairs_.clear();
     uint32_t changes_to_resend = 0;
     for (ReaderProxy* reader : matched_remote_readers_)
     {
-        changes_to_resend += reader->perform_acknack_response([&](ChangeForReader_t& change)
+        changes_to_resend += reader->perform_acknack_response([&](CacheChange_t* cache_change)
                         {
-                            // This labmda is called if the ChangeForReader_t pass from REQUESTED to UNSENT.
-                            assert(nullptr != change.getChange());
-                            flow_controller_->add_old_sample(this, change.getChange());
+                            // This labmda is called if the change pass from REQUESTED to UNSENT.
+                            assert(nullptr != cache_change);
+                            pending_repairs_.push_back(cache_change);
                         }
                         );
     }
 
+    // Each change is queued once, in sequence number order, so it is sent once to all the readers which requested
+    // it and consecutive repairs share the same messages.
+    std::sort(pending_repairs_.begin(), pending_repairs_.end(),
+            [](const CacheChange_t* lhs, const CacheChange_t* rhs)
+            {
+                return lhs->sequenceNumber < rhs->sequenceNumber;
+            });
+    auto last = std::unique(pending_repairs_.begin(), pending_repairs_.end());
+    uint32_t merged_repairs = static_cast<uint32_t>(pending_repairs_.end() - last);
+    pending_repairs_.erase(last, pending_repairs_.end());
+
+    for (CacheChange_t* cache_change : pending_repairs_)
+    {
+        // A change still queued on the flow controller is merged with its pending send.
+        if (cache_change->writer_info.is_linked.load())
+        {
+            ++merged_repairs;
+        }
+        else
+        {
+            flow_controller_->add_old_sample(this, cache_change);
+        }
+    }
+
+    merged_repairs_count_ += merged_repairs;
+
     lock.unlock();
 
+    if (0 < merged_repairs)
+    {
+        EPROSIMA_LOG_INFO(RTPS_WRITER, "Writer " << m_guid << " merged " << merged_repairs << " of "
+                                                 << changes_to_resend << " requested repairs");
+    }
+
     // Notify the statistics module
     on_resent_data(changes_to_resend);
 }
 
+double StatefulWriter::nack_response_interval_ms(
+        const dds::Duration_t& nack_response_delay) const
+{
+    return (std::max)(fastdds::rtps::TimeConv::Time_t2MilliSecondsDouble(nack_response_delay),
+                   nack_coalescing_window_ms_);
+}
+
 void StatefulWriter::perform_nack_supression(
         const GUID_t& reader_guid)
 {
     std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
 
-    for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-            [this, &reader_guid](ReaderProxy* reader)
-            {
-                if (reader->guid() == reader_guid)
-                {
-                    reader->perform_nack_supression();
-                    periodic_hb_event_->restart_timer();
-                    return true;
-                }
-                return false;
-            }
-            );
+    ReaderProxy* reader = matched_readers_by_guid_.find(reader_guid);
+    if (nullptr != reader)
+    {
+        reader->perform_nack_supression();
+        periodic_hb_event_->restart_timer();
+    }
 }
 
 bool StatefulWriter::process_acknack(
@@ -1968,65 +1993,58 @@ bool StatefulWriter::process_acknack(
         SequenceNumber_t received_sequence_number = sn_set.empty() ? sn_set.base() : sn_set.max();
         if (received_sequence_number <= next_sequence_number())
         {
-            for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                    [&](ReaderProxy* remote_reader)
+            ReaderProxy* remote_reader = matched_readers_by_guid_.find(reader_guid);
+            if (nullptr != remote_reader)
+            {
+                if (remote_reader->check_and_set_acknack_count(ack_count))
+                {
+                    // Sequence numbers before Base are set as Acknowledged.
+                    remote_reader->acked_changes_set(sn_set.base());
+                    if (sn_set.base() > SequenceNumber_t(0, 0))
                     {
-                        if (remote_reader->guid() == reader_guid)
-                        {
-                            if (remote_reader->check_and_set_acknack_count(ack_count))
-                            {
-                                // Sequence numbers before Base are set as Acknowledged.
-                                remote_reader->acked_changes_set(sn_set.base());
-                                if (sn_set.base() > SequenceNumber_t(0, 0))
-                                {
-                                    // Prepare GAP for requested  samples that are not in history or are irrelevants.
-                                    RTPSMessageGroup group(mp_RTPSParticipant, this, remote_reader->message_sender());
-                                    RTPSGapBuilder gap_builder(group);
-
-                                    if (remote_reader->requested_changes_set(sn_set, gap_builder, get_seq_num_min()))
-                                    {
-                                        nack_response_event_->restart_timer();
-                                    }
-                                    else if (!final_flag)
-                                    {
-                                        periodic_hb_event_->restart_timer();
-                                    }
+                        // Prepare GAP for requested  samples that are not in history or are irrelevants.
+                        RTPSMessageGroup group(mp_RTPSParticipant, this, remote_reader->message_sender());
+                        RTPSGapBuilder gap_builder(group);
 
-                                    gap_builder.flush();
-                                }
-                                else if (sn_set.empty() && !final_flag)
-                                {
-                                    // This is the preemptive acknack.
-                                    if (remote_reader->process_initial_acknack([&](ChangeForReader_t& change_reader)
-                                    {
-                                        assert(nullptr != change_reader.getChange());
-                                        flow_controller_->add_old_sample(this, change_reader.getChange());
-                                    }))
-                                    {
-                                        if (remote_reader->is_remote_and_reliable())
-                                        {
-                                            // Send heartbeat if requested
-                                            send_heartbeat_to_nts(*remote_reader, false, true);
-                                            periodic_hb_event_->restart_timer();
-                                        }
-                                    }
-
-                                    if (remote_reader->is_local_reader() && !remote_reader->is_datasharing_reader())
-                                    {
-                                        intraprocess_heartbeat(remote_reader);
-                                    }
-                                }
+                        if (remote_reader->requested_changes_set(sn_set, gap_builder, get_seq_num_min()))
+                        {
+                            nack_response_event_->restart_timer();
+                        }
+                        else if (!final_flag)
+                        {
+                            periodic_hb_event_->restart_timer();
+                        }
 
-                                // Check if all CacheChange are acknowledge, because a user could be waiting
-                                // for this, or some CacheChanges could be removed if we are VOLATILE
-                                check_acked_status();
+                        gap_builder.flush();
+                    }
+                    else if (sn_set.empty() && !final_flag)
+                    {
+                        // This is the preemptive acknack.
+                        if (remote_reader->process_initial_acknack([&](CacheChange_t* change)
+                        {
+                            assert(nullptr != change);
+                            flow_controller_->add_old_sample(this, change);
+                        }))
+                        {
+                            if (remote_reader->is_remote_and_reliable())
+                            {
+                                // Send heartbeat if requested
+                                send_heartbeat_to_nts(*remote_reader, false, true);
+                                periodic_hb_event_->restart_timer();
                             }
-                            return true;
                         }
 
-                        return false;
+                        if (remote_reader->is_local_reader() && !remote_reader->is_datasharing_reader())
+                        {
+                            intraprocess_heartbeat(remote_reader);
+                        }
                     }
-                    );
+
+                    // Check if all CacheChange are acknowledge, because a user could be waiting
+                    // for this, or some CacheChanges could be removed if we are VOLATILE
+                    check_acked_status();
+                }
+            }
         }
         else
         {
@@ -2052,20 +2070,11 @@ bool StatefulWriter::process_nack_frag(
     if (m_guid == writer_guid)
     {
         result = true;
-        for_matched_readers(matched_local_readers_, matched_datasharing_readers_, matched_remote_readers_,
-                [this, &reader_guid, &ack_count, &seq_num, &fragments_state](ReaderProxy* reader)
-                {
-                    if (reader->guid() == reader_guid)
-                    {
-                        if (reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
-                        {
-                            nack_response_event_->restart_timer();
-                        }
-                        return true;
-                    }
-                    return false;
-                }
-                );
+        ReaderProxy* reader = matched_readers_by_guid_.find(reader_guid);
+        if (nullptr != reader && reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
+        {
+            nack_response_event_->restart_timer();
+        }
     }
 
     return result;
@@ -21,6 +21,7 @@
 
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/history/IChangePool.hpp>
@@ -29,6 +30,7 @@
 #include <fastdds/rtps/writer/RTPSWriter.hpp>
 #include <fastdds/utils/collections/ResourceLimitedVector.hpp>
 
+#include <rtps/common/ProxiesByGuid.hpp>
 #include <rtps/writer/BaseWriter.hpp>
 
 namespace eprosima {
@@ -85,7 +87,7 @@ public:
             const SequenceNumber_t& a_change) const final;
 
     bool wait_for_all_acked(
-            const dds::Duration_t& max_wait) final;
+            const dds::Duration_t& max_wait) override;
 
     void update_attributes(
             const WriterAttributes& att) final;
@@ -104,6 +106,9 @@ public:
     bool matched_readers_guids(
             std::vector<GUID_t>& guids) const final;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const final;
+
 #ifdef FASTDDS_STATISTICS
     bool get_connections(
             fastdds::statistics::rtps::ConnectionList& connection_list) final;
@@ -274,6 +279,18 @@ public:
         return this->heartbeat_count_;
     }
 
+    /**
+     * Get the number of repairs requested by a reader which were merged with a repair of the same change already
+     * pending to be sent, i.e. requested by another reader during the same nack response window.
+     *
+     * @return Number of merged repairs
+     */
+    uint64_t get_merged_repairs_count() const final
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+        return merged_repairs_count_;
+    }
+
     /**
      * Get the number of matched readers.
      *
@@ -338,6 +355,16 @@ public:
 
     void perform_nack_response();
 
+    /**
+     * Get the interval of the nack response event, i.e. the largest of the nack response delay and the nack
+     * coalescing window.
+     *
+     * @param nack_response_delay Nack response delay configured on the writer times.
+     * @return Interval in milliseconds.
+     */
+    double nack_response_interval_ms(
+            const dds::Duration_t& nack_response_delay) const;
+
     void perform_nack_supression(
             const GUID_t& reader_guid);
 
@@ -437,6 +464,12 @@ private:
 
     /// Count of the sent heartbeats.
     Count_t heartbeat_count_;
+    /// Count of the repairs merged with a pending repair of the same change.
+    uint64_t merged_repairs_count_;
+    /// Window during which the NACKs of all the readers are gathered before sending the repairs, in milliseconds.
+    double nack_coalescing_window_ms_;
+    /// Repairs gathered on each nack response, kept to reuse its storage.
+    std::vector<CacheChange_t*> pending_repairs_;
     /// WriterTimes
     WriterTimes times_;
 
@@ -483,6 +516,8 @@ private:
     /// Vector containing all the active ReaderProxies for datasharing delivery.
     ResourceLimitedVector<ReaderProxy*> matched_datasharing_readers_;
     bool there_are_datasharing_readers_ = false;
+    /// Index of all the active ReaderProxies by GUID, used to find them when processing ACKNACK and NACK_FRAG.
+    ProxiesByGuid<ReaderProxy> matched_readers_by_guid_;
 
     LocatorSelectorSender locator_selector_general_;
 
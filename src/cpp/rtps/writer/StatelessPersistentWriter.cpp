@@ -22,6 +22,7 @@
 #include <fastdds/rtps/history/WriterHistory.hpp>
 
 #include <rtps/persistence/PersistenceService.h>
+#include <utils/TimeConversion.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -64,6 +65,17 @@ bool StatelessPersistentWriter::change_removed_by_history(
     return StatelessWriter::change_removed_by_history(change, max_blocking_time);
 }
 
+bool StatelessPersistentWriter::wait_for_all_acked(
+        const dds::Duration_t& max_wait)
+{
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(TimeConv::Duration_t2MicroSecondsInt64(max_wait));
+    bool ret_val = StatelessWriter::wait_for_all_acked(max_wait);
+
+    // Changes committed asynchronously should be stored before reporting them as acknowledged
+    return flush_persistent_changes(max_blocking_time) && ret_val;
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
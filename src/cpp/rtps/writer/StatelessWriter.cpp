@@ -419,6 +419,16 @@ bool StatelessWriter::matched_readers_guids(
     return true;
 }
 
+void StatelessWriter::get_memory_usage(
+        EndpointMemoryUsage& usage) const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    BaseWriter::get_memory_usage(usage);
+    usage.matched_proxies.elements = matched_local_readers_.size() + matched_datasharing_readers_.size() +
+            matched_remote_readers_.size() + matched_readers_pool_.size();
+    usage.matched_proxies.bytes = usage.matched_proxies.elements * sizeof(ReaderLocator);
+}
+
 bool StatelessWriter::try_remove_change(
         const std::chrono::steady_clock::time_point&,
         std::unique_lock<RecursiveTimedMutex>&)
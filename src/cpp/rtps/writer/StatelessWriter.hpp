@@ -89,7 +89,7 @@ public:
             const SequenceNumber_t& seq_num) const final;
 
     bool wait_for_all_acked(
-            const dds::Duration_t& max_wait) final;
+            const dds::Duration_t& max_wait) override;
 
     void update_attributes(
             const WriterAttributes& att) final
@@ -108,6 +108,9 @@ public:
     bool matched_readers_guids(
             std::vector<GUID_t>& guids) const final;
 
+    void get_memory_usage(
+            EndpointMemoryUsage& usage) const final;
+
 #ifdef FASTDDS_STATISTICS
     bool get_connections(
             fastdds::statistics::rtps::ConnectionList& connection_list) final;
@@ -163,6 +163,7 @@ set(${PROJECT_NAME}_source_files
     ${FASTDDS_SOURCE_DIR}/rtps/network/utils/network.cpp
     ${FASTDDS_SOURCE_DIR}/rtps/participant/RTPSParticipant.cpp
     ${FASTDDS_SOURCE_DIR}/rtps/participant/RTPSParticipantImpl.cpp
+    ${FASTDDS_SOURCE_DIR}/rtps/persistence/LogFilePersistenceService.cpp
     ${FASTDDS_SOURCE_DIR}/rtps/persistence/PersistenceFactory.cpp
     ${FASTDDS_SOURCE_DIR}/rtps/reader/BaseReader.cpp
     ${FASTDDS_SOURCE_DIR}/rtps/reader/reader_utils.cpp
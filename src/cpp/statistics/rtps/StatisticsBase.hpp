@@ -59,9 +59,17 @@ struct StatisticsAncillary
 struct StatisticsWriterAncillary
     : public StatisticsAncillary
 {
-    unsigned long long data_counter = {};
-    unsigned long long gap_counter = {};
-    unsigned long long resent_counter = {};
+    std::atomic<uint64_t> data_counter{0};
+    std::atomic<uint64_t> heartbeat_counter{0};
+    std::atomic<uint64_t> gap_counter{0};
+    std::atomic<uint64_t> resent_counter{0};
+    //! When set, counters are only reported by publish_statistics_counters_impl
+    std::atomic<bool> aggregate_counters{false};
+    //! Last values reported by publish_statistics_counters_impl
+    uint64_t published_data_counter = 0;
+    uint64_t published_heartbeat_counter = 0;
+    uint64_t published_gap_counter = 0;
+    uint64_t published_resent_counter = 0;
     std::chrono::time_point<std::chrono::steady_clock> last_history_change_ = std::chrono::steady_clock::now();
 };
 
@@ -90,26 +90,21 @@ void StatisticsWriterImpl::on_sample_datas(
 void StatisticsWriterImpl::on_data_generated(
         size_t num_destinations)
 {
-    std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-    auto members = get_members();
-    members->data_counter += static_cast<uint64_t>(num_destinations);
+    get_members()->data_counter.fetch_add(static_cast<uint64_t>(num_destinations), std::memory_order_relaxed);
 }
 
 void StatisticsWriterImpl::on_data_sent()
 {
-    if (!are_statistics_writers_enabled(EventKind::DATA_COUNT))
+    auto members = get_members();
+    if (members->aggregate_counters.load(std::memory_order_relaxed) ||
+            !are_statistics_writers_enabled(EventKind::DATA_COUNT))
     {
         return;
     }
 
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
-
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        auto members = get_members();
-        notification.count(members->data_counter);
-    }
+    notification.count(members->data_counter.load(std::memory_order_relaxed));
 
     // Perform the callbacks
     Data data;
@@ -126,7 +121,10 @@ void StatisticsWriterImpl::on_data_sent()
 void StatisticsWriterImpl::on_heartbeat(
         uint32_t count)
 {
-    if (!are_statistics_writers_enabled(EventKind::HEARTBEAT_COUNT))
+    auto members = get_members();
+    members->heartbeat_counter.store(count, std::memory_order_relaxed);
+    if (members->aggregate_counters.load(std::memory_order_relaxed) ||
+            !are_statistics_writers_enabled(EventKind::HEARTBEAT_COUNT))
     {
         return;
     }
@@ -149,18 +147,17 @@ void StatisticsWriterImpl::on_heartbeat(
 
 void StatisticsWriterImpl::on_gap()
 {
-    if (!are_statistics_writers_enabled(EventKind::GAP_COUNT))
+    auto members = get_members();
+    uint64_t count = members->gap_counter.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    if (members->aggregate_counters.load(std::memory_order_relaxed) ||
+            !are_statistics_writers_enabled(EventKind::GAP_COUNT))
     {
         return;
     }
 
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
-
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(++get_members()->gap_counter);
-    }
+    notification.count(count);
 
     // Perform the callbacks
     Data data;
@@ -182,18 +179,17 @@ void StatisticsWriterImpl::on_resent_data(
         return;
     }
 
-    if (!are_statistics_writers_enabled(EventKind::RESENT_DATAS))
+    auto members = get_members();
+    uint64_t count = members->resent_counter.fetch_add(to_send, std::memory_order_relaxed) + to_send;
+    if (members->aggregate_counters.load(std::memory_order_relaxed) ||
+            !are_statistics_writers_enabled(EventKind::RESENT_DATAS))
     {
         return;
     }
 
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
-
-    {
-        std::lock_guard<fastdds::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(get_members()->resent_counter += to_send);
-    }
+    notification.count(count);
 
     // Perform the callbacks
     Data data;
@@ -206,6 +202,47 @@ void StatisticsWriterImpl::on_resent_data(
             });
 }
 
+void StatisticsWriterImpl::set_statistics_counters_aggregation_impl(
+        bool aggregate)
+{
+    get_members()->aggregate_counters.store(aggregate, std::memory_order_relaxed);
+}
+
+void StatisticsWriterImpl::publish_statistics_counters_impl()
+{
+    auto members = get_members();
+
+    auto notify_counter =
+            [this](uint32_t kind, const std::atomic<uint64_t>& counter, uint64_t& published)
+            {
+                uint64_t count = counter.load(std::memory_order_relaxed);
+                if (count == published || !are_statistics_writers_enabled(kind))
+                {
+                    return;
+                }
+                published = count;
+
+                EntityCount notification;
+                notification.guid(to_statistics_type(get_guid()));
+                notification.count(count);
+
+                // Perform the callbacks
+                Data data;
+                data.entity_count(std::move(notification));
+                data._d(kind);
+
+                for_each_listener([&data](const std::shared_ptr<IListener>& listener)
+                        {
+                            listener->on_statistics_data(data);
+                        });
+            };
+
+    notify_counter(EventKind::DATA_COUNT, members->data_counter, members->published_data_counter);
+    notify_counter(EventKind::HEARTBEAT_COUNT, members->heartbeat_counter, members->published_heartbeat_counter);
+    notify_counter(EventKind::GAP_COUNT, members->gap_counter, members->published_gap_counter);
+    notify_counter(EventKind::RESENT_DATAS, members->resent_counter, members->published_resent_counter);
+}
+
 void StatisticsWriterImpl::on_publish_throughput(
         uint32_t payload)
 {
@@ -0,0 +1,336 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS__JOBTHREADPOOL_HPP_
+#define UTILS__JOBTHREADPOOL_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <utils/thread.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+
+/*!
+ * Pool of threads executing jobs which are submitted again and again, like the asynchronous flow controllers or the
+ * listener dispatch of the DataReaders of a participant.
+ *
+ * A job is never executed by two threads at the same time, so each job keeps its own ordering, while different jobs
+ * are executed in parallel.
+ */
+class JobThreadPool
+{
+public:
+
+    using time_point = std::chrono::steady_clock::time_point;
+
+    //! Work executed by the pool.
+    class Job
+    {
+    public:
+
+        virtual ~Job() = default;
+
+        /*!
+         * Executes a batch of pending work.
+         *
+         * @return Time point when the job has to be executed again.
+         * time_point::max() if the job has nothing to do until it is submitted again.
+         */
+        virtual time_point execute() = 0;
+
+    private:
+
+        friend class JobThreadPool;
+
+        // Following members are protected by the pool's mutex.
+
+        //! Whether the job is in the ready queue.
+        bool queued_ = false;
+
+        //! Whether the job is being executed by a thread.
+        bool running_ = false;
+
+        //! Whether the job was submitted while being executed.
+        bool notified_ = false;
+
+        //! Whether the job was removed from the pool.
+        bool removed_ = false;
+
+        //! Time point when a delayed job has to be executed.
+        time_point wake_up_time_ = (time_point::max)();
+    };
+
+    /*!
+     * Constructor. Starts the threads.
+     *
+     * @param num_threads Number of threads.
+     * @param thread_settings Settings applied to the threads.
+     * @param participant_id Identifier of the participant, used to name the threads.
+     * @param thread_name Format of the name of the threads, receiving the participant id and the thread index.
+     */
+    JobThreadPool(
+            uint32_t num_threads,
+            const rtps::ThreadSettings& thread_settings,
+            uint32_t participant_id,
+            const char* thread_name)
+        : workers_(num_threads)
+    {
+        threads_.reserve(num_threads);
+        for (uint32_t i = 0; i < num_threads; ++i)
+        {
+            threads_.push_back(create_thread([this, i]()
+                    {
+                        run(workers_[i]);
+                    }, thread_settings, thread_name, participant_id, i));
+        }
+    }
+
+    //! Destructor. Stops the threads.
+    ~JobThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+
+        for (eprosima::thread& thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    /*!
+     * Requests the execution of a job as soon as possible.
+     * If the job is being executed, it will be executed again when it finishes.
+     *
+     * @param job Pointer to the job. Cannot be nullptr.
+     */
+    void submit(
+            Job* job)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (job->removed_)
+        {
+            return;
+        }
+
+        if (job->running_)
+        {
+            job->notified_ = true;
+        }
+        else if (!job->queued_)
+        {
+            remove_delayed_nts(job);
+            job->queued_ = true;
+            ready_.push_back(job);
+            cv_.notify_one();
+        }
+    }
+
+    /*!
+     * Removes a job from the pool, waiting for its current execution to finish.
+     * The job will not be executed anymore, even if it is submitted again.
+     *
+     * When called from the execution of the job itself, it does not wait and the pool will not access the job
+     * anymore, so the job can be destroyed as soon as this function returns.
+     *
+     * @param job Pointer to the job. Cannot be nullptr.
+     */
+    void remove(
+            Job* job)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        job->removed_ = true;
+        if (job->queued_)
+        {
+            ready_.erase(std::find(ready_.begin(), ready_.end(), job));
+            job->queued_ = false;
+        }
+        remove_delayed_nts(job);
+
+        if (job->running_)
+        {
+            std::thread::id this_thread_id = std::this_thread::get_id();
+            for (Worker& worker : workers_)
+            {
+                if ((job == worker.job) && (this_thread_id == worker.thread_id))
+                {
+                    // The job is removing itself. Its execution cannot finish while waiting for it.
+                    worker.job = nullptr;
+                    job->running_ = false;
+                    job_finished_cv_.notify_all();
+                    return;
+                }
+            }
+        }
+
+        job_finished_cv_.wait(lock, [job]()
+                {
+                    return !job->running_;
+                });
+    }
+
+private:
+
+    //! State of each thread of the pool.
+    struct Worker
+    {
+        //! Identifier of the thread.
+        std::thread::id thread_id;
+
+        //! Job being executed by the thread. Reset when the job removes itself during its execution.
+        Job* job = nullptr;
+    };
+
+    void remove_delayed_nts(
+            Job* job)
+    {
+        auto it = std::find(delayed_.begin(), delayed_.end(), job);
+        if (delayed_.end() != it)
+        {
+            delayed_.erase(it);
+            job->wake_up_time_ = (time_point::max)();
+        }
+    }
+
+    //! Moves to the ready queue the delayed jobs whose time has come, and returns the earliest time of the rest.
+    time_point check_delayed_nts()
+    {
+        time_point now = std::chrono::steady_clock::now();
+        time_point next_wake_up = (time_point::max)();
+
+        auto it = delayed_.begin();
+        while (delayed_.end() != it)
+        {
+            Job* job = *it;
+            if (job->wake_up_time_ <= now)
+            {
+                it = delayed_.erase(it);
+                job->wake_up_time_ = (time_point::max)();
+                job->queued_ = true;
+                ready_.push_back(job);
+            }
+            else
+            {
+                next_wake_up = (std::min)(next_wake_up, job->wake_up_time_);
+                ++it;
+            }
+        }
+
+        return next_wake_up;
+    }
+
+    //! Function run by each thread.
+    void run(
+            Worker& worker)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        worker.thread_id = std::this_thread::get_id();
+
+        while (running_)
+        {
+            time_point next_wake_up = check_delayed_nts();
+
+            if (ready_.empty())
+            {
+                if ((time_point::max)() == next_wake_up)
+                {
+                    cv_.wait(lock);
+                }
+                else
+                {
+                    cv_.wait_until(lock, next_wake_up);
+                }
+                continue;
+            }
+
+            Job* job = ready_.front();
+            ready_.pop_front();
+            job->queued_ = false;
+            job->running_ = true;
+            job->notified_ = false;
+            worker.job = job;
+
+            lock.unlock();
+            time_point wake_up_time = job->execute();
+            lock.lock();
+
+            if (nullptr == worker.job)
+            {
+                // The job removed itself and may have been destroyed.
+                continue;
+            }
+            worker.job = nullptr;
+            job->running_ = false;
+
+            if (!job->removed_)
+            {
+                if (job->notified_ || wake_up_time <= std::chrono::steady_clock::now())
+                {
+                    // Put it at the end of the queue to be fair with the rest of jobs.
+                    job->queued_ = true;
+                    ready_.push_back(job);
+                    cv_.notify_one();
+                }
+                else if ((time_point::max)() != wake_up_time)
+                {
+                    job->wake_up_time_ = wake_up_time;
+                    delayed_.push_back(job);
+                    // Other thread may be sleeping until a later time.
+                    cv_.notify_one();
+                }
+            }
+            else
+            {
+                job_finished_cv_.notify_all();
+            }
+        }
+    }
+
+    std::mutex mutex_;
+
+    std::condition_variable cv_;
+
+    std::condition_variable job_finished_cv_;
+
+    bool running_ = true;
+
+    //! Jobs waiting for a sender thread.
+    std::deque<Job*> ready_;
+
+    //! Jobs waiting for a time point before being executed.
+    std::vector<Job*> delayed_;
+
+    std::vector<Worker> workers_;
+
+    std::vector<eprosima::thread> threads_;
+};
+
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // UTILS__JOBTHREADPOOL_HPP_
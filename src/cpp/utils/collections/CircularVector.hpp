@@ -0,0 +1,557 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CircularVector.hpp
+ *
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS__CIRCULARVECTOR_HPP
+#define FASTDDS_UTILS_COLLECTIONS__CIRCULARVECTOR_HPP
+
+#include <assert.h>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+
+/**
+ * Sequence container storing its elements on a growable circular buffer.
+ *
+ * It provides the interface of std::vector needed by ordered collections where elements are usually appended at the
+ * end and removed from the beginning:
+ * - Removing the first or the last element is O(1).
+ * - Appending at the end is amortized O(1). Memory is only allocated when the capacity is exceeded.
+ * - Inserting or removing in the middle only moves the elements on the shortest side of the position.
+ *
+ * Iterators are random access, so binary searches on sorted contents are logarithmic.
+ * As with std::vector, iterators are invalidated by any operation changing the number of elements.
+ *
+ * @tparam _Ty Element type. It should be default constructible and move assignable.
+ *
+ * @ingroup UTILITIES_MODULE
+ */
+template<typename _Ty>
+class CircularVector
+{
+    template<bool IsConst>
+    class Iterator;
+
+public:
+
+    using value_type = _Ty;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = value_type&;
+    using const_reference = const value_type&;
+    using pointer = value_type*;
+    using const_pointer = const value_type*;
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    CircularVector() = default;
+
+    size_type size() const noexcept
+    {
+        return size_;
+    }
+
+    bool empty() const noexcept
+    {
+        return 0u == size_;
+    }
+
+    size_type capacity() const noexcept
+    {
+        return buffer_.size();
+    }
+
+    /**
+     * Ensures the capacity of the container is at least the given number of elements.
+     *
+     * @param new_capacity Number of elements the container should be able to hold without allocating memory.
+     */
+    void reserve(
+            size_type new_capacity)
+    {
+        if (new_capacity > buffer_.size())
+        {
+            std::vector<_Ty> new_buffer(new_capacity);
+            for (size_type i = 0; i < size_; ++i)
+            {
+                new_buffer[i] = std::move(buffer_[physical(i)]);
+            }
+            buffer_.swap(new_buffer);
+            head_ = 0;
+        }
+    }
+
+    /**
+     * Removes all the elements. The capacity is kept.
+     */
+    void clear()
+    {
+        for (size_type i = 0; i < size_; ++i)
+        {
+            buffer_[physical(i)] = value_type();
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+    reference operator [](
+            size_type pos)
+    {
+        assert(pos < size_);
+        return buffer_[physical(pos)];
+    }
+
+    const_reference operator [](
+            size_type pos) const
+    {
+        assert(pos < size_);
+        return buffer_[physical(pos)];
+    }
+
+    reference front()
+    {
+        return (*this)[0];
+    }
+
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+
+    reference back()
+    {
+        return (*this)[size_ - 1];
+    }
+
+    const_reference back() const
+    {
+        return (*this)[size_ - 1];
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept
+    {
+        return iterator(this, size_);
+    }
+
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    void push_back(
+            const value_type& val)
+    {
+        grow_if_full();
+        buffer_[physical(size_)] = val;
+        ++size_;
+    }
+
+    void push_back(
+            value_type&& val)
+    {
+        grow_if_full();
+        buffer_[physical(size_)] = std::move(val);
+        ++size_;
+    }
+
+    void pop_front()
+    {
+        assert(0u < size_);
+        buffer_[head_] = value_type();
+        head_ = physical(1);
+        --size_;
+    }
+
+    void pop_back()
+    {
+        assert(0u < size_);
+        buffer_[physical(size_ - 1)] = value_type();
+        --size_;
+    }
+
+    /**
+     * Inserts an element before the given position.
+     *
+     * @param pos Iterator before which the element will be inserted.
+     * @param val Value of the element to insert.
+     * @return Iterator pointing to the inserted element.
+     */
+    iterator insert(
+            const_iterator pos,
+            const value_type& val)
+    {
+        value_type copy(val);
+        return insert(pos, std::move(copy));
+    }
+
+    /**
+     * Inserts an element before the given position.
+     *
+     * @param pos Iterator before which the element will be inserted.
+     * @param val Value of the element to insert.
+     * @return Iterator pointing to the inserted element.
+     */
+    iterator insert(
+            const_iterator pos,
+            value_type&& val)
+    {
+        assert(this == pos.container_);
+        size_type index = pos.index_;
+        assert(index <= size_);
+
+        grow_if_full();
+        if (index < size_ / 2)
+        {
+            // Move the elements before the position one place towards the front.
+            head_ = (0u == head_ ? buffer_.size() : head_) - 1;
+            for (size_type i = 0; i < index; ++i)
+            {
+                buffer_[physical(i)] = std::move(buffer_[physical(i + 1)]);
+            }
+        }
+        else
+        {
+            // Move the elements after the position one place towards the back.
+            for (size_type i = size_; i > index; --i)
+            {
+                buffer_[physical(i)] = std::move(buffer_[physical(i - 1)]);
+            }
+        }
+        buffer_[physical(index)] = std::move(val);
+        ++size_;
+
+        return iterator(this, index);
+    }
+
+    /**
+     * Removes the element at the given position.
+     *
+     * @param pos Iterator pointing to the element to remove.
+     * @return Iterator following the removed element.
+     */
+    iterator erase(
+            const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /**
+     * Removes the elements in the range [first, last).
+     *
+     * @param first Iterator pointing to the first element to remove.
+     * @param last Iterator following the last element to remove.
+     * @return Iterator following the last removed element.
+     */
+    iterator erase(
+            const_iterator first,
+            const_iterator last)
+    {
+        assert(this == first.container_ && this == last.container_);
+        size_type begin_index = first.index_;
+        size_type end_index = last.index_;
+        assert(begin_index <= end_index && end_index <= size_);
+
+        size_type count = end_index - begin_index;
+        if (0u < count)
+        {
+            if (begin_index < size_ - end_index)
+            {
+                // Move the elements before the range towards the back, and advance the head.
+                for (size_type i = begin_index; i > 0; --i)
+                {
+                    buffer_[physical(i - 1 + count)] = std::move(buffer_[physical(i - 1)]);
+                }
+                for (size_type i = 0; i < count; ++i)
+                {
+                    buffer_[physical(i)] = value_type();
+                }
+                head_ = physical(count);
+            }
+            else
+            {
+                // Move the elements after the range towards the front.
+                for (size_type i = end_index; i < size_; ++i)
+                {
+                    buffer_[physical(i - count)] = std::move(buffer_[physical(i)]);
+                }
+                for (size_type i = size_ - count; i < size_; ++i)
+                {
+                    buffer_[physical(i)] = value_type();
+                }
+            }
+            size_ -= count;
+        }
+
+        return iterator(this, begin_index);
+    }
+
+private:
+
+    /**
+     * Random access iterator over the elements of a CircularVector.
+     * It holds the logical position of the element, so it remains valid when the buffer wraps around.
+     */
+    template<bool IsConst>
+    class Iterator
+    {
+    public:
+
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = _Ty;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const _Ty*, _Ty*>::type;
+        using reference = typename std::conditional<IsConst, const _Ty&, _Ty&>::type;
+        using container_type = typename std::conditional<IsConst, const CircularVector, CircularVector>::type;
+
+        Iterator() = default;
+
+        //! Conversion from iterator to const_iterator.
+        template<bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        Iterator(
+                const Iterator<OtherConst>& other) noexcept
+            : container_(other.container_)
+            , index_(other.index_)
+        {
+        }
+
+        reference operator *() const
+        {
+            return (*container_)[index_];
+        }
+
+        pointer operator ->() const
+        {
+            return &(*container_)[index_];
+        }
+
+        reference operator [](
+                difference_type n) const
+        {
+            return (*container_)[static_cast<size_type>(static_cast<difference_type>(index_) + n)];
+        }
+
+        Iterator& operator ++() noexcept
+        {
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator ++(
+                int) noexcept
+        {
+            Iterator tmp(*this);
+            ++index_;
+            return tmp;
+        }
+
+        Iterator& operator --() noexcept
+        {
+            --index_;
+            return *this;
+        }
+
+        Iterator operator --(
+                int) noexcept
+        {
+            Iterator tmp(*this);
+            --index_;
+            return tmp;
+        }
+
+        Iterator& operator +=(
+                difference_type n) noexcept
+        {
+            index_ = static_cast<size_type>(static_cast<difference_type>(index_) + n);
+            return *this;
+        }
+
+        Iterator& operator -=(
+                difference_type n) noexcept
+        {
+            index_ = static_cast<size_type>(static_cast<difference_type>(index_) - n);
+            return *this;
+        }
+
+        Iterator operator +(
+                difference_type n) const noexcept
+        {
+            Iterator tmp(*this);
+            return tmp += n;
+        }
+
+        friend Iterator operator +(
+                difference_type n,
+                const Iterator& it) noexcept
+        {
+            return it + n;
+        }
+
+        Iterator operator -(
+                difference_type n) const noexcept
+        {
+            Iterator tmp(*this);
+            return tmp -= n;
+        }
+
+        template<bool OtherConst>
+        difference_type operator -(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return static_cast<difference_type>(index_) - static_cast<difference_type>(other.index_);
+        }
+
+        template<bool OtherConst>
+        bool operator ==(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ == other.index_;
+        }
+
+        template<bool OtherConst>
+        bool operator !=(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ != other.index_;
+        }
+
+        template<bool OtherConst>
+        bool operator <(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ < other.index_;
+        }
+
+        template<bool OtherConst>
+        bool operator >(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ > other.index_;
+        }
+
+        template<bool OtherConst>
+        bool operator <=(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ <= other.index_;
+        }
+
+        template<bool OtherConst>
+        bool operator >=(
+                const Iterator<OtherConst>& other) const noexcept
+        {
+            return index_ >= other.index_;
+        }
+
+    private:
+
+        friend class CircularVector;
+
+        template<bool>
+        friend class Iterator;
+
+        Iterator(
+                container_type* container,
+                size_type index) noexcept
+            : container_(container)
+            , index_(index)
+        {
+        }
+
+        container_type* container_ = nullptr;
+
+        //! Logical position of the element, starting at the first element of the container.
+        size_type index_ = 0;
+    };
+
+    size_type physical(
+            size_type pos) const noexcept
+    {
+        size_type ret_val = head_ + pos;
+        return ret_val >= buffer_.size() ? ret_val - buffer_.size() : ret_val;
+    }
+
+    void grow_if_full()
+    {
+        if (size_ == buffer_.size())
+        {
+            reserve((std::max)(size_type(8u), 2u * buffer_.size()));
+        }
+    }
+
+    //! Storage of the elements. Its size is the capacity of the container.
+    std::vector<_Ty> buffer_;
+
+    //! Position on buffer_ of the first element.
+    size_type head_ = 0;
+
+    //! Number of elements.
+    size_type size_ = 0;
+};
+
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_COLLECTIONS__CIRCULARVECTOR_HPP
@@ -0,0 +1,137 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DeadlineQueue.hpp
+ */
+
+#ifndef SRC_CPP_UTILS_COLLECTIONS_DEADLINEQUEUE_HPP_
+#define SRC_CPP_UTILS_COLLECTIONS_DEADLINEQUEUE_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+
+namespace eprosima {
+namespace utilities {
+namespace collections {
+
+/**
+ * @brief Collection of keys sorted by their deadline.
+ *
+ * Keys are kept on a tree sorted by deadline, with an index to find the position of each key.
+ * New deadlines are inserted with a hint at the end of the tree, so setting a deadline calculated adding the same
+ * period to the current time takes amortized constant time, and the earliest deadline is always on the front.
+ *
+ * @tparam Key  Type of the keys. It should be less than comparable.
+ */
+template<typename Key>
+class DeadlineQueue
+{
+public:
+
+    using time_point = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Set the deadline of a key, adding the key if it was not on the collection.
+     *
+     * @param [in] key       The key to update.
+     * @param [in] deadline  The new deadline of the key.
+     */
+    void set(
+            const Key& key,
+            const time_point& deadline)
+    {
+        auto pos = positions_.find(key);
+        if (positions_.end() == pos)
+        {
+            positions_.emplace(key, entries_.emplace_hint(entries_.end(), deadline, key));
+        }
+        else if (pos->second->first != deadline)
+        {
+            entries_.erase(pos->second);
+            pos->second = entries_.emplace_hint(entries_.end(), deadline, key);
+        }
+    }
+
+    /**
+     * @brief Remove a key from the collection.
+     *
+     * @param [in] key  The key to remove.
+     */
+    void erase(
+            const Key& key)
+    {
+        auto pos = positions_.find(key);
+        if (positions_.end() != pos)
+        {
+            entries_.erase(pos->second);
+            positions_.erase(pos);
+        }
+    }
+
+    /**
+     * @brief Get the key with the earliest deadline.
+     *
+     * @param [out] key       The key with the earliest deadline.
+     * @param [out] deadline  The deadline of that key.
+     *
+     * @return false when the collection is empty.
+     */
+    bool front(
+            Key& key,
+            time_point& deadline) const
+    {
+        if (entries_.empty())
+        {
+            return false;
+        }
+
+        key = entries_.begin()->second;
+        deadline = entries_.begin()->first;
+        return true;
+    }
+
+    bool empty() const
+    {
+        return entries_.empty();
+    }
+
+    size_t size() const
+    {
+        return entries_.size();
+    }
+
+    void clear()
+    {
+        positions_.clear();
+        entries_.clear();
+    }
+
+private:
+
+    using EntryCollection = std::multimap<time_point, Key>;
+
+    //! Keys sorted by deadline.
+    EntryCollection entries_;
+
+    //! Position of each key on entries_.
+    std::map<Key, typename EntryCollection::iterator> positions_;
+};
+
+} // namespace collections
+} // namespace utilities
+} // namespace eprosima
+
+#endif // SRC_CPP_UTILS_COLLECTIONS_DEADLINEQUEUE_HPP_
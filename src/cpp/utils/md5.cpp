@@ -38,6 +38,8 @@
 #include <cstdio>
 #include <stdio.h>
 
+#include <fastdds/config.hpp>
+
 namespace eprosima {
 namespace fastdds {
 
@@ -195,11 +197,16 @@ void MD5::decode(
         const uint1 input[],
         size_type len)
 {
+#if !FASTDDS_IS_BIG_ENDIAN_TARGET
+    // MD5 words are little-endian, so on little-endian targets this is a plain copy.
+    memcpy(output, input, len);
+#else
     for (unsigned int i = 0, j = 0; j < len; i++, j += 4)
     {
         output[i] = ((uint4)input[j]) | (((uint4)input[j + 1]) << 8) |
                 (((uint4)input[j + 2]) << 16) | (((uint4)input[j + 3]) << 24);
     }
+#endif // if !FASTDDS_IS_BIG_ENDIAN_TARGET
 }
 
 //////////////////////////////
@@ -211,6 +218,9 @@ void MD5::encode(
         const uint4 input[],
         size_type len)
 {
+#if !FASTDDS_IS_BIG_ENDIAN_TARGET
+    memcpy(output, input, len);
+#else
     for (size_type i = 0, j = 0; j < len; i++, j += 4)
     {
         output[j] = input[i] & 0xff;
@@ -218,6 +228,7 @@ void MD5::encode(
         output[j + 2] = (input[i] >> 16) & 0xff;
         output[j + 3] = (input[i] >> 24) & 0xff;
     }
+#endif // if !FASTDDS_IS_BIG_ENDIAN_TARGET
 }
 
 //////////////////////////////
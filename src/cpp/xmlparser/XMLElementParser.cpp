@@ -948,6 +948,7 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:element name="scheduler" type="flowControllerSchedulerPolicy" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="max_bytes_per_period" type="int32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="period_ms" type="uint64" minOccurs="0" maxOccurs="1"/>
+                    <xs:element name="max_burst_bytes" type="uint32" minOccurs="0" maxOccurs="1"/>
                     <xs:element name="sender_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 </xs:all>
             </xs:complexType>
@@ -958,6 +959,7 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     <xs:enumeration value="ROUND_ROBIN" />
                     <xs:enumeration value="HIGH_PRIORITY" />
                     <xs:enumeration value="PRIORITY_WITH_RESERVATION" />
+                    <xs:enumeration value="EARLIEST_DEADLINE_FIRST" />
                 </xs:restriction>
             </xs:simpleType>
          */
@@ -1008,7 +1010,8 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                         FIFO, FlowControllerSchedulerPolicy::FIFO,
                         HIGH_PRIORITY, FlowControllerSchedulerPolicy::HIGH_PRIORITY,
                         ROUND_ROBIN, FlowControllerSchedulerPolicy::ROUND_ROBIN,
-                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION))
+                        PRIORITY_WITH_RESERVATION, FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION,
+                        EARLIEST_DEADLINE_FIRST, FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST))
                 {
                     EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << SCHEDULER << "' with bad content");
                     return XMLP_ret::XML_ERROR;
@@ -1030,6 +1033,14 @@ XMLP_ret XMLParser::getXMLFlowControllerDescriptorList(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            else if (strcmp(name, MAX_BURST_BYTES) == 0)
+            {
+                // max_burst_bytes - uint32Type
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux1, &flow_controller_descriptor->max_burst_bytes, ident))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, SENDER_THREAD) == 0)
             {
                 // sender_thread - threadSettingsType
@@ -287,6 +287,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tcp_negotiation_timeout" type="uint32_t" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="reactor_threads" type="uint16Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -455,6 +456,7 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, ACCEPT_THREAD) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 ||
                 strcmp(name, TCP_NEGOTIATION_TIMEOUT) == 0 ||
+                strcmp(name, TCP_REACTOR_THREADS) == 0 ||
                 strcmp(name, TLS) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 ||
                 strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
@@ -1015,6 +1017,16 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                 }
                 pTCPDesc->tcp_negotiation_timeout = static_cast<uint32_t>(iTimeout);
             }
+            else if (strcmp(name, TCP_REACTOR_THREADS) == 0)
+            {
+                // reactor_threads - uint16Type
+                int iThreads(0);
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &iThreads, 0) || iThreads < 0 || iThreads > 65535)
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                pTCPDesc->reactor_threads = static_cast<uint16_t>(iThreads);
+            }
         }
     }
     else
@@ -2267,6 +2279,8 @@ XMLP_ret XMLParser::fillDataNode(
                             <xs:element name="timed_events_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                             <xs:element name="discovery_server_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                             <xs:element name="typelookup_service_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                            <xs:element name="persistence_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                            <xs:element name="listener_dispatch_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                             <xs:element name="builtin_transports_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                             <xs:element name="security_log_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                         </xs:all>
@@ -2570,6 +2584,21 @@ XMLP_ret XMLParser::fillDataNode(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, PERSISTENCE_THREAD) == 0)
+        {
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(*p_aux0, participant_node.get()->rtps.persistence_thread))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, LISTENER_DISPATCH_THREAD) == 0)
+        {
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(*p_aux0, participant_node.get()->rtps.listener_dispatch_thread))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, BUILTIN_TRANSPORTS_RECEPTION_THREADS) == 0)
         {
             if (XMLP_ret::XML_OK !=
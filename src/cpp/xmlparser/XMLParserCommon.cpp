@@ -69,6 +69,7 @@ const char* CHECK_CRC = "check_crc";
 const char* KEEP_ALIVE_THREAD = "keep_alive_thread";
 const char* ACCEPT_THREAD = "accept_thread";
 const char* TCP_NEGOTIATION_TIMEOUT = "tcp_negotiation_timeout";
+const char* TCP_REACTOR_THREADS = "reactor_threads";
 const char* SEGMENT_SIZE = "segment_size";
 const char* PORT_QUEUE_CAPACITY = "port_queue_capacity";
 const char* PORT_OVERFLOW_POLICY = "port_overflow_policy";
@@ -154,6 +155,8 @@ const char* MAX_PARTITIONS = "max_partitions";
 const char* TIMED_EVENTS_THREAD = "timed_events_thread";
 const char* DISCOVERY_SERVER_THREAD = "discovery_server_thread";
 const char* TYPELOOKUP_SERVICE_THREAD = "typelookup_service_thread";
+const char* PERSISTENCE_THREAD = "persistence_thread";
+const char* LISTENER_DISPATCH_THREAD = "listener_dispatch_thread";
 const char* SECURITY_LOG_THREAD = "security_log_thread";
 const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS = "builtin_transports_reception_threads";
 const char* BUILTIN_CONTROLLERS_SENDER_THREAD = "builtin_controllers_sender_thread";
@@ -294,11 +297,13 @@ const char* SCHEDULER = "scheduler";
 const char* SENDER_THREAD = "sender_thread";
 const char* MAX_BYTES_PER_PERIOD = "max_bytes_per_period";
 const char* PERIOD_MILLISECS = "period_ms";
+const char* MAX_BURST_BYTES = "max_burst_bytes";
 const char* FLOW_CONTROLLER_NAME = "flow_controller_name";
 const char* FIFO = "FIFO";
 const char* HIGH_PRIORITY = "HIGH_PRIORITY";
 const char* ROUND_ROBIN = "ROUND_ROBIN";
 const char* PRIORITY_WITH_RESERVATION = "PRIORITY_WITH_RESERVATION";
+const char* EARLIEST_DEADLINE_FIRST = "EARLIEST_DEADLINE_FIRST";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -82,6 +82,7 @@ extern const char* CHECK_CRC;
 extern const char* KEEP_ALIVE_THREAD;
 extern const char* ACCEPT_THREAD;
 extern const char* TCP_NEGOTIATION_TIMEOUT;
+extern const char* TCP_REACTOR_THREADS;
 extern const char* SEGMENT_SIZE;
 extern const char* PORT_QUEUE_CAPACITY;
 extern const char* PORT_OVERFLOW_POLICY;
@@ -170,6 +171,8 @@ extern const char* MAX_PARTITIONS;
 extern const char* TIMED_EVENTS_THREAD;
 extern const char* DISCOVERY_SERVER_THREAD;
 extern const char* TYPELOOKUP_SERVICE_THREAD;
+extern const char* PERSISTENCE_THREAD;
+extern const char* LISTENER_DISPATCH_THREAD;
 extern const char* SECURITY_LOG_THREAD;
 extern const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS;
 extern const char* BUILTIN_CONTROLLERS_SENDER_THREAD;
@@ -310,8 +313,10 @@ extern const char* FIFO;
 extern const char* HIGH_PRIORITY;
 extern const char* ROUND_ROBIN;
 extern const char* PRIORITY_WITH_RESERVATION;
+extern const char* EARLIEST_DEADLINE_FIRST;
 extern const char* FLOW_CONTROLLER_NAME;
 extern const char* PERIOD_MILLISECS;
+extern const char* MAX_BURST_BYTES;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -13,10 +13,12 @@
 // limitations under the License.
 
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <memory>
 #include <thread>
+#include <vector>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/LibrarySettings.hpp>
@@ -30,6 +32,7 @@
 #include <fastdds/rtps/transport/test_UDPv4TransportDescriptor.hpp>
 #include <gtest/gtest.h>
 
+#include "../utils/filter_helpers.hpp"
 #include "BlackboxTests.hpp"
 #include "RTPSAsSocketReader.hpp"
 #include "RTPSAsSocketWriter.hpp"
@@ -473,6 +476,123 @@ TEST_P(RTPS, RTPSAsReliableWithRegistrationAndHolesInHistory)
     late_joiner.block_for_all();
 }
 
+/*
+ * Several reliable readers lose the same samples on a lossy network. Their NACKs are gathered during the nack
+ * coalescing window of the writer, so each lost sample is repaired once for all of them and the repairs requested by
+ * the other readers are counted as merged.
+ */
+TEST(RTPS, RTPSAsReliableMergedRepairsOnLossyNetwork)
+{
+    constexpr size_t num_readers = 3;
+
+    // Drop the even samples until they have been sent once to all the readers.
+    std::atomic<bool> drop_even_samples{true};
+    auto test_transport = std::make_shared<eprosima::fastdds::rtps::test_UDPv4TransportDescriptor>();
+    test_transport->drop_data_messages_filter_ = [&drop_even_samples](eprosima::fastdds::rtps::CDRMessage_t& msg)
+            -> bool
+            {
+                uint32_t old_pos = msg.pos;
+
+                // Parse writer ID and sequence number
+                msg.pos += 2; // flags
+                msg.pos += 2; // inline QoS
+                msg.pos += 4; // reader ID
+                auto writerID = eprosima::fastdds::helpers::cdr_parse_entity_id((char*)&msg.buffer[msg.pos]);
+                msg.pos += 4;
+                SequenceNumber_t sn;
+                sn.high = (int32_t)eprosima::fastdds::helpers::cdr_parse_u32((char*)&msg.buffer[msg.pos]);
+                msg.pos += 4;
+                sn.low = eprosima::fastdds::helpers::cdr_parse_u32((char*)&msg.buffer[msg.pos]);
+
+                // Restore buffer position
+                msg.pos = old_pos;
+
+                return drop_even_samples.load() && ((writerID.value[3] & 0xC0) == 0) && (0u == (sn.low % 2u));
+            };
+
+    std::vector<std::unique_ptr<RTPSWithRegistrationReader<HelloWorldPubSubType>>> readers;
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        readers.emplace_back(new RTPSWithRegistrationReader<HelloWorldPubSubType>(TEST_TOPIC_NAME));
+        readers.back()->reliability(eprosima::fastdds::rtps::ReliabilityKind_t::RELIABLE).init();
+        ASSERT_TRUE(readers.back()->isInitialized());
+    }
+
+    // The coalescing window is long enough for all the readers to request the lost samples before they are repaired.
+    RTPSWithRegistrationWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+    writer.reliability(eprosima::fastdds::rtps::ReliabilityKind_t::RELIABLE).
+            heartbeat_period_seconds(0).
+            heartbeat_period_nanosec(100000000).
+            add_property("fastdds.nack_coalescing_window_us", "1000000").
+            disable_builtin_transport().
+            add_user_transport_to_pparams(test_transport).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery(num_readers);
+    for (auto& reader : readers)
+    {
+        reader->wait_discovery();
+    }
+    EXPECT_EQ(0u, writer.get_native_writer().get_merged_repairs_count());
+
+    auto data = default_helloworld_data_generator();
+    const size_t num_lost = data.size() / 2;
+    for (auto& reader : readers)
+    {
+        reader->expected_data(data);
+        reader->startReception();
+    }
+
+    // The synchronous writer has sent every sample once to all the readers when send returns.
+    auto send_data(data);
+    writer.send(send_data);
+    ASSERT_TRUE(send_data.empty());
+    drop_even_samples.store(false);
+
+    for (auto& reader : readers)
+    {
+        reader->block_for_all();
+    }
+    EXPECT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // Each lost sample was requested by all the readers and repaired once.
+    EXPECT_EQ((num_readers - 1) * num_lost, writer.get_native_writer().get_merged_repairs_count());
+}
+
+/*
+ * A writer with a latency budget of 1 ms publishes several samples through an earliest deadline first flow controller
+ * which only lets one sample out every 50 ms, so the samples waiting on the flow controller miss their deadline.
+ */
+TEST(RTPS, RTPSAsReliableFlowControllerDeadlineMisses)
+{
+    RTPSWithRegistrationReader<HelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+    RTPSWithRegistrationWriter<HelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(eprosima::fastdds::rtps::ReliabilityKind_t::RELIABLE).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(eprosima::fastdds::rtps::ReliabilityKind_t::RELIABLE).
+            asynchronously(eprosima::fastdds::rtps::RTPSWriterPublishMode::ASYNCHRONOUS_WRITER).
+            add_flow_controller_descriptor_to_pparams(
+        eprosima::fastdds::rtps::FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, 100, 50).
+            add_property("fastdds.sfc.latency_budget_us", "1000").init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+    EXPECT_EQ(0u, writer.get_native_writer().get_flow_controller_deadline_misses());
+
+    auto data = default_helloworld_data_generator();
+    reader.expected_data(data);
+    reader.startReception();
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    EXPECT_LT(0u, writer.get_native_writer().get_flow_controller_deadline_misses());
+}
+
 /*
  * This test checks that GAPs are properly sent when a writer is sending data to
  * each reader separately.
@@ -11771,6 +11771,208 @@ TEST_F(DynamicTypesTests, DynamicType_structure)
     EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
 }
 
+/*
+ * Checks the fixed-size primitive members of a structure, which are placed together in a flat storage, keep working
+ * alongside members stored on their own.
+ */
+TEST_F(DynamicTypesTests, DynamicType_structure_flat_members)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("FlatStructTest");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+    ASSERT_TRUE(builder);
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->get_primitive_type(TK_INT8));
+    member_descriptor->name("int8");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("string");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_FLOAT64));
+    member_descriptor->name("float64");
+    member_descriptor->default_value("1.5");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_BOOLEAN));
+    member_descriptor->name("boolean");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_UINT64));
+    member_descriptor->name("uint64");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    DynamicType::_ref_type struct_type {builder->build()};
+    ASSERT_TRUE(struct_type);
+
+    DynamicData::_ref_type struct_data {DynamicDataFactory::get_instance()->create_data(struct_type)};
+    ASSERT_TRUE(struct_data);
+
+    // Default values.
+    int8_t int8_value {1};
+    EXPECT_EQ(RETCODE_OK, struct_data->get_int8_value(int8_value, 0));
+    EXPECT_EQ(0, int8_value);
+    double float64_value {0};
+    EXPECT_EQ(RETCODE_OK, struct_data->get_float64_value(float64_value, 2));
+    EXPECT_EQ(1.5, float64_value);
+
+    // Getters and setters, with and without promotion.
+    EXPECT_EQ(RETCODE_OK, struct_data->set_int8_value(0, -12));
+    EXPECT_EQ(RETCODE_OK, struct_data->set_string_value(1, "flat"));
+    EXPECT_EQ(RETCODE_OK, struct_data->set_float64_value(2, 3.25));
+    EXPECT_EQ(RETCODE_OK, struct_data->set_boolean_value(3, true));
+    EXPECT_EQ(RETCODE_OK, struct_data->set_uint32_value(4, 1234u));
+    {
+        eprosima::fastdds::testing::ScopeLogs _("disable");
+        EXPECT_EQ(RETCODE_BAD_PARAMETER, struct_data->set_int64_value(0, 10));
+    }
+
+    EXPECT_EQ(RETCODE_OK, struct_data->get_int8_value(int8_value, 0));
+    EXPECT_EQ(-12, int8_value);
+    int32_t int32_value {0};
+    EXPECT_EQ(RETCODE_OK, struct_data->get_int32_value(int32_value, 0));
+    EXPECT_EQ(-12, int32_value);
+    std::string string_value;
+    EXPECT_EQ(RETCODE_OK, struct_data->get_string_value(string_value, 1));
+    EXPECT_EQ("flat", string_value);
+    EXPECT_EQ(RETCODE_OK, struct_data->get_float64_value(float64_value, 2));
+    EXPECT_EQ(3.25, float64_value);
+    bool bool_value {false};
+    EXPECT_EQ(RETCODE_OK, struct_data->get_boolean_value(bool_value, 3));
+    EXPECT_TRUE(bool_value);
+    uint64_t uint64_value {0};
+    EXPECT_EQ(RETCODE_OK, struct_data->get_uint64_value(uint64_value, 4));
+    EXPECT_EQ(1234u, uint64_value);
+
+    // Values set through a member are seen through the structure and viceversa.
+    DynamicData::_ref_type member_data = struct_data->loan_value(4);
+    ASSERT_TRUE(member_data);
+    EXPECT_EQ(RETCODE_OK, member_data->get_uint64_value(uint64_value, MEMBER_ID_INVALID));
+    EXPECT_EQ(1234u, uint64_value);
+    EXPECT_EQ(RETCODE_OK, member_data->set_uint64_value(MEMBER_ID_INVALID, 5678u));
+    EXPECT_EQ(RETCODE_OK, struct_data->return_loaned_value(member_data));
+    EXPECT_EQ(RETCODE_OK, struct_data->get_uint64_value(uint64_value, 4));
+    EXPECT_EQ(5678u, uint64_value);
+
+    DynamicData::_ref_type complex_data;
+    EXPECT_EQ(RETCODE_OK, struct_data->get_complex_value(complex_data, 2));
+    ASSERT_TRUE(complex_data);
+    EXPECT_EQ(RETCODE_OK, complex_data->set_float64_value(MEMBER_ID_INVALID, 7.5));
+    EXPECT_EQ(RETCODE_OK, struct_data->set_complex_value(2, complex_data));
+    EXPECT_EQ(RETCODE_OK, struct_data->get_float64_value(float64_value, 2));
+    EXPECT_EQ(7.5, float64_value);
+    EXPECT_EQ(RETCODE_OK, struct_data->set_float64_value(2, 8.5));
+    EXPECT_EQ(RETCODE_OK, struct_data->get_complex_value(complex_data, 2));
+    EXPECT_EQ(RETCODE_OK, complex_data->get_float64_value(float64_value, MEMBER_ID_INVALID));
+    EXPECT_EQ(8.5, float64_value);
+
+    // Clones do not share the flat storage.
+    auto clone = struct_data->clone();
+    ASSERT_TRUE(clone);
+    EXPECT_TRUE(struct_data->equals(clone));
+    EXPECT_EQ(RETCODE_OK, clone->set_int8_value(0, 21));
+    EXPECT_FALSE(struct_data->equals(clone));
+    EXPECT_EQ(RETCODE_OK, struct_data->get_int8_value(int8_value, 0));
+    EXPECT_EQ(-12, int8_value);
+    EXPECT_EQ(RETCODE_OK, clone->get_int8_value(int8_value, 0));
+    EXPECT_EQ(21, int8_value);
+
+    // Encoding/decoding
+    for (auto encoding : encodings)
+    {
+        DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        encoding_decoding_test(struct_type, struct_data, data2, encoding);
+        EXPECT_EQ(RETCODE_OK, data2->get_int8_value(int8_value, 0));
+        EXPECT_EQ(-12, int8_value);
+        EXPECT_EQ(RETCODE_OK, data2->get_uint64_value(uint64_value, 4));
+        EXPECT_EQ(5678u, uint64_value);
+        EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(data2), RETCODE_OK);
+    }
+
+    // Clearing restores the default values.
+    EXPECT_EQ(RETCODE_OK, struct_data->clear_all_values());
+    EXPECT_EQ(RETCODE_OK, struct_data->get_int8_value(int8_value, 0));
+    EXPECT_EQ(0, int8_value);
+    EXPECT_EQ(RETCODE_OK, struct_data->get_float64_value(float64_value, 2));
+    EXPECT_EQ(1.5, float64_value);
+
+    EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
+}
+
+TEST_F(DynamicTypesTests, DynamicType_structure_serialization_plan)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    for (auto extensibility : {ExtensibilityKind::FINAL, ExtensibilityKind::APPENDABLE, ExtensibilityKind::MUTABLE})
+    {
+        TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+        type_descriptor->kind(TK_STRUCTURE);
+        type_descriptor->name("SerializationPlanTest");
+        type_descriptor->extensibility_kind(extensibility);
+        DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+        ASSERT_TRUE(builder);
+
+        // Member identifiers do not follow the declaration order.
+        MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+        member_descriptor->type(factory->get_primitive_type(TK_UINT16));
+        member_descriptor->name("uint16");
+        member_descriptor->id(7);
+        EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+        member_descriptor = traits<MemberDescriptor>::make_shared();
+        member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+        member_descriptor->name("string");
+        member_descriptor->id(2);
+        EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+        member_descriptor = traits<MemberDescriptor>::make_shared();
+        member_descriptor->type(factory->get_primitive_type(TK_INT64));
+        member_descriptor->name("int64");
+        member_descriptor->id(5);
+        EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+        member_descriptor = traits<MemberDescriptor>::make_shared();
+        member_descriptor->type(factory->get_primitive_type(TK_CHAR8));
+        member_descriptor->name("char8");
+        member_descriptor->id(1);
+        EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+        DynamicType::_ref_type struct_type {builder->build()};
+        ASSERT_TRUE(struct_type);
+
+        DynamicData::_ref_type struct_data {DynamicDataFactory::get_instance()->create_data(struct_type)};
+        ASSERT_TRUE(struct_data);
+        EXPECT_EQ(RETCODE_OK, struct_data->set_uint16_value(7, 0xABCD));
+        EXPECT_EQ(RETCODE_OK, struct_data->set_string_value(2, "plan"));
+        EXPECT_EQ(RETCODE_OK, struct_data->set_int64_value(5, -1234567890123));
+        EXPECT_EQ(RETCODE_OK, struct_data->set_char8_value(1, 'p'));
+
+        for (auto encoding : encodings)
+        {
+            DynamicData::_ref_type data2 {DynamicDataFactory::get_instance()->create_data(struct_type)};
+            encoding_decoding_test(struct_type, struct_data, data2, encoding);
+            uint16_t uint16_value {0};
+            EXPECT_EQ(RETCODE_OK, data2->get_uint16_value(uint16_value, 7));
+            EXPECT_EQ(0xABCD, uint16_value);
+            int64_t int64_value {0};
+            EXPECT_EQ(RETCODE_OK, data2->get_int64_value(int64_value, 5));
+            EXPECT_EQ(-1234567890123, int64_value);
+            EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(data2), RETCODE_OK);
+        }
+
+        EXPECT_EQ(DynamicDataFactory::get_instance()->delete_data(struct_data), RETCODE_OK);
+    }
+}
+
 TEST_F(DynamicTypesTests, DynamicType_structure_inheritance)
 {
     DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
@@ -12876,6 +13078,73 @@ TEST_F(DynamicTypesTests, DynamicType_KeyHash_standard_example_2)
     DomainParticipantFactory::get_instance()->delete_participant(participant);
 }
 
+TEST_F(DynamicTypesTests, DynamicType_KeyHash_unbounded_string_key_cache)
+{
+    DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
+
+    TypeDescriptor::_ref_type type_descriptor {traits<TypeDescriptor>::make_shared()};
+    type_descriptor->kind(TK_STRUCTURE);
+    type_descriptor->name("Foo");
+    DynamicTypeBuilder::_ref_type builder {factory->create_type(type_descriptor)};
+    ASSERT_TRUE(builder);
+
+    MemberDescriptor::_ref_type member_descriptor {traits<MemberDescriptor>::make_shared()};
+    member_descriptor->type(factory->create_string_type(static_cast<uint32_t>(LENGTH_UNLIMITED))->build());
+    member_descriptor->name("label");
+    member_descriptor->is_key(true);
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    member_descriptor = traits<MemberDescriptor>::make_shared();
+    member_descriptor->type(factory->get_primitive_type(TK_INT32));
+    member_descriptor->name("x");
+    EXPECT_EQ(builder->add_member(member_descriptor), RETCODE_OK);
+
+    DynamicType::_ref_type struct_type {builder->build()};
+    ASSERT_TRUE(struct_type);
+
+    DynamicData::_ref_type data {DynamicDataFactory::get_instance()->create_data(struct_type)};
+    ASSERT_TRUE(data);
+
+    DynamicPubSubType* dyn_pubsub_type = new DynamicPubSubType(struct_type);
+    TypeSupport pubsubType {dyn_pubsub_type};
+
+    const std::string short_key {"BLUE"};
+    const std::string long_key {"a_key_label_longer_than_sixteen_bytes"};
+
+    // Compute the handles without cache, starting with the short key so the internal buffer has to grow.
+    eprosima::fastdds::rtps::InstanceHandle_t short_handle;
+    eprosima::fastdds::rtps::InstanceHandle_t long_handle;
+    EXPECT_EQ(RETCODE_OK, data->set_string_value(0, short_key));
+    ASSERT_TRUE(pubsubType.compute_key(&data, short_handle));
+    EXPECT_EQ(RETCODE_OK, data->set_string_value(0, long_key));
+    ASSERT_TRUE(pubsubType.compute_key(&data, long_handle));
+    EXPECT_NE(short_handle, long_handle);
+
+    // Going back to the short key should give the same handle as before.
+    eprosima::fastdds::rtps::InstanceHandle_t instance_handle;
+    EXPECT_EQ(RETCODE_OK, data->set_string_value(0, short_key));
+    ASSERT_TRUE(pubsubType.compute_key(&data, instance_handle));
+    EXPECT_EQ(short_handle, instance_handle);
+
+    // Cached handles should be the same as the computed ones.
+    dyn_pubsub_type->set_key_hash_cache_limit(1);
+    for (int i = 0; i < 3; ++i)
+    {
+        instance_handle.clear();
+        EXPECT_EQ(RETCODE_OK, data->set_string_value(0, long_key));
+        EXPECT_EQ(RETCODE_OK, data->set_int32_value(1, i));
+        ASSERT_TRUE(pubsubType.compute_key(&data, instance_handle));
+        EXPECT_EQ(long_handle, instance_handle);
+
+        instance_handle.clear();
+        EXPECT_EQ(RETCODE_OK, data->set_string_value(0, short_key));
+        ASSERT_TRUE(pubsubType.compute_key(&data, instance_handle));
+        EXPECT_EQ(short_handle, instance_handle);
+    }
+
+    EXPECT_EQ(RETCODE_OK, DynamicDataFactory::get_instance()->delete_data(data));
+}
+
 TEST_F(DynamicTypesTests, DynamicType_KeyHash_standard_example_3)
 {
     DynamicTypeBuilderFactory::_ref_type factory {DynamicTypeBuilderFactory::get_instance()};
@@ -33,6 +33,7 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 
 #include <fastdds/publisher/history/DataWriterInstance.hpp>
+#include <utils/collections/DeadlineQueue.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -230,9 +231,10 @@ public:
     }
 
     bool set_next_deadline(
-            const InstanceHandle_t&,
-            const std::chrono::steady_clock::time_point&)
+            const InstanceHandle_t& handle,
+            const std::chrono::steady_clock::time_point& next_deadline_us)
     {
+        instance_deadlines_.set(handle, next_deadline_us);
         return true;
     }
 
@@ -255,10 +257,10 @@ public:
     }
 
     bool get_next_deadline(
-            InstanceHandle_t&,
-            std::chrono::steady_clock::time_point&)
+            InstanceHandle_t& handle,
+            std::chrono::steady_clock::time_point& next_deadline_us)
     {
-        return true;
+        return instance_deadlines_.front(handle, next_deadline_us);
     }
 
     bool remove_change_pub(
@@ -310,6 +312,8 @@ private:
 
     //!Map where keys are instance handles and values are vectors of cache changes associated
     t_m_Inst_Caches keyed_changes_;
+    //!Instances sorted by their next deadline
+    utilities::collections::DeadlineQueue<InstanceHandle_t> instance_deadlines_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
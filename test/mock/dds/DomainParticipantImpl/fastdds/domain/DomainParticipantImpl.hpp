@@ -58,6 +58,9 @@
 
 namespace eprosima {
 namespace fastdds {
+
+class JobThreadPool;
+
 namespace dds {
 
 class DomainParticipant;
@@ -464,6 +467,9 @@ public:
     MOCK_METHOD1(ignore_participant, bool (
                 const fastdds::rtps::InstanceHandle_t& handle));
 
+    MOCK_CONST_METHOD1(get_memory_usage, ReturnCode_t (
+                fastdds::rtps::ParticipantMemoryUsage& usage));
+
     MOCK_METHOD2(find_service_type, rpc::ServiceTypeSupport(
                 const std::string& service_name,
                 ReturnCode_t & ret_code));
@@ -842,6 +848,11 @@ public:
         return rtps_participant_;
     }
 
+    fastdds::JobThreadPool* listener_dispatch_pool() const
+    {
+        return nullptr;
+    }
+
     const TypeSupport find_type(
             const std::string& type_name) const
     {
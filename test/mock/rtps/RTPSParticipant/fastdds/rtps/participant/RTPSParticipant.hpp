@@ -31,6 +31,7 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.hpp>
 #include <fastdds/rtps/builtin/data/ParticipantBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/Guid.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 
 #include <rtps/reader/StatefulReader.hpp>
 #include <rtps/resources/ResourceEvent.h>
@@ -255,6 +256,8 @@ public:
             (fastdds::rtps::SubscriptionBuiltinTopicData&,
             const GUID_t&), (const));
 
+    MOCK_METHOD(void, get_memory_usage, (ParticipantMemoryUsage&), (const));
+
     bool update_attributes(
             const RTPSParticipantAttributes& patt)
     {
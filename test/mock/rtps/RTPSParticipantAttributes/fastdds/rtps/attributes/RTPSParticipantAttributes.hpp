@@ -746,6 +746,8 @@ public:
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
                (this->typelookup_service_thread == b.typelookup_service_thread) &&
+               (this->persistence_thread == b.persistence_thread) &&
+               (this->listener_dispatch_thread == b.listener_dispatch_thread) &&
                (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
 
     }
@@ -898,6 +900,12 @@ public:
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     fastdds::rtps::ThreadSettings typelookup_service_thread;
 
+    //! Thread settings for the thread committing the changes of the persistence service in the background
+    fastdds::rtps::ThreadSettings persistence_thread;
+
+    //! Thread settings for the threads calling the data listeners of the DataReaders
+    fastdds::rtps::ThreadSettings listener_dispatch_thread;
+
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
@@ -999,6 +1007,8 @@ public:
         , timed_events_thread(attrs.timed_events_thread)
         , discovery_server_thread(attrs.discovery_server_thread)
         , typelookup_service_thread(attrs.typelookup_service_thread)
+        , persistence_thread(attrs.persistence_thread)
+        , listener_dispatch_thread(attrs.listener_dispatch_thread)
         , builtin_transports_reception_threads(attrs.builtin_transports_reception_threads)
 #if HAVE_SECURITY
         , security_log_thread(attrs.security_log_thread)
@@ -1034,6 +1044,8 @@ public:
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
                (this->typelookup_service_thread == b.typelookup_service_thread) &&
+               (this->persistence_thread == b.persistence_thread) &&
+               (this->listener_dispatch_thread == b.listener_dispatch_thread) &&
                (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
     }
 
@@ -1123,6 +1135,12 @@ public:
     //! Thread settings for the builtin TypeLookup service requests and replies threads
     fastdds::rtps::ThreadSettings typelookup_service_thread;
 
+    //! Thread settings for the thread committing the changes of the persistence service in the background
+    fastdds::rtps::ThreadSettings persistence_thread;
+
+    //! Thread settings for the threads calling the data listeners of the DataReaders
+    fastdds::rtps::ThreadSettings listener_dispatch_thread;
+
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
@@ -24,6 +24,7 @@
 #include <fastdds/rtps/attributes/ReaderAttributes.hpp>
 #include <fastdds/rtps/attributes/WriterAttributes.hpp>
 #include <fastdds/rtps/builtin/data/PublicationBuiltinTopicData.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/Endpoint.hpp>
 #include <fastdds/rtps/history/ReaderHistory.hpp>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
@@ -74,6 +75,11 @@ public:
         return false;
     }
 
+    virtual void get_memory_usage(
+            EndpointMemoryUsage&) const
+    {
+    }
+
     virtual bool is_in_clean_state() = 0;
 
     virtual ReaderListener* get_listener() const = 0;
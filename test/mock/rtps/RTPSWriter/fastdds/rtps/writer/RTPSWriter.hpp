@@ -28,6 +28,7 @@
 #include <fastdds/rtps/attributes/WriterAttributes.hpp>
 #include <fastdds/rtps/builtin/data/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/rtps/common/CacheChange.hpp>
+#include <fastdds/rtps/common/MemoryUsage.hpp>
 #include <fastdds/rtps/common/VendorId_t.hpp>
 #include <fastdds/rtps/Endpoint.hpp>
 #include <fastdds/rtps/interfaces/IReaderDataFilter.hpp>
@@ -91,6 +92,21 @@ public:
         return false;
     }
 
+    virtual void get_memory_usage(
+            EndpointMemoryUsage&) const
+    {
+    }
+
+    virtual uint64_t get_merged_repairs_count() const
+    {
+        return 0;
+    }
+
+    virtual uint64_t get_flow_controller_deadline_misses() const
+    {
+        return 0;
+    }
+
     virtual bool has_been_fully_delivered(
             const SequenceNumber_t& /*seq_num*/) const
     {
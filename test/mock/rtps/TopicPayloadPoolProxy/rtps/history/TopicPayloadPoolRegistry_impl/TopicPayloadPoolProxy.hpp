@@ -129,6 +129,11 @@ public:
         return inner_pool_->payload_pool_available_size();
     }
 
+    size_t payload_pool_allocated_bytes() const override
+    {
+        return inner_pool_->payload_pool_allocated_bytes();
+    }
+
 private:
 
     std::string topic_name_;
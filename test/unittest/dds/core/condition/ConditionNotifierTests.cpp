@@ -34,8 +34,8 @@ class TestCondition : public Condition
 TEST(ConditionNotifierTests, basic_test)
 {
     WaitSetImpl wait_set;
-    ConditionNotifier notifier;
     TestCondition condition;
+    ConditionNotifier notifier(condition);
 
     auto test_steps = [&]()
             {
@@ -74,7 +74,7 @@ TEST(ConditionNotifierTests, basic_test)
                 notifier.will_be_deleted(condition);
             };
 
-    EXPECT_CALL(wait_set, wake_up()).Times(4);
+    EXPECT_CALL(wait_set, wake_up(::testing::Ref(condition))).Times(4);
     EXPECT_CALL(wait_set, will_be_deleted(_)).Times(4);
     test_steps();
     testing::Mock::VerifyAndClearExpectations(&wait_set);
@@ -82,9 +82,9 @@ TEST(ConditionNotifierTests, basic_test)
     WaitSetImpl other_waitset;
     notifier.attach_to(&other_waitset);
 
-    EXPECT_CALL(wait_set, wake_up()).Times(4);
+    EXPECT_CALL(wait_set, wake_up(::testing::Ref(condition))).Times(4);
     EXPECT_CALL(wait_set, will_be_deleted(_)).Times(4);
-    EXPECT_CALL(other_waitset, wake_up()).Times(7);
+    EXPECT_CALL(other_waitset, wake_up(::testing::Ref(condition))).Times(7);
     EXPECT_CALL(other_waitset, will_be_deleted(_)).Times(7);
     test_steps();
 }
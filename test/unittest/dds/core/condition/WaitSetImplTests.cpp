@@ -14,8 +14,12 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <future>
+#include <memory>
 #include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -122,8 +126,10 @@ TEST(WaitSetImplTests, wait)
         EXPECT_EQ(RETCODE_TIMEOUT, wait_set.wait(conditions, timeout));
         EXPECT_TRUE(conditions.empty());
 
-        // Waiting on already triggered condition should inmediately return condition
+        // Waiting on already triggered condition should inmediately return condition.
+        // Conditions inform their notifier when triggered, which calls wake_up.
         condition.trigger_value = true;
+        wait_set.wake_up(condition);
         EXPECT_EQ(RETCODE_OK, wait_set.wait(conditions, timeout));
         EXPECT_EQ(1u, conditions.size());
         EXPECT_NE(conditions.cend(), std::find(conditions.cbegin(), conditions.cend(), &condition));
@@ -267,6 +273,172 @@ TEST(WaitSetImplTests, fix_wait_notification_lost)
     }
 }
 
+/*
+ * Condition counting the number of times its trigger value is evaluated.
+ */
+class CountingCondition : public Condition
+{
+public:
+
+    std::atomic<bool> trigger_value {false};
+    mutable std::atomic<uint32_t> num_evaluations {0};
+
+    bool get_trigger_value() const override
+    {
+        ++num_evaluations;
+        return trigger_value;
+    }
+
+};
+
+TEST(WaitSetImplTests, edge_triggered_wait)
+{
+    const eprosima::fastdds::dds::Duration_t timeout{ 0, 100000000 };
+
+    constexpr size_t num_conditions = 10;
+    std::vector<std::unique_ptr<CountingCondition>> conditions;
+    ConditionSeq active_conditions;
+    WaitSetImpl wait_set;
+
+    for (size_t i = 0; i < num_conditions; ++i)
+    {
+        conditions.emplace_back(new CountingCondition());
+        auto notifier = conditions.back()->get_notifier();
+        EXPECT_CALL(*notifier, attach_to(_)).Times(1);
+        EXPECT_CALL(*notifier, will_be_deleted(_)).Times(1);
+        EXPECT_EQ(RETCODE_OK, wait_set.attach_condition(*conditions.back()));
+    }
+
+    // Conditions are evaluated once after being attached.
+    EXPECT_EQ(RETCODE_TIMEOUT, wait_set.wait(active_conditions, timeout));
+    for (const auto& condition : conditions)
+    {
+        EXPECT_EQ(1u, condition->num_evaluations.exchange(0));
+    }
+
+    // Only the notified condition is evaluated.
+    conditions[3]->trigger_value = true;
+    wait_set.wake_up(*conditions[3]);
+    wait_set.wake_up(*conditions[3]);
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(active_conditions, timeout));
+    ASSERT_EQ(1u, active_conditions.size());
+    EXPECT_EQ(conditions[3].get(), active_conditions[0]);
+    for (size_t i = 0; i < num_conditions; ++i)
+    {
+        EXPECT_EQ(3u == i ? 1u : 0u, conditions[i]->num_evaluations.exchange(0));
+    }
+
+    // A triggered condition is returned again while it is triggered, without being notified.
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(active_conditions, timeout));
+    ASSERT_EQ(1u, active_conditions.size());
+    EXPECT_EQ(conditions[3].get(), active_conditions[0]);
+    conditions[3]->trigger_value = false;
+    EXPECT_EQ(RETCODE_TIMEOUT, wait_set.wait(active_conditions, timeout));
+    EXPECT_TRUE(active_conditions.empty());
+    for (size_t i = 0; i < num_conditions; ++i)
+    {
+        EXPECT_EQ(3u == i ? 2u : 0u, conditions[i]->num_evaluations.exchange(0));
+    }
+
+    // A notification wakes up a waiting thread.
+    std::thread trigger_and_notify([&]()
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                conditions[7]->trigger_value = true;
+                wait_set.wake_up(*conditions[7]);
+            });
+    EXPECT_EQ(RETCODE_OK, wait_set.wait(active_conditions, eprosima::fastdds::dds::c_TimeInfinite));
+    ASSERT_EQ(1u, active_conditions.size());
+    EXPECT_EQ(conditions[7].get(), active_conditions[0]);
+    trigger_and_notify.join();
+
+    // A detached condition is not returned, even if it was notified.
+    auto notifier = conditions[7]->get_notifier();
+    EXPECT_CALL(*notifier, detach_from(_)).Times(1);
+    EXPECT_EQ(RETCODE_OK, wait_set.detach_condition(*conditions[7]));
+    EXPECT_EQ(RETCODE_TIMEOUT, wait_set.wait(active_conditions, timeout));
+    EXPECT_TRUE(active_conditions.empty());
+
+    for (const auto& condition : conditions)
+    {
+        wait_set.will_be_deleted(*condition);
+    }
+}
+
+/*
+ * Notifies each condition attached to a WaitSet in turn, waiting for a thread waiting on the WaitSet to be woken up by
+ * each notification. Returns the number of evaluations of the conditions.
+ */
+static void notify_conditions(
+        size_t num_conditions,
+        size_t num_notifications,
+        uint64_t& num_evaluations)
+{
+    std::vector<std::unique_ptr<CountingCondition>> conditions;
+    WaitSetImpl wait_set;
+
+    for (size_t i = 0; i < num_conditions; ++i)
+    {
+        conditions.emplace_back(new CountingCondition());
+        auto notifier = conditions.back()->get_notifier();
+        EXPECT_CALL(*notifier, attach_to(_)).Times(1);
+        EXPECT_CALL(*notifier, will_be_deleted(_)).Times(1);
+        EXPECT_EQ(RETCODE_OK, wait_set.attach_condition(*conditions.back()));
+    }
+
+    std::atomic<size_t> num_woken_up{0};
+    std::thread waiting_thread([&]()
+            {
+                ConditionSeq active_conditions;
+                while (num_woken_up < num_notifications)
+                {
+                    if (RETCODE_OK == wait_set.wait(active_conditions, eprosima::fastdds::dds::c_TimeInfinite))
+                    {
+                        for (Condition* condition : active_conditions)
+                        {
+                            static_cast<CountingCondition*>(condition)->trigger_value = false;
+                            ++num_woken_up;
+                        }
+                    }
+                }
+            });
+
+    for (size_t i = 0; i < num_notifications; ++i)
+    {
+        CountingCondition& condition = *conditions[i % num_conditions];
+        condition.trigger_value = true;
+        wait_set.wake_up(condition);
+        while (num_woken_up <= i)
+        {
+            std::this_thread::yield();
+        }
+    }
+    waiting_thread.join();
+
+    num_evaluations = 0;
+    for (const auto& condition : conditions)
+    {
+        num_evaluations += condition->num_evaluations;
+        wait_set.will_be_deleted(*condition);
+    }
+}
+
+/*
+ * Checks that a thread waiting on a WaitSet with many attached conditions only evaluates the notified condition on
+ * each wake up.
+ */
+TEST(WaitSetImplTests, scaling)
+{
+    constexpr size_t num_conditions = 100;
+    constexpr size_t num_notifications = 1000;
+
+    uint64_t num_evaluations = 0;
+    notify_conditions(num_conditions, num_notifications, num_evaluations);
+
+    // Each notification evaluates the notified condition, and the next wait evaluates it again after being reset.
+    EXPECT_LE(num_evaluations, num_conditions + 3 * num_notifications);
+}
+
 int main(
         int argc,
         char** argv)
@@ -32,6 +32,13 @@ struct WaitSetImpl;
 
 struct ConditionNotifier
 {
+    ConditionNotifier() = default;
+
+    explicit ConditionNotifier(
+            const Condition&)
+    {
+    }
+
     /**
      * Add a WaitSet implementation to the list of attached entries.
      * Does nothing if wait_set was already attached to this notifier.
@@ -47,7 +54,7 @@ struct ConditionNotifier
     MOCK_METHOD1(detach_from, void(WaitSetImpl * wait_set));
 
     /**
-     * Wake up all the WaitSet implementations attached to this notifier.
+     * Inform all the WaitSet implementations attached to this notifier that the condition may have been triggered.
      */
     MOCK_METHOD0(notify, void());
 
@@ -31,9 +31,9 @@ namespace detail {
 struct WaitSetImpl
 {
     /**
-     * @brief Wake up this WaitSet implementation if it was waiting
+     * @brief Called by the notifier of an attached condition when it may have been triggered.
      */
-    MOCK_METHOD0(wake_up, void());
+    MOCK_METHOD1(wake_up, void(const Condition& condition));
 
     /**
      * @brief Called from the destructor of a Condition to inform this WaitSet implementation that the condition
@@ -504,6 +504,8 @@ void check_equivalent_qos(
     ASSERT_EQ(qos_1.timed_events_thread(), qos_2.timed_events_thread());
     ASSERT_EQ(qos_1.discovery_server_thread(), qos_2.discovery_server_thread());
     ASSERT_EQ(qos_1.typelookup_service_thread(), qos_2.typelookup_service_thread());
+    ASSERT_EQ(qos_1.persistence_thread(), qos_2.persistence_thread());
+    ASSERT_EQ(qos_1.listener_dispatch_thread(), qos_2.listener_dispatch_thread());
 #if HAVE_SECURITY
     ASSERT_EQ(qos_1.security_log_thread(), qos_2.security_log_thread());
 #endif // if HAVE_SECURITY
@@ -4085,6 +4087,16 @@ TEST(ParticipantTests, UpdatableDomainParticipantQos)
     pqos.typelookup_service_thread().affinity = 1;
     ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
 
+    // Check that the persistence_thread can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.persistence_thread().affinity = 1;
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
+    // Check that the listener_dispatch_thread can not be changed in an enabled participant
+    participant->get_qos(pqos);
+    pqos.listener_dispatch_thread().affinity = 1;
+    ASSERT_EQ(participant->set_qos(pqos), RETCODE_IMMUTABLE_POLICY);
+
 #if HAVE_SECURITY
     // Check that the security_log_thread can not be changed in an enabled participant
     participant->get_qos(pqos);
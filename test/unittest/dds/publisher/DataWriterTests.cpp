@@ -16,6 +16,7 @@
 #include <chrono>
 #include <condition_variable>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <mutex>
 #include <thread>
@@ -2963,6 +2964,139 @@ TEST(DataWriterTests, ConcurrentSetQosVsGetQos)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
 }
 
+// Keyed type whose samples are the uint32_t index of their instance
+class IndexedInstanceTopicDataTypeMock : public InstanceTopicDataTypeMock
+{
+public:
+
+    bool compute_key(
+            const void* const data,
+            fastdds::rtps::InstanceHandle_t& ihandle,
+            bool /*force_md5*/) override
+    {
+        const uint32_t index = *static_cast<const uint32_t*>(data);
+        for (size_t i = 0; i < sizeof(index); ++i)
+        {
+            ihandle.value[i] = static_cast<fastdds::rtps::octet>(index >> (8 * i));
+        }
+        ihandle.value[15] = 1;
+        return true;
+    }
+
+};
+
+/*
+ * Writes once on several instances with a deadline, checking that the deadline of every instance is missed, as the
+ * deadline timer is scheduled again for the next instance each time it expires.
+ */
+TEST(DataWriterTests, instance_deadlines)
+{
+    constexpr uint32_t num_instances = 20;
+
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new IndexedInstanceTopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("instance_deadlines_topic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    qos.history().depth = 1;
+    qos.deadline().period = Duration_t(0, 50000000);
+
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    for (uint32_t index = 0; index < num_instances; ++index)
+    {
+        ASSERT_EQ(RETCODE_OK, datawriter->write(&index));
+    }
+
+    OfferedDeadlineMissedStatus status;
+    auto max_time = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    do
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        ASSERT_EQ(RETCODE_OK, datawriter->get_offered_deadline_missed_status(status));
+    } while (status.total_count < num_instances && std::chrono::steady_clock::now() < max_time);
+    EXPECT_GE(status.total_count, num_instances);
+
+    ASSERT_EQ(RETCODE_OK, publisher->delete_datawriter(datawriter));
+    ASSERT_TRUE(participant->delete_topic(topic) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
+}
+
+/*
+ * Check the memory usage reported by the DataWriter and its DomainParticipant.
+ */
+TEST(DataWriterTests, get_memory_usage)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    fastdds::rtps::ParticipantMemoryUsage participant_usage;
+    ASSERT_EQ(RETCODE_OK, participant->get_memory_usage(participant_usage));
+    EXPECT_LT(0u, participant_usage.send_buffers.elements);
+    EXPECT_LT(0u, participant_usage.send_buffers.bytes);
+    EXPECT_LE(1u, participant_usage.discovered_participants.elements);
+    EXPECT_LT(0u, participant_usage.discovered_participants.bytes);
+
+    PublisherQos pub_qos = PUBLISHER_QOS_DEFAULT;
+    pub_qos.entity_factory().autoenable_created_entities = false;
+    Publisher* publisher = participant->create_publisher(pub_qos);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.reliability().kind = BEST_EFFORT_RELIABILITY_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    fastdds::rtps::EndpointMemoryUsage usage;
+    EXPECT_EQ(RETCODE_NOT_ENABLED, datawriter->get_memory_usage(usage));
+    ASSERT_EQ(RETCODE_OK, datawriter->enable());
+
+    ASSERT_EQ(RETCODE_OK, datawriter->get_memory_usage(usage));
+    EXPECT_EQ(0u, usage.history.elements);
+    EXPECT_EQ(0u, usage.history.bytes);
+
+    FooType data;
+    data.message("HelloWorld");
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, datawriter->write(&data, HANDLE_NIL));
+    }
+
+    ASSERT_EQ(RETCODE_OK, datawriter->get_memory_usage(usage));
+    EXPECT_EQ(5u, usage.history.elements);
+    EXPECT_LE(5u * sizeof(fastdds::rtps::CacheChange_t), usage.history.bytes);
+    EXPECT_LE(usage.history.elements, usage.change_pool.elements);
+    EXPECT_LE(usage.history.bytes, usage.change_pool.bytes);
+    EXPECT_LE(usage.history.elements, usage.payload_pool.elements);
+    EXPECT_LT(0u, usage.payload_pool.bytes);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == RETCODE_OK);
+}
+
 } // namespace dds
 } // namespace fastdds
 } // namespace eprosima
@@ -233,6 +233,53 @@ TEST(DataReaderHistory, exclusive_ownership_keyed_sample_reception)
     ASSERT_EQ(18u, history.getHistorySize());
 }
 
+/*!
+ * Tests that the deadline of an instance evicted to make room for a new one is not tracked anymore.
+ */
+TEST(DataReaderHistory, deadline_of_evicted_instance)
+{
+    TestType* type_ = new TestType();
+
+    const TypeSupport type(type_);
+    type->is_compute_key_provided = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = 1;
+    DataReaderHistory history(type, nullptr, topic, qos);
+    eprosima::fastdds::RecursiveTimedMutex mutex;
+    eprosima::fastdds::rtps::StatelessReader reader(&history, &mutex);
+    std::vector<std::unique_ptr<eprosima::fastdds::rtps::CacheChange_t>> changes;
+
+    const InstanceHandle_t instance_1 = eprosima::fastdds::rtps::GUID_t{{}, 1};
+    const InstanceHandle_t instance_2 = eprosima::fastdds::rtps::GUID_t{{}, 2};
+    eprosima::fastdds::rtps::CacheChange_t dw_change;
+    dw_change.writerGUID = {{}, 1};
+
+    // Receives instance 1, which has a deadline.
+    dw_change.instanceHandle = instance_1;
+    ASSERT_TRUE(add_test_change(history, dw_change, changes));
+    ASSERT_TRUE(history.set_next_deadline(instance_1, std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+    InstanceHandle_t handle;
+    std::chrono::steady_clock::time_point next_deadline;
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance_1, handle);
+
+    // Instance 1 is disposed, so it is evicted when instance 2 is received.
+    dw_change.kind = eprosima::fastdds::rtps::NOT_ALIVE_DISPOSED;
+    ASSERT_TRUE(add_test_change(history, dw_change, changes));
+    dw_change.kind = eprosima::fastdds::rtps::ALIVE;
+    dw_change.instanceHandle = instance_2;
+    ASSERT_TRUE(add_test_change(history, dw_change, changes));
+
+    // Only instance 2 could have a deadline now.
+    EXPECT_FALSE(history.get_next_deadline(handle, next_deadline));
+    ASSERT_TRUE(history.set_next_deadline(instance_2, std::chrono::steady_clock::now() + std::chrono::seconds(1)));
+    ASSERT_TRUE(history.get_next_deadline(handle, next_deadline));
+    EXPECT_EQ(instance_2, handle);
+    EXPECT_FALSE(history.set_next_deadline(instance_1, std::chrono::steady_clock::now()));
+}
+
 int main(
         int argc,
         char** argv)
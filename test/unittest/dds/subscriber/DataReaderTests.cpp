@@ -15,10 +15,14 @@
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <forward_list>
+#include <future>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <sstream>
 #include <thread>
 #include <type_traits>
@@ -37,6 +41,7 @@
 #include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/core/StackAllocatedSequence.hpp>
 #include <fastdds/dds/core/status/BaseStatus.hpp>
+#include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
 #include <fastdds/dds/core/status/SampleRejectedStatus.hpp>
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/domain/DomainParticipant.hpp>
@@ -2464,6 +2469,336 @@ TEST_F(DataReaderTests, SetListener)
     }
 }
 
+static bool wait_for_matched_readers(
+        DataWriter* writer,
+        int32_t num_readers,
+        std::chrono::seconds timeout)
+{
+    PublicationMatchedStatus matched_status;
+    auto limit = std::chrono::steady_clock::now() + timeout;
+    writer->get_publication_matched_status(matched_status);
+    while (matched_status.current_count < num_readers && std::chrono::steady_clock::now() < limit)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        writer->get_publication_matched_status(matched_status);
+    }
+    return matched_status.current_count == num_readers;
+}
+
+/*
+ * Listener taking 1 ms on each call, which takes all the available samples.
+ */
+class SlowDataListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        uint32_t num_taken = 0;
+        FooSeq data;
+        SampleInfoSeq infos;
+        while (RETCODE_OK == reader->take(data, infos))
+        {
+            for (LoanableCollection::size_type i = 0; i < infos.length(); ++i)
+            {
+                if (infos[i].valid_data)
+                {
+                    ++num_taken;
+                }
+            }
+            reader->return_loan(data, infos);
+        }
+
+        std::lock_guard<std::mutex> lock(mtx_);
+        ++num_calls_;
+        num_samples_ += num_taken;
+        threads_.insert(std::this_thread::get_id());
+        cv_.notify_all();
+    }
+
+    bool wait_for(
+            uint32_t num_samples,
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return cv_.wait_for(lock, timeout, [this, num_samples]()
+                       {
+                           return num_samples_ >= num_samples;
+                       });
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    uint32_t num_calls_ = 0;
+    uint32_t num_samples_ = 0;
+    std::set<std::thread::id> threads_;
+};
+
+/*
+ * This test checks that, when the participant has a listener dispatch pool, the data listeners are called from the
+ * threads of the pool, so a listener taking 1 ms per call does not block the thread delivering the samples, and the
+ * notifications arriving while the listener is being called are coalesced.
+ */
+TEST_F(DataReaderTests, listener_dispatch_pool)
+{
+    constexpr uint32_t num_samples = 100;
+
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    participant_qos.properties().properties().emplace_back("fastdds.listener_dispatch.threads", "1");
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    SlowDataListener listener;
+    create_entities(
+        &listener,
+        reader_qos,
+        SUBSCRIBER_QOS_DEFAULT,
+        writer_qos,
+        PUBLISHER_QOS_DEFAULT,
+        TOPIC_QOS_DEFAULT,
+        participant_qos);
+
+    ASSERT_TRUE(wait_for_matched_readers(data_writer_, 1, std::chrono::seconds(1)));
+
+    FooType data;
+    data.index(0);
+
+    for (uint32_t i = 0; i < num_samples; ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    }
+    ASSERT_TRUE(listener.wait_for(num_samples, std::chrono::seconds(10)));
+
+    std::lock_guard<std::mutex> lock(listener.mtx_);
+    EXPECT_EQ(num_samples, listener.num_samples_);
+    EXPECT_LE(listener.num_calls_, num_samples);
+    EXPECT_EQ(1u, listener.threads_.size());
+    EXPECT_EQ(0u, listener.threads_.count(std::this_thread::get_id()));
+}
+
+/*
+ * Listener deleting its DataReader when called.
+ */
+class DeletingDataListener : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* reader) override
+    {
+        ReturnCode_t ret_code = reader->get_subscriber()->delete_datareader(reader);
+
+        std::lock_guard<std::mutex> lock(mtx_);
+        ret_code_ = ret_code;
+        deleted_ = true;
+        cv_.notify_all();
+    }
+
+    bool wait_deleted(
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mtx_);
+        return cv_.wait_for(lock, timeout, [this]()
+                       {
+                           return deleted_;
+                       });
+    }
+
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    bool deleted_ = false;
+    ReturnCode_t ret_code_ = RETCODE_ERROR;
+};
+
+/*
+ * This test checks that, when the participant has a listener dispatch pool, a DataReader can be deleted from its own
+ * data listener and from the completion of its async_take, which are called from the threads of the pool.
+ */
+TEST_F(DataReaderTests, listener_dispatch_pool_delete_reader)
+{
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+    participant_qos.properties().properties().emplace_back("fastdds.listener_dispatch.threads", "1");
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DeletingDataListener listener;
+    create_entities(
+        &listener,
+        reader_qos,
+        SUBSCRIBER_QOS_DEFAULT,
+        DATAWRITER_QOS_DEFAULT,
+        PUBLISHER_QOS_DEFAULT,
+        TOPIC_QOS_DEFAULT,
+        participant_qos);
+    ASSERT_TRUE(wait_for_matched_readers(data_writer_, 1, std::chrono::seconds(1)));
+
+    FooType data;
+    data.index(0);
+
+    // Deleted from its data listener.
+    ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    ASSERT_TRUE(listener.wait_deleted(std::chrono::seconds(10)));
+    data_reader_ = nullptr;
+    EXPECT_EQ(RETCODE_OK, listener.ret_code_);
+
+    // Deleted from the completion of its async_take.
+    DataReader* reader = subscriber_->create_datareader(topic_, reader_qos);
+    ASSERT_NE(nullptr, reader);
+    ASSERT_TRUE(wait_for_matched_readers(data_writer_, 1, std::chrono::seconds(1)));
+
+    FooSeq data_values;
+    SampleInfoSeq infos;
+    std::promise<ReturnCode_t> deleted;
+    ASSERT_EQ(RETCODE_OK, reader->async_take(data_values, infos, LENGTH_UNLIMITED, [&](ReturnCode_t code)
+            {
+                EXPECT_EQ(RETCODE_OK, code);
+                EXPECT_EQ(RETCODE_OK, reader->return_loan(data_values, infos));
+                deleted.set_value(subscriber_->delete_datareader(reader));
+            }));
+    ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    std::future<ReturnCode_t> deleted_future = deleted.get_future();
+    ASSERT_EQ(std::future_status::ready, deleted_future.wait_for(std::chrono::seconds(10)));
+    EXPECT_EQ(RETCODE_OK, deleted_future.get());
+}
+
+/*
+ * This test checks the behavior of async_take, both with the completion function and with the future.
+ */
+TEST_F(DataReaderTests, async_take)
+{
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_entities(nullptr, reader_qos);
+    ASSERT_TRUE(wait_for_matched_readers(data_writer_, 1, std::chrono::seconds(1)));
+
+    FooType data;
+    data.index(0);
+    FooSeq data_values;
+    SampleInfoSeq infos;
+
+    // Pending take completed when a sample arrives.
+    std::future<ReturnCode_t> result = data_reader_->async_take(data_values, infos);
+    EXPECT_EQ(std::future_status::timeout, result.wait_for(std::chrono::milliseconds(0)));
+
+    // Only one take can be pending.
+    EXPECT_EQ(RETCODE_PRECONDITION_NOT_MET, data_reader_->async_take(data_values, infos, 1, [](ReturnCode_t)
+            {
+                FAIL();
+            }));
+
+    ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(3)));
+    EXPECT_EQ(RETCODE_OK, result.get());
+    ASSERT_EQ(1, infos.length());
+    EXPECT_TRUE(infos[0].valid_data);
+    EXPECT_EQ(RETCODE_OK, data_reader_->return_loan(data_values, infos));
+
+    // Take completed before returning when there are samples available.
+    ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    ASSERT_TRUE(data_reader_->wait_for_unread_message(Duration_t(3, 0)));
+    ReturnCode_t completion_code = RETCODE_ERROR;
+    EXPECT_EQ(RETCODE_OK, data_reader_->async_take(data_values, infos, 1, [&completion_code](ReturnCode_t code)
+            {
+                completion_code = code;
+            }));
+    EXPECT_EQ(RETCODE_OK, completion_code);
+    EXPECT_EQ(1, infos.length());
+    EXPECT_EQ(RETCODE_OK, data_reader_->return_loan(data_values, infos));
+
+    // Cancelled take is not completed.
+    EXPECT_EQ(RETCODE_PRECONDITION_NOT_MET, data_reader_->cancel_async_take());
+    EXPECT_EQ(RETCODE_OK, data_reader_->async_take(data_values, infos, 1, [](ReturnCode_t)
+            {
+                FAIL();
+            }));
+    EXPECT_EQ(RETCODE_OK, data_reader_->cancel_async_take());
+    EXPECT_EQ(RETCODE_PRECONDITION_NOT_MET, data_reader_->cancel_async_take());
+
+    // Cancelled take satisfies the future with no data.
+    result = data_reader_->async_take(data_values, infos);
+    EXPECT_EQ(RETCODE_OK, data_reader_->cancel_async_take());
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_EQ(RETCODE_NO_DATA, result.get());
+
+    // Pending take completed when the reader is deleted.
+    result = data_reader_->async_take(data_values, infos);
+    ASSERT_EQ(RETCODE_OK, subscriber_->delete_datareader(data_reader_));
+    data_reader_ = nullptr;
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::milliseconds(0)));
+    EXPECT_EQ(RETCODE_ALREADY_DELETED, result.get());
+}
+
+/*
+ * This test checks that the pending async takes of several readers are all completed by a single sample, with no
+ * thread waiting for them.
+ */
+TEST_F(DataReaderTests, async_take_many_readers)
+{
+    constexpr size_t num_readers = 10;
+
+    create_entities();
+
+    std::vector<DataReader*> readers{data_reader_};
+    for (size_t i = 1; i < num_readers; ++i)
+    {
+        readers.push_back(subscriber_->create_datareader(topic_, DATAREADER_QOS_DEFAULT));
+        ASSERT_NE(nullptr, readers.back());
+    }
+    ASSERT_TRUE(wait_for_matched_readers(data_writer_, num_readers, std::chrono::seconds(10)));
+
+    std::unique_ptr<FooSeq[]> data_values(new FooSeq[num_readers]);
+    std::unique_ptr<SampleInfoSeq[]> infos(new SampleInfoSeq[num_readers]);
+    FooType data;
+    data.index(1);
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    size_t num_completed = 0;
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, readers[i]->async_take(data_values[i], infos[i], LENGTH_UNLIMITED,
+                [&](ReturnCode_t code)
+                {
+                    EXPECT_EQ(RETCODE_OK, code);
+                    std::lock_guard<std::mutex> lock(mtx);
+                    ++num_completed;
+                    cv.notify_all();
+                }));
+    }
+
+    ASSERT_EQ(RETCODE_OK, data_writer_->write(&data));
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(10), [&]()
+                {
+                    return num_readers == num_completed;
+                }));
+    }
+
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        ASSERT_EQ(1, data_values[i].length());
+        EXPECT_TRUE(infos[i][0].valid_data);
+        EXPECT_EQ(1u, data_values[i][0].index());
+        EXPECT_EQ(RETCODE_OK, readers[i]->return_loan(data_values[i], infos[i]));
+    }
+    for (size_t i = 1; i < num_readers; ++i)
+    {
+        ASSERT_EQ(RETCODE_OK, subscriber_->delete_datareader(readers[i]));
+    }
+}
+
 TEST_F(DataReaderTests, get_listening_locators)
 {
     // Prepare specific listening locators
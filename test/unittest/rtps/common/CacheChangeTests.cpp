@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <climits>
+#include <random>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -142,6 +144,64 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * @fn TEST(CacheChange, FragmentManagementOutOfOrder)
+ * @brief This test checks the missing fragments list when fragments are received in arbitrary order.
+ */
+TEST(CacheChange, FragmentManagementOutOfOrder)
+{
+    constexpr uint32_t num_fragments = 200;
+    constexpr uint16_t fragment_size = 8;
+
+    std::mt19937 gen(12345);
+    for (uint32_t iteration = 0; iteration < 20; ++iteration)
+    {
+        // Build a reception order with gaps followed by runs of consecutive fragments, plus some repetitions
+        std::vector<uint32_t> order;
+        for (uint32_t i = 1; i <= num_fragments; ++i)
+        {
+            order.push_back(i);
+        }
+        for (uint32_t i = 0; i < num_fragments / 4; ++i)
+        {
+            uint32_t a = gen() % num_fragments;
+            uint32_t b = gen() % num_fragments;
+            std::swap(order[a], order[b]);
+            order.push_back(order[a]);
+        }
+
+        CacheChange_t uut(num_fragments * fragment_size);
+        uut.serializedPayload.length = num_fragments * fragment_size;
+        uut.setFragmentSize(fragment_size, true);
+
+        std::vector<bool> missing(num_fragments, true);
+        SerializedPayload_t payload(fragment_size);
+        payload.length = fragment_size;
+        for (uint32_t fragment : order)
+        {
+            uut.add_fragments(payload, fragment, 1);
+            missing[fragment - 1] = false;
+
+            FragmentNumberSet_t fns;
+            uut.get_missing_fragments(fns);
+            uint32_t base = fns.base();
+            for (uint32_t i = 1; i <= num_fragments; ++i)
+            {
+                if (i < base)
+                {
+                    ASSERT_FALSE(missing[i - 1]) << "fragment " << i << " iteration " << iteration;
+                }
+                else if (i < base + 256u)
+                {
+                    ASSERT_EQ(missing[i - 1], fns.is_set(i)) << "fragment " << i << " iteration " << iteration;
+                }
+            }
+        }
+
+        ASSERT_TRUE(uut.is_fully_assembled());
+    }
+}
+
 TEST(CacheChange, calculate_required_fragmented_payload_size)
 {
     struct TestCase
@@ -0,0 +1,127 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/Guid.hpp>
+#include <rtps/common/ProxiesByGuid.hpp>
+
+using namespace eprosima::fastdds;
+using namespace eprosima::fastdds::rtps;
+
+struct TestProxy
+{
+    explicit TestProxy(
+            uint32_t id)
+    {
+        guid_.guidPrefix.value[0] = static_cast<octet>(id >> 24);
+        guid_.guidPrefix.value[1] = static_cast<octet>(id >> 16);
+        guid_.guidPrefix.value[2] = static_cast<octet>(id >> 8);
+        guid_.guidPrefix.value[3] = static_cast<octet>(id);
+        guid_.entityId = c_EntityId_SPDPWriter;
+    }
+
+    const GUID_t& guid() const
+    {
+        return guid_;
+    }
+
+    GUID_t guid_;
+};
+
+/*!
+ * Proxies are found, added and removed regardless of the order they were added.
+ */
+TEST(ProxiesByGuidTests, add_find_remove)
+{
+    ProxiesByGuid<TestProxy> index(ResourceLimitedContainerConfig::fixed_size_configuration(3));
+    TestProxy proxy_1(1);
+    TestProxy proxy_2(2);
+    TestProxy proxy_3(3);
+    TestProxy unknown(4);
+
+    index.add(&proxy_3);
+    index.add(&proxy_1);
+    index.add(&proxy_2);
+
+    EXPECT_EQ(&proxy_1, index.find(proxy_1.guid()));
+    EXPECT_EQ(&proxy_2, index.find(proxy_2.guid()));
+    EXPECT_EQ(&proxy_3, index.find(proxy_3.guid()));
+    EXPECT_EQ(nullptr, index.find(unknown.guid()));
+
+    EXPECT_EQ(nullptr, index.remove(unknown.guid()));
+    EXPECT_EQ(&proxy_2, index.remove(proxy_2.guid()));
+    EXPECT_EQ(nullptr, index.find(proxy_2.guid()));
+    EXPECT_EQ(&proxy_1, index.find(proxy_1.guid()));
+    EXPECT_EQ(&proxy_3, index.find(proxy_3.guid()));
+
+    index.clear();
+    EXPECT_EQ(nullptr, index.find(proxy_1.guid()));
+    EXPECT_EQ(nullptr, index.find(proxy_3.guid()));
+}
+
+/*!
+ * Lookups keep working with the number of matched endpoints of a big deployment.
+ */
+TEST(ProxiesByGuidTests, many_proxies)
+{
+    for (uint32_t number_of_proxies : {10u, 100u, 1000u, 5000u})
+    {
+        ProxiesByGuid<TestProxy> index{ResourceLimitedContainerConfig()};
+        std::vector<std::unique_ptr<TestProxy>> proxies;
+        for (uint32_t i = 0; i < number_of_proxies; ++i)
+        {
+            proxies.emplace_back(new TestProxy(i * 7919u));
+        }
+
+        std::vector<TestProxy*> shuffled;
+        for (auto& proxy : proxies)
+        {
+            shuffled.push_back(proxy.get());
+        }
+        std::shuffle(shuffled.begin(), shuffled.end(), std::mt19937(number_of_proxies));
+        for (TestProxy* proxy : shuffled)
+        {
+            index.add(proxy);
+        }
+
+        for (auto& proxy : proxies)
+        {
+            ASSERT_EQ(proxy.get(), index.find(proxy->guid()));
+        }
+
+        // Remove half of them.
+        for (size_t i = 0; i < shuffled.size(); i += 2)
+        {
+            ASSERT_EQ(shuffled[i], index.remove(shuffled[i]->guid()));
+        }
+        for (size_t i = 0; i < shuffled.size(); ++i)
+        {
+            ASSERT_EQ(0 == i % 2 ? nullptr : shuffled[i], index.find(shuffled[i]->guid()));
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -421,3 +421,91 @@ TYPED_TEST(FlowControllerPublishModes, async_publish_mode)
 
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, async_publish_mode_on_sender_pool)
+{
+    eprosima::fastdds::JobThreadPool sender_pool(2, ThreadSettings{}, 0, "dds.fcp.%u.%u");
+    FlowControllerDescriptor flow_controller_descr;
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async1(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{}, &sender_pool);
+    FlowControllerImpl<FlowControllerAsyncPublishMode, TypeParam> async2(nullptr,
+            &flow_controller_descr, 1, ThreadSettings{}, &sender_pool);
+    async1.init();
+    async2.init();
+
+    // Instantiate writers.
+    BaseWriter writer1;
+    BaseWriter writer2;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender&,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register each writer on its own flow controller.
+    async1.register_writer(&writer1);
+    async2.register_writer(&writer2);
+
+    CacheChange_t change_writer1;
+    INIT_CACHE_CHANGE(change_writer1, writer1, 1);
+    CacheChange_t change_writer2;
+    INIT_CACHE_CHANGE(change_writer2, writer1, 2);
+    CacheChange_t change_writer3;
+    INIT_CACHE_CHANGE(change_writer3, writer2, 1);
+    CacheChange_t change_writer4;
+    INIT_CACHE_CHANGE(change_writer4, writer2, 2);
+
+    // Testing add_new_sample on both flow controllers.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer2, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2,
+            deliver_sample_nts(&change_writer3, _, Ref(writer2.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2,
+            deliver_sample_nts(&change_writer4, _, Ref(writer2.async_locator_selector_), _)).
+            WillOnce(Return(DeliveryRetCode::NOT_DELIVERED)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async1.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async1.add_new_sample(&writer1, &change_writer2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async2.add_new_sample(&writer2, &change_writer3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async2.add_new_sample(&writer2, &change_writer4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer2.getMutex().unlock();
+    this->wait_changes_was_delivered(4);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    // Testing add_old_sample once the flow controllers are idle.
+    EXPECT_CALL(writer2,
+            deliver_sample_nts(&change_writer3, _, Ref(writer2.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    writer2.getMutex().lock();
+    ASSERT_TRUE(async2.add_old_sample(&writer2, &change_writer3));
+    writer2.getMutex().unlock();
+    this->wait_changes_was_delivered(1);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    async1.unregister_writer(&writer1);
+    async2.unregister_writer(&writer2);
+}
@@ -602,3 +602,157 @@ TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode)
     async.unregister_writer(&writer2);
     async.unregister_writer(&writer1);
 }
+
+TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode_with_token_bucket)
+{
+    // 1000 bytes per millisecond, in bursts of at most 1000 bytes.
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10000;
+    flow_controller_descr.period_ms = 10;
+    flow_controller_descr.max_burst_bytes = 1000;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{});
+    async.init();
+
+    // Datagrams cannot be bigger than the burst.
+    EXPECT_EQ(flow_controller_descr.max_burst_bytes, async.get_max_payload());
+
+    // Instantiate writers.
+    BaseWriter writer1;
+
+    // Initialize callback to get info.
+    std::vector<std::pair<std::chrono::steady_clock::time_point, uint32_t>> sent_bytes;
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender& sender,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                FlowControllerLimitedAsyncPublishModeMock::get_publish_mode().add_sent_bytes_by_group(
+                    change->serializedPayload.length, sender);
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    sent_bytes.emplace_back(std::chrono::steady_clock::now(), change->serializedPayload.length);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    // Sustained load of 30000 bytes.
+    constexpr size_t num_changes = 60;
+    constexpr uint32_t change_size = 500;
+    std::vector<CacheChange_t> changes(num_changes);
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        INIT_CACHE_CHANGE(changes[i], writer1, i + 1);
+        changes[i].serializedPayload.length = change_size;
+    }
+
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            Times(static_cast<int>(num_changes)).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    for (size_t i = 0; i < num_changes; ++i)
+    {
+        ASSERT_TRUE(async.add_new_sample(&writer1, &changes[i],
+                std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    }
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(num_changes);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+
+    // All bytes but the initial burst have to wait for the bucket to be refilled.
+    EXPECT_LE(std::chrono::milliseconds(29), elapsed);
+
+    // Bytes sent in any 1 ms window are bounded by the burst plus the refill of 1 ms.
+    // One more change is allowed, as timestamps are taken after the check of the bucket.
+    uint32_t max_bytes_in_window = 0;
+    for (size_t i = 0; i < sent_bytes.size(); ++i)
+    {
+        uint32_t bytes_in_window = 0;
+        for (size_t j = i; j < sent_bytes.size() &&
+                sent_bytes[j].first - sent_bytes[i].first < std::chrono::milliseconds(1); ++j)
+        {
+            bytes_in_window += sent_bytes[j].second;
+        }
+        max_bytes_in_window = (std::max)(max_bytes_in_window, bytes_in_window);
+    }
+    EXPECT_GE(2000u + change_size, max_bytes_in_window);
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
+
+TYPED_TEST(FlowControllerPublishModes, limited_async_publish_mode_on_sender_pool)
+{
+    eprosima::fastdds::JobThreadPool sender_pool(2, ThreadSettings{}, 0, "dds.fcp.%u.%u");
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 10200;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, TypeParam> async(nullptr,
+            &flow_controller_descr, 0, ThreadSettings{}, &sender_pool);
+    async.init();
+
+    // Instantiate writers.
+    BaseWriter writer1;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender& sender,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                FlowControllerLimitedAsyncPublishModeMock::get_publish_mode().add_sent_bytes_by_group(
+                    change->serializedPayload.length, sender);
+                this->last_thread_delivering_sample = std::this_thread::get_id();
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    // Register writers.
+    async.register_writer(&writer1);
+
+    CacheChange_t change_writer1;
+    INIT_CACHE_CHANGE(change_writer1, writer1, 1);
+    CacheChange_t change_writer2;
+    INIT_CACHE_CHANGE(change_writer2, writer1, 2);
+    CacheChange_t change_writer3;
+    INIT_CACHE_CHANGE(change_writer3, writer1, 3);
+
+    // Only one sample fits in each period, so the pool has to wait for the bandwidth limitation to be reset.
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer1, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer2, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer1,
+            deliver_sample_nts(&change_writer3, _, Ref(writer1.async_locator_selector_), _)).
+            WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    auto start = std::chrono::steady_clock::now();
+    writer1.getMutex().lock();
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    writer1.getMutex().unlock();
+    this->wait_changes_was_delivered(3);
+    EXPECT_LE(std::chrono::milliseconds(flow_controller_descr.period_ms), std::chrono::steady_clock::now() - start);
+    EXPECT_NE(std::this_thread::get_id(), this->last_thread_delivering_sample);
+    this->changes_delivered.clear();
+
+    async.unregister_writer(&writer1);
+}
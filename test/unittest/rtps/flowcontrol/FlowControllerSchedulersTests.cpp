@@ -2307,6 +2307,236 @@ TEST_F(FlowControllerSchedulers, PriorityWithReservation)
     async.unregister_writer(&writer10);
 }
 
+TEST_F(FlowControllerSchedulers, PriorityWithReservationManyWriters)
+{
+    for (uint32_t number_of_writers : {10u, 100u, 1000u})
+    {
+        FlowControllerDescriptor flow_controller_descr;
+        flow_controller_descr.max_bytes_per_period = 100 * number_of_writers * 2;
+        flow_controller_descr.period_ms = 10;
+        FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock,
+                FlowControllerPriorityWithReservationSchedule> async(nullptr, &flow_controller_descr, 0,
+                ThreadSettings{});
+
+        // Initialize callback to get info.
+        auto send_functor = [&](
+            CacheChange_t* change,
+            RTPSMessageGroup&,
+            LocatorSelectorSender& sender,
+            const std::chrono::time_point<std::chrono::steady_clock>&)
+                {
+                    FlowControllerLimitedAsyncPublishModeMock::get_publish_mode().add_sent_bytes_by_group(
+                        change->serializedPayload.length, sender);
+                    {
+                        std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                        this->changes_delivered.push_back(change);
+                    }
+                    this->number_changes_delivered_cv.notify_one();
+                };
+
+        // Instantiate writers with all the priorities. One of each ten writers has a bandwidth reservation.
+        std::vector<std::unique_ptr<BaseWriter>> writers;
+        std::vector<CacheChange_t> changes(number_of_writers);
+        std::vector<std::tuple<bool, int32_t, uint32_t>> expected_order;
+        for (uint32_t i = 0; i < number_of_writers; ++i)
+        {
+            writers.emplace_back(new BaseWriter());
+            BaseWriter& writer = *writers.back();
+            writer.m_guid.entityId.value[1] = static_cast<octet>(i >> 16);
+            writer.m_guid.entityId.value[2] = static_cast<octet>(i >> 8);
+            writer.m_guid.entityId.value[3] = static_cast<octet>(i);
+
+            int32_t priority = static_cast<int32_t>(i % 21) - 10;
+            bool reserved = 0 == i % 10;
+            Property property;
+            property.name("fastdds.sfc.priority");
+            property.value(std::to_string(priority));
+            writer.m_att.endpoint.properties.properties().push_back(property);
+            if (reserved)
+            {
+                property.name("fastdds.sfc.bandwidth_reservation");
+                property.value("1");
+                writer.m_att.endpoint.properties.properties().push_back(property);
+            }
+            expected_order.emplace_back(!reserved, priority, i);
+
+            EXPECT_CALL(writer, deliver_sample_nts(&changes[i], _, Ref(writer.async_locator_selector_), _)).
+                    WillOnce(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+            async.register_writer(&writer);
+
+            INIT_CACHE_CHANGE(changes[i], writer, 1);
+            changes[i].serializedPayload.length = 100;
+            ASSERT_TRUE(async.add_new_sample(&writer, &changes[i],
+                    std::chrono::steady_clock::now() + std::chrono::hours(24)));
+        }
+
+        // Writers within their reservation go first, then the rest by priority.
+        std::sort(expected_order.begin(), expected_order.end());
+        std::vector<CacheChange_t*> expected_changes;
+        for (auto& expected : expected_order)
+        {
+            expected_changes.push_back(&changes[std::get<2>(expected)]);
+        }
+
+        async.init();
+
+        this->wait_changes_was_delivered(number_of_writers);
+        EXPECT_EQ(expected_changes, this->changes_delivered);
+        this->changes_delivered.clear();
+
+        for (auto& writer : writers)
+        {
+            async.unregister_writer(writer.get());
+        }
+    }
+}
+
+TEST_F(FlowControllerSchedulers, EarliestDeadlineFirst)
+{
+    FlowControllerDescriptor flow_controller_descr;
+    flow_controller_descr.max_bytes_per_period = 102000;
+    flow_controller_descr.period_ms = 10;
+    FlowControllerImpl<FlowControllerLimitedAsyncPublishModeMock, FlowControllerEarliestDeadlineFirstSchedule> async(
+        nullptr, &flow_controller_descr, 0, ThreadSettings{});
+
+    // Instantiate writers with mixed rates: a control loop, a video stream and bulk logs without latency budget.
+    Property latency_budget_property;
+    latency_budget_property.name("fastdds.sfc.latency_budget_us");
+    BaseWriter writer1;
+    latency_budget_property.value("1000");
+    writer1.m_att.endpoint.properties.properties().push_back(latency_budget_property);
+    BaseWriter writer2;
+    latency_budget_property.value("33000");
+    writer2.m_att.endpoint.properties.properties().push_back(latency_budget_property);
+    BaseWriter writer3;
+
+    // Initialize callback to get info.
+    auto send_functor = [&](
+        CacheChange_t* change,
+        RTPSMessageGroup&,
+        LocatorSelectorSender& sender,
+        const std::chrono::time_point<std::chrono::steady_clock>&)
+            {
+                FlowControllerLimitedAsyncPublishModeMock::get_publish_mode().add_sent_bytes_by_group(
+                    change->serializedPayload.length, sender);
+                {
+                    std::unique_lock<std::mutex> lock(this->changes_delivered_mutex);
+                    this->changes_delivered.push_back(change);
+                }
+                this->number_changes_delivered_cv.notify_one();
+            };
+
+    EXPECT_CALL(writer1, deliver_sample_nts(_, _, Ref(writer1.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer2, deliver_sample_nts(_, _, Ref(writer2.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+    EXPECT_CALL(writer3, deliver_sample_nts(_, _, Ref(writer3.async_locator_selector_), _)).
+            WillRepeatedly(DoAll(send_functor, Return(DeliveryRetCode::DELIVERED)));
+
+    // Register writers.
+    async.register_writer(&writer1);
+    async.register_writer(&writer2);
+    async.register_writer(&writer3);
+
+    // Source timestamps are far in the future so no deadline is missed.
+    Time_t now;
+    Time_t::now(now);
+    int64_t base_ns = now.to_ns() + 3600000000000;
+    auto init_timestamp = [&base_ns](
+        CacheChange_t& change,
+        int64_t offset_ms)
+            {
+                change.sourceTimestamp.from_ns(base_ns + offset_ms * 1000000);
+            };
+
+    CacheChange_t change_writer1_1;
+    CacheChange_t change_writer1_2;
+    CacheChange_t change_writer1_3;
+    INIT_CACHE_CHANGE(change_writer1_1, writer1, 1);
+    INIT_CACHE_CHANGE(change_writer1_2, writer1, 2);
+    INIT_CACHE_CHANGE(change_writer1_3, writer1, 3);
+    init_timestamp(change_writer1_1, 0);   // Deadline 1ms
+    init_timestamp(change_writer1_2, 10);  // Deadline 11ms
+    init_timestamp(change_writer1_3, 20);  // Deadline 21ms
+    CacheChange_t change_writer2_1;
+    CacheChange_t change_writer2_2;
+    CacheChange_t change_writer2_3;
+    INIT_CACHE_CHANGE(change_writer2_1, writer2, 1);
+    INIT_CACHE_CHANGE(change_writer2_2, writer2, 2);
+    INIT_CACHE_CHANGE(change_writer2_3, writer2, 3);
+    init_timestamp(change_writer2_1, -20); // Deadline 13ms
+    init_timestamp(change_writer2_2, -10); // Deadline 23ms
+    init_timestamp(change_writer2_3, 0);   // Deadline 33ms
+    CacheChange_t change_writer3_1;
+    CacheChange_t change_writer3_2;
+    CacheChange_t change_writer3_3;
+    INIT_CACHE_CHANGE(change_writer3_1, writer3, 1);
+    INIT_CACHE_CHANGE(change_writer3_2, writer3, 2);
+    INIT_CACHE_CHANGE(change_writer3_3, writer3, 3);
+    init_timestamp(change_writer3_1, -30); // No deadline
+    init_timestamp(change_writer3_2, -29); // No deadline
+    init_timestamp(change_writer3_3, -28); // No deadline
+
+    // Samples are sent in deadline order once the sender thread starts.
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_1,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_2,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_3,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    async.init();
+
+    this->wait_changes_was_delivered(9);
+    EXPECT_EQ(std::vector<CacheChange_t*>({&change_writer1_1, &change_writer1_2, &change_writer2_1,
+            &change_writer1_3, &change_writer2_2, &change_writer2_3,
+            &change_writer3_1, &change_writer3_2, &change_writer3_3}), this->changes_delivered);
+    EXPECT_EQ(0u, async.get_deadline_misses(&writer1));
+    EXPECT_EQ(0u, async.get_deadline_misses(&writer2));
+    EXPECT_EQ(0u, async.get_deadline_misses(&writer3));
+    this->changes_delivered.clear();
+
+    // Samples written one second ago miss their deadline, unless their writer has no latency budget.
+    Time_t::now(now);
+    base_ns = now.to_ns() - 1000000000;
+    CacheChange_t change_writer1_4;
+    INIT_CACHE_CHANGE(change_writer1_4, writer1, 4);
+    init_timestamp(change_writer1_4, 0);
+    CacheChange_t change_writer2_4;
+    INIT_CACHE_CHANGE(change_writer2_4, writer2, 4);
+    init_timestamp(change_writer2_4, 0);
+    CacheChange_t change_writer3_4;
+    INIT_CACHE_CHANGE(change_writer3_4, writer3, 4);
+    init_timestamp(change_writer3_4, 0);
+    ASSERT_TRUE(async.add_new_sample(&writer1, &change_writer1_4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer2, &change_writer2_4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+    ASSERT_TRUE(async.add_new_sample(&writer3, &change_writer3_4,
+            std::chrono::steady_clock::now() + std::chrono::hours(24)));
+
+    this->wait_changes_was_delivered(3);
+    EXPECT_EQ(1u, async.get_deadline_misses(&writer1));
+    EXPECT_EQ(1u, async.get_deadline_misses(&writer2));
+    EXPECT_EQ(0u, async.get_deadline_misses(&writer3));
+
+    // Unregister writers.
+    async.unregister_writer(&writer1);
+    async.unregister_writer(&writer2);
+    async.unregister_writer(&writer3);
+}
+
 } // namespace rtps
 } // namespace fastdds
 } // namespace eprosima
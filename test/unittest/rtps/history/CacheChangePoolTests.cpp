@@ -19,7 +19,9 @@
 
 #include <rtps/history/CacheChangePool.h>
 
+#include <cstdint>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastdds::rtps;
 using namespace ::testing;
@@ -224,6 +226,34 @@ TEST_P(CacheChangePoolTests, change_reset_on_release)
     }
 }
 
+TEST_P(CacheChangePoolTests, preallocated_changes_are_cache_aligned)
+{
+    if (memory_policy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
+            memory_policy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE)
+    {
+        return;
+    }
+
+    std::vector<CacheChange_t*> changes;
+    CacheChange_t* ch = nullptr;
+    while (changes.size() < 50u && pool->reserve_cache(ch))
+    {
+        // Each change should start on its own cache line
+        ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(ch) % 64u);
+        for (CacheChange_t* other : changes)
+        {
+            ASSERT_NE(other, ch);
+        }
+        changes.push_back(ch);
+    }
+
+    for (CacheChange_t* change : changes)
+    {
+        ASSERT_TRUE(pool->release_cache(change));
+    }
+    ASSERT_EQ(pool->get_allCachesSize(), pool->get_freeCachesSize());
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -527,6 +527,55 @@ TEST(TopicPayloalPoolTests, bad_alloc_on_get_payload_is_handled)
     pool->release_history(config, false);
 }
 
+//! The bytes reported by the pool follow the payloads allocated, resized and freed.
+TEST(TopicPayloalPoolTests, allocated_bytes)
+{
+    // Payloads are preallocated, and resized when a larger one is requested.
+    {
+        PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 128, 4, 10 };
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_NE(pool, nullptr);
+        pool->reserve_history(config, false);
+        EXPECT_EQ(4u, pool->payload_pool_allocated_size());
+        EXPECT_EQ(4u * 128u, pool->payload_pool_allocated_bytes());
+
+        CacheChange_t change;
+        ASSERT_TRUE(pool->get_payload(1000, change.serializedPayload));
+        EXPECT_EQ(4u, pool->payload_pool_allocated_size());
+        EXPECT_EQ(3u * 128u + 1000u, pool->payload_pool_allocated_bytes());
+        pool->release_payload(change.serializedPayload);
+        EXPECT_EQ(3u * 128u + 1000u, pool->payload_pool_allocated_bytes());
+
+        // Release the history, so the free payloads are deleted.
+        pool->release_history(config, false);
+        EXPECT_EQ(0u, pool->payload_pool_allocated_size());
+        EXPECT_EQ(0u, pool->payload_pool_allocated_bytes());
+    }
+
+    // Payloads are allocated on demand and deleted when released.
+    {
+        PoolConfig config{ DYNAMIC_RESERVE_MEMORY_MODE, 128, 0, 0 };
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_NE(pool, nullptr);
+        pool->reserve_history(config, false);
+        EXPECT_EQ(0u, pool->payload_pool_allocated_bytes());
+
+        CacheChange_t change_1;
+        CacheChange_t change_2;
+        ASSERT_TRUE(pool->get_payload(100, change_1.serializedPayload));
+        ASSERT_TRUE(pool->get_payload(200, change_2.serializedPayload));
+        EXPECT_EQ(2u, pool->payload_pool_allocated_size());
+        EXPECT_EQ(300u, pool->payload_pool_allocated_bytes());
+        pool->release_payload(change_1.serializedPayload);
+        EXPECT_EQ(1u, pool->payload_pool_allocated_size());
+        EXPECT_EQ(200u, pool->payload_pool_allocated_bytes());
+        pool->release_payload(change_2.serializedPayload);
+        EXPECT_EQ(0u, pool->payload_pool_allocated_bytes());
+
+        pool->release_history(config, false);
+    }
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
@@ -0,0 +1,225 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <rtps/messages/RTPSMessageGroup.hpp>
+#include <rtps/messages/SendBuffersManager.hpp>
+#include <rtps/participant/RTPSParticipantImpl.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using namespace ::testing;
+using eprosima::fastdds::ResourceLimitedContainerConfig;
+
+using Buffer = std::unique_ptr<RTPSMessageGroup_t>;
+
+static const ResourceLimitedContainerConfig network_buffers_config(16u, 16u, 16u);
+
+class SendBuffersManagerTests : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        ON_CALL(participant_, getGuid()).WillByDefault(ReturnRef(guid_));
+    }
+
+    std::chrono::steady_clock::time_point in(
+            int ms)
+    {
+        return std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+    }
+
+    GUID_t guid_;
+    NiceMock<RTPSParticipantImpl> participant_;
+};
+
+TEST_F(SendBuffersManagerTests, reserved_buffers_without_growing)
+{
+    SendBuffersManager uut(4u, false, network_buffers_config);
+    uut.init(&participant_);
+    EXPECT_EQ(4u, uut.get_memory_usage().elements);
+
+    std::vector<Buffer> buffers;
+    for (int i = 0; i < 4; ++i)
+    {
+        buffers.push_back(uut.get_buffer(&participant_, in(100)));
+        ASSERT_NE(nullptr, buffers.back());
+    }
+
+    // All buffers are in use, so the next request waits and times out.
+    EXPECT_THROW(uut.get_buffer(&participant_, in(10)), RTPSMessageGroup::timeout);
+    EXPECT_EQ(1u, uut.get_buffer_waits());
+    EXPECT_EQ(0u, uut.get_buffer_growths());
+
+    RTPSMessageGroup_t* returned = buffers.back().get();
+    uut.return_buffer(std::move(buffers.back()));
+    buffers.pop_back();
+    buffers.push_back(uut.get_buffer(&participant_, in(10)));
+    EXPECT_EQ(returned, buffers.back().get());
+    EXPECT_EQ(1u, uut.get_buffer_waits());
+
+    for (Buffer& buffer : buffers)
+    {
+        uut.return_buffer(std::move(buffer));
+    }
+    EXPECT_EQ(4u, uut.get_memory_usage().elements);
+}
+
+TEST_F(SendBuffersManagerTests, growing)
+{
+    SendBuffersManager uut(2u, true, network_buffers_config);
+    uut.init(&participant_);
+
+    std::vector<Buffer> buffers;
+    for (int i = 0; i < 5; ++i)
+    {
+        buffers.push_back(uut.get_buffer(&participant_, in(100)));
+        ASSERT_NE(nullptr, buffers.back());
+    }
+    EXPECT_EQ(3u, uut.get_buffer_growths());
+    EXPECT_EQ(0u, uut.get_buffer_waits());
+    EXPECT_EQ(5u, uut.get_memory_usage().elements);
+
+    for (Buffer& buffer : buffers)
+    {
+        uut.return_buffer(std::move(buffer));
+    }
+    buffers.clear();
+
+    // Returned buffers are reused before creating new ones.
+    for (int i = 0; i < 5; ++i)
+    {
+        buffers.push_back(uut.get_buffer(&participant_, in(100)));
+    }
+    EXPECT_EQ(3u, uut.get_buffer_growths());
+    EXPECT_EQ(5u, uut.get_memory_usage().elements);
+
+    for (Buffer& buffer : buffers)
+    {
+        uut.return_buffer(std::move(buffer));
+    }
+}
+
+TEST_F(SendBuffersManagerTests, returned_buffer_wakes_waiting_thread)
+{
+    SendBuffersManager uut(1u, false, network_buffers_config);
+    uut.init(&participant_);
+
+    Buffer buffer = uut.get_buffer(&participant_, in(100));
+    RTPSMessageGroup_t* raw_buffer = buffer.get();
+
+    Buffer received;
+    std::thread waiter([&]()
+            {
+                received = uut.get_buffer(&participant_, in(10000));
+            });
+
+    while (0u == uut.get_buffer_waits())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    uut.return_buffer(std::move(buffer));
+    waiter.join();
+
+    EXPECT_EQ(raw_buffer, received.get());
+    EXPECT_EQ(1u, uut.get_buffer_waits());
+    uut.return_buffer(std::move(received));
+}
+
+/*
+ * Runs threads getting and returning buffers in a loop, checking no buffer is given to two threads at the same time.
+ */
+template<typename GetFunction, typename ReturnFunction>
+static void run_threads(
+        size_t num_threads,
+        size_t num_iterations,
+        size_t num_buffers,
+        GetFunction get_buffer,
+        ReturnFunction return_buffer)
+{
+    std::unique_ptr<std::atomic<bool>[]> in_use(new std::atomic<bool>[num_buffers]);
+    for (size_t i = 0; i < num_buffers; ++i)
+    {
+        in_use[i].store(false);
+    }
+
+    std::atomic<size_t> errors{0u};
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+                {
+                    for (size_t i = 0; i < num_iterations; ++i)
+                    {
+                        Buffer buffer = get_buffer();
+                        if (in_use[buffer->pool_index_].exchange(true))
+                        {
+                            ++errors;
+                        }
+                        in_use[buffer->pool_index_].store(false);
+                        return_buffer(std::move(buffer));
+                    }
+                });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, errors.load());
+}
+
+/*
+ * Several threads get and return buffers in a loop, with one buffer per thread and with less buffers than threads.
+ * No buffer is given to two threads at the same time, and the pool does not grow.
+ */
+TEST_F(SendBuffersManagerTests, contention)
+{
+    constexpr size_t num_threads = 8u;
+    constexpr size_t num_iterations = 1000u;
+    const auto max_blocking_time = in(60000);
+
+    for (size_t num_buffers : {num_threads, num_threads / 4})
+    {
+        SendBuffersManager uut(num_buffers, false, network_buffers_config);
+        uut.init(&participant_);
+        run_threads(num_threads, num_iterations, num_buffers,
+                [&]()
+                {
+                    return uut.get_buffer(&participant_, max_blocking_time);
+                },
+                [&](Buffer&& buffer)
+                {
+                    uut.return_buffer(std::move(buffer));
+                });
+        EXPECT_EQ(0u, uut.get_buffer_growths());
+        EXPECT_EQ(num_buffers, uut.get_memory_usage().elements);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
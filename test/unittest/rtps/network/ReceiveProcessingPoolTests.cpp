@@ -0,0 +1,211 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/network/ReceiveProcessingPool.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+/*
+ * Processor storing the sequence of messages processed for each source, optionally taking some time to process each
+ * one, as a slow listener would do.
+ */
+class TestProcessor : public ReceiveProcessingPool::Processor
+{
+public:
+
+    void process_queued_message(
+            CDRMessage_t& msg,
+            const Locator_t&,
+            const Locator_t&,
+            uint32_t thread_index) override
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this]()
+                {
+                    return !blocked;
+                });
+
+        uint8_t source = msg.buffer[RTPSMESSAGE_HEADER_SIZE - 1];
+        uint32_t seq = 0;
+        memcpy(&seq, &msg.buffer[RTPSMESSAGE_HEADER_SIZE], sizeof(seq));
+        received[source].push_back(seq);
+        threads[source].insert(thread_index);
+        ++num_received;
+        cv.notify_all();
+    }
+
+    void wait_for(
+            size_t num_messages)
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        cv.wait(lock, [this, num_messages]()
+                {
+                    return num_received >= num_messages;
+                });
+    }
+
+    void release()
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        blocked = false;
+        cv.notify_all();
+    }
+
+    bool blocked = false;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::map<uint8_t, std::vector<uint32_t>> received;
+    std::map<uint8_t, std::set<uint32_t>> threads;
+    size_t num_received = 0;
+};
+
+static std::array<octet, RTPSMESSAGE_HEADER_SIZE + 4> make_message(
+        uint8_t source,
+        uint32_t seq)
+{
+    std::array<octet, RTPSMESSAGE_HEADER_SIZE + 4> message{};
+    memcpy(message.data(), "RTPS", 4);
+    message[RTPSMESSAGE_HEADER_SIZE - 1] = source;
+    memcpy(&message[RTPSMESSAGE_HEADER_SIZE], &seq, sizeof(seq));
+    return message;
+}
+
+static void enqueue(
+        ReceiveProcessingPool& pool,
+        TestProcessor& processor,
+        uint8_t source,
+        uint32_t seq,
+        bool expected_result = true)
+{
+    auto message = make_message(source, seq);
+    Locator_t locator;
+    EXPECT_EQ(expected_result, pool.enqueue(&processor, message.data(), static_cast<uint32_t>(message.size()),
+            locator, locator));
+}
+
+/*
+ * Messages from different sources are processed in parallel, but the messages of each source are processed in the
+ * order they were received, always by the same thread.
+ */
+TEST(ReceiveProcessingPoolTests, order_per_source)
+{
+    constexpr uint8_t num_sources = 16;
+    constexpr uint32_t num_messages = 1000;
+
+    TestProcessor processor;
+    {
+        ReceiveProcessingPool pool(4, num_sources * num_messages, ThreadSettings{}, 0);
+        EXPECT_EQ(4u, pool.num_threads());
+        for (uint32_t seq = 0; seq < num_messages; ++seq)
+        {
+            for (uint8_t source = 0; source < num_sources; ++source)
+            {
+                enqueue(pool, processor, source, seq);
+            }
+        }
+        processor.wait_for(num_sources * num_messages);
+        EXPECT_EQ(0u, pool.dropped_messages());
+    }
+
+    ASSERT_EQ(num_sources, processor.received.size());
+    for (const auto& source : processor.received)
+    {
+        ASSERT_EQ(num_messages, source.second.size());
+        for (uint32_t seq = 0; seq < num_messages; ++seq)
+        {
+            EXPECT_EQ(seq, source.second[seq]);
+        }
+
+        const std::set<uint32_t>& threads = processor.threads[source.first];
+        ASSERT_EQ(1u, threads.size());
+        EXPECT_LT(*threads.begin(), 4u);
+    }
+}
+
+/*
+ * Messages are dropped when all the buffers of the pool are waiting to be processed.
+ */
+TEST(ReceiveProcessingPoolTests, drop_when_full)
+{
+    TestProcessor processor;
+    processor.blocked = true;
+    {
+        ReceiveProcessingPool pool(1, 4, ThreadSettings{}, 0);
+        for (uint32_t seq = 0; seq < 4; ++seq)
+        {
+            enqueue(pool, processor, 0, seq);
+        }
+        for (uint32_t seq = 4; seq < 10; ++seq)
+        {
+            enqueue(pool, processor, 0, seq, false);
+        }
+        EXPECT_EQ(6u, pool.dropped_messages());
+
+        // Buffers are reused once the messages have been processed.
+        processor.release();
+        processor.wait_for(4);
+        enqueue(pool, processor, 0, 10);
+        processor.wait_for(5);
+        EXPECT_EQ(6u, pool.dropped_messages());
+    }
+
+    EXPECT_EQ((std::vector<uint32_t>{0, 1, 2, 3, 10}), processor.received[0]);
+}
+
+/*
+ * The reception thread is not blocked while the listener processes the messages, so all the messages are queued
+ * while the listener is blocked.
+ */
+TEST(ReceiveProcessingPoolTests, blocked_listener)
+{
+    constexpr uint8_t num_sources = 4;
+    constexpr uint32_t num_messages = 50;
+
+    TestProcessor processor;
+    processor.blocked = true;
+    {
+        ReceiveProcessingPool pool(num_sources, num_sources * num_messages, ThreadSettings{}, 0);
+        for (uint32_t seq = 0; seq < num_messages; ++seq)
+        {
+            for (uint8_t source = 0; source < num_sources; ++source)
+            {
+                enqueue(pool, processor, source, seq);
+            }
+        }
+        EXPECT_EQ(0u, processor.num_received);
+
+        processor.release();
+        processor.wait_for(num_sources * num_messages);
+        EXPECT_EQ(0u, pool.dropped_messages());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,277 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/PropertyPolicy.hpp>
+#include <fastdds/rtps/history/WriterHistory.hpp>
+
+#include <rtps/history/CacheChangePool.h>
+#include <rtps/persistence/PersistenceService.h>
+#include <utils/SystemInfo.hpp>
+
+using namespace eprosima::fastdds::rtps;
+using testing::_;
+
+class LogFilePersistenceTests : public ::testing::Test
+{
+protected:
+
+    IPersistenceService* service = nullptr;
+
+    std::string logfile;
+
+    PropertyPolicy policy;
+
+    const std::string writer_persist_guid = "TEST_WRITER";
+
+    const std::string reader_persist_guid = "TEST_READER";
+
+    std::shared_ptr<CacheChangePool> pool;
+
+    CacheChange_t change{16};
+
+    GUID_t guid{GuidPrefix_t::unknown(), 1U};
+
+    WriterHistory history;
+
+    void SetUp() override
+    {
+        // Create log file name from test name and PID
+        auto info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::ostringstream ss;
+        ss << info->test_case_name() << "_" << info->name() << "_" << eprosima::SystemInfo::instance().process_id()
+           << ".log";
+        logfile = ss.str();
+
+        policy.properties().emplace_back("dds.persistence.plugin", "builtin.LOGFILE");
+        policy.properties().emplace_back("dds.persistence.logfile.filename", logfile);
+
+        auto init_cache = [](CacheChange_t* item)
+                {
+                    item->serializedPayload.reserve(128);
+                };
+        PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 200, 0 };
+        pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+
+        change.kind = ALIVE;
+        change.writerGUID = guid;
+        change.serializedPayload.length = 16;
+
+        auto create_change = [this](uint32_t, ChangeKind_t, InstanceHandle_t)
+                {
+                    CacheChange_t* ch = nullptr;
+                    return pool->reserve_cache(ch) ? ch : nullptr;
+                };
+        EXPECT_CALL(history, create_change(_, _, _))
+                .Times(testing::AnyNumber())
+                .WillRepeatedly(testing::Invoke(create_change));
+
+        open_service();
+    }
+
+    void TearDown() override
+    {
+        delete service;
+        for (CacheChange_t* ch : history.m_changes)
+        {
+            pool->release_cache(ch);
+        }
+        std::remove(logfile.c_str());
+    }
+
+    void open_service()
+    {
+        delete service;
+        service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
+        ASSERT_NE(service, nullptr);
+    }
+
+    void add_changes(
+            uint32_t first,
+            uint32_t last)
+    {
+        for (uint32_t i = first; i <= last; ++i)
+        {
+            change.sequenceNumber.low = i;
+            memset(change.serializedPayload.data, static_cast<int>(i & 0xFF), change.serializedPayload.length);
+            ASSERT_TRUE(service->add_writer_change_to_storage(writer_persist_guid, change));
+        }
+    }
+
+    void remove_changes(
+            uint32_t first,
+            uint32_t last)
+    {
+        for (uint32_t i = first; i <= last; ++i)
+        {
+            change.sequenceNumber.low = i;
+            ASSERT_TRUE(service->remove_writer_change_from_storage(writer_persist_guid, change));
+        }
+    }
+
+    void check_loaded_changes(
+            uint32_t first,
+            uint32_t last)
+    {
+        SequenceNumber_t max_seq;
+        for (CacheChange_t* ch : history.m_changes)
+        {
+            pool->release_cache(ch);
+        }
+        history.m_changes.clear();
+        ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, max_seq));
+        ASSERT_EQ(history.m_changes.size(), last - first + 1);
+        ASSERT_EQ(max_seq, SequenceNumber_t(0, last));
+        uint32_t i = first;
+        for (auto it : history.m_changes)
+        {
+            ASSERT_EQ(it->sequenceNumber, SequenceNumber_t(0, i));
+            ASSERT_EQ(it->serializedPayload.length, 16u);
+            ASSERT_EQ(it->serializedPayload.data[0], static_cast<octet>(i & 0xFF));
+            ++i;
+        }
+    }
+
+    uint64_t logfile_size()
+    {
+        FILE* file = fopen(logfile.c_str(), "rb");
+        if (nullptr == file)
+        {
+            return 0;
+        }
+        fseek(file, 0, SEEK_END);
+        uint64_t size = static_cast<uint64_t>(ftell(file));
+        fclose(file);
+        return size;
+    }
+
+};
+
+/*!
+ * This test checks the writer and reader persistence interface of the log file persistence service,
+ * including the reload of the log after compacting it.
+ */
+TEST_F(LogFilePersistenceTests, writer_and_reader)
+{
+    // Initial load should return empty vector
+    SequenceNumber_t max_seq;
+    ASSERT_TRUE(service->load_writer_from_storage(writer_persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), 0u);
+
+    // Add enough changes to force a compaction when removing most of them
+    constexpr uint32_t num_changes = 3000;
+    constexpr uint32_t num_kept = 10;
+    add_changes(1, num_changes);
+
+    // Should not be able to add same sequence again
+    ASSERT_FALSE(service->add_writer_change_to_storage(writer_persist_guid, change));
+
+    remove_changes(1, num_changes - num_kept);
+
+    // Reader sequence numbers
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 5u)));
+    ASSERT_TRUE(service->update_writer_seq_on_storage(reader_persist_guid, guid, SequenceNumber_t(0, 7u)));
+
+    // Reload from the file
+    open_service();
+    check_loaded_changes(num_changes - num_kept + 1, num_changes);
+
+    IPersistenceService::map_allocator_t map_pool(128, 1024);
+    foonathan::memory::map<GUID_t, SequenceNumber_t, IPersistenceService::map_allocator_t> seq_map_loaded(map_pool);
+    ASSERT_TRUE(service->load_reader_from_storage(reader_persist_guid, seq_map_loaded));
+    ASSERT_EQ(seq_map_loaded.size(), 1u);
+    ASSERT_EQ(seq_map_loaded[guid], SequenceNumber_t(0, 7u));
+}
+
+/*!
+ * This test checks that a change which is not stored does not modify the last sequence number of the writer.
+ */
+TEST_F(LogFilePersistenceTests, rejected_change_keeps_last_sequence)
+{
+    add_changes(1, 5);
+
+    // Adding an already stored sequence fails
+    change.sequenceNumber.low = 3;
+    ASSERT_FALSE(service->add_writer_change_to_storage(writer_persist_guid, change));
+
+    check_loaded_changes(1, 5);
+    open_service();
+    check_loaded_changes(1, 5);
+}
+
+/*!
+ * This test checks that the log is compacted in the background, keeping the changes added while it is compacted.
+ */
+TEST_F(LogFilePersistenceTests, background_compaction)
+{
+    constexpr uint32_t num_changes = 3000;
+    add_changes(1, num_changes);
+    uint64_t full_size = logfile_size();
+
+    // Removing most changes triggers compactions, while changes keep being added
+    remove_changes(1, num_changes - 10);
+    add_changes(num_changes + 1, num_changes + 100);
+
+    auto max_time = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while ((logfile_size() >= full_size / 2) && (std::chrono::steady_clock::now() < max_time))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_LT(logfile_size(), full_size / 2);
+
+    // The index is still valid after compacting the log, and so is the log itself
+    check_loaded_changes(num_changes - 9, num_changes + 100);
+    open_service();
+    check_loaded_changes(num_changes - 9, num_changes + 100);
+}
+
+/*!
+ * This test checks that an incomplete record at the end of the log is dropped, so the records added after reopening
+ * it are loaded.
+ */
+TEST_F(LogFilePersistenceTests, incomplete_record_dropped)
+{
+    add_changes(1, 5);
+    delete service;
+    service = nullptr;
+
+    // Simulate a crash while a record was being written
+    FILE* file = fopen(logfile.c_str(), "ab");
+    ASSERT_NE(file, nullptr);
+    const char partial_record[] = "FDPL\x01";
+    ASSERT_EQ(1u, fwrite(partial_record, sizeof(partial_record) - 1, 1, file));
+    fclose(file);
+
+    open_service();
+    check_loaded_changes(1, 5);
+    add_changes(6, 10);
+
+    open_service();
+    check_loaded_changes(1, 10);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
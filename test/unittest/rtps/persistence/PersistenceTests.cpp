@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
 #include <climits>
+#include <cstring>
 #include <sstream>
 
 #include <gtest/gtest.h>
@@ -265,7 +267,7 @@ TEST_F(PersistenceTest, Writer)
     policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
 
     // Get service from factory
-    service = PersistenceFactory::create_persistence_service(policy);
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
     ASSERT_NE(service, nullptr);
 
     auto init_cache = [](CacheChange_t* item)
@@ -341,6 +343,148 @@ TEST_F(PersistenceTest, Writer)
     ASSERT_EQ(max_seq, SequenceNumber_t(0, 2u));
 }
 
+/*!
+ * @fn TEST_F(PersistenceTest, WriterAsyncCommit)
+ * @brief This test checks the writer persistence interface when changes are committed asynchronously.
+ */
+TEST_F(PersistenceTest, WriterAsyncCommit)
+{
+    using testing::_;
+
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_commit_latency_ms", "50");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
+    ASSERT_NE(service, nullptr);
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 200, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    SequenceNumber_t max_seq;
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    WriterHistory history;
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    auto create_change = [&pool](uint32_t, ChangeKind_t, InstanceHandle_t)
+            {
+                CacheChange_t* ch = nullptr;
+                return pool->reserve_cache(ch) ? ch : nullptr;
+            };
+    EXPECT_CALL(history, create_change(_, _, _))
+            .Times(testing::AnyNumber())
+            .WillRepeatedly(testing::Invoke(create_change));
+
+    // Add a batch of changes and remove half of them
+    constexpr uint32_t num_changes = 100;
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    for (uint32_t i = 1; i <= num_changes / 2; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->remove_writer_change_from_storage(persist_guid, change));
+    }
+    ASSERT_TRUE(service->flush(std::chrono::steady_clock::now() + std::chrono::seconds(10)));
+
+    // Loading should return the changes not removed, even the ones queued after the flush
+    change.sequenceNumber.low = num_changes + 1;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), num_changes / 2 + 1);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes + 1));
+
+    // Changes still queued are committed when the service is destroyed
+    change.sequenceNumber.low = num_changes + 2;
+    ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    delete service;
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
+    ASSERT_NE(service, nullptr);
+    history.m_changes.clear();
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), num_changes / 2 + 2);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes + 2));
+}
+
+/*!
+ * @fn TEST_F(PersistenceTest, WriterAsyncCommitLockedDatabase)
+ * @brief This test checks that the changes committed asynchronously while another connection keeps the database
+ * locked are retried, and not reported as committed until they are stored.
+ */
+TEST_F(PersistenceTest, WriterAsyncCommitLockedDatabase)
+{
+    using testing::_;
+
+    const std::string persist_guid("TEST_WRITER");
+
+    PropertyPolicy policy;
+    policy.properties().emplace_back("dds.persistence.plugin", "builtin.SQLITE3");
+    policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
+    policy.properties().emplace_back("dds.persistence.sqlite3.max_commit_latency_ms", "50");
+
+    // Get service from factory
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
+    ASSERT_NE(service, nullptr);
+
+    // Lock the database from another connection for longer than the busy timeout of the commit thread
+    sqlite3* locking_db = nullptr;
+    ASSERT_EQ(SQLITE_OK, sqlite3_open_v2(dbfile.c_str(), &locking_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_PRIVATECACHE,
+            nullptr));
+    ASSERT_EQ(SQLITE_OK, sqlite3_exec(locking_db, "BEGIN EXCLUSIVE TRANSACTION;", nullptr, nullptr, nullptr));
+
+    CacheChange_t change;
+    GUID_t guid(GuidPrefix_t::unknown(), 1U);
+    change.kind = ALIVE;
+    change.writerGUID = guid;
+    change.serializedPayload.length = 0;
+
+    constexpr uint32_t num_changes = 10;
+    for (uint32_t i = 1; i <= num_changes; ++i)
+    {
+        change.sequenceNumber.low = i;
+        ASSERT_TRUE(service->add_writer_change_to_storage(persist_guid, change));
+    }
+    EXPECT_FALSE(service->flush(std::chrono::steady_clock::now() + std::chrono::milliseconds(1500)));
+
+    ASSERT_EQ(SQLITE_OK, sqlite3_exec(locking_db, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr));
+    sqlite3_close(locking_db);
+    ASSERT_TRUE(service->flush(std::chrono::steady_clock::now() + std::chrono::seconds(10)));
+
+    auto init_cache = [](CacheChange_t* item)
+            {
+                item->serializedPayload.reserve(128);
+            };
+    PoolConfig cfg{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 0, 200, 0 };
+    auto pool = std::make_shared<CacheChangePool>(cfg, init_cache);
+    auto create_change = [&pool](uint32_t, ChangeKind_t, InstanceHandle_t)
+            {
+                CacheChange_t* ch = nullptr;
+                return pool->reserve_cache(ch) ? ch : nullptr;
+            };
+    WriterHistory history;
+    EXPECT_CALL(history, create_change(_, _, _))
+            .Times(testing::AnyNumber())
+            .WillRepeatedly(testing::Invoke(create_change));
+
+    SequenceNumber_t max_seq;
+    ASSERT_TRUE(service->load_writer_from_storage(persist_guid, guid, &history, max_seq));
+    ASSERT_EQ(history.m_changes.size(), num_changes);
+    ASSERT_EQ(max_seq, SequenceNumber_t(0, num_changes));
+}
+
 /*!
  * @fn TEST_F(PersistenceTest, SchemaVersionMismatch)
  * @brief This test checks that an error is issued if the database has an old schema.
@@ -359,7 +503,7 @@ TEST_F(PersistenceTest, SchemaVersionMismatch)
     policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
 
     // Loading an old schema version should fail
-    service = PersistenceFactory::create_persistence_service(policy);
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
     ASSERT_EQ(service, nullptr);
 }
 
@@ -388,7 +532,7 @@ TEST_P(PersistenceTest, SchemaVersionUpdate)
     policy.properties().emplace_back("dds.persistence.update_schema", "true");
 
     // Get service from factory
-    service = PersistenceFactory::create_persistence_service(policy);
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
     ASSERT_NE(service, nullptr);
 
     auto init_cache = [](CacheChange_t* item)
@@ -440,7 +584,7 @@ TEST_F(PersistenceTest, Reader)
     policy.properties().emplace_back("dds.persistence.sqlite3.filename", dbfile);
 
     // Get service from factory
-    service = PersistenceFactory::create_persistence_service(policy);
+    service = PersistenceFactory::create_persistence_service(policy, ThreadSettings());
     ASSERT_NE(service, nullptr);
 
     IPersistenceService::map_allocator_t pool(128, 1024);
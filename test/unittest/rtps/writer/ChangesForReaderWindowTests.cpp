@@ -0,0 +1,338 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/writer/ChangesForReaderWindow.hpp>
+
+using namespace eprosima::fastdds;
+using namespace eprosima::fastdds::rtps;
+
+class ChangesForReaderWindowTests : public ::testing::Test
+{
+protected:
+
+    CacheChange_t* create_change(
+            uint64_t seq_num)
+    {
+        changes_.emplace_back(new CacheChange_t());
+        changes_.back()->sequenceNumber = SequenceNumber_t(seq_num);
+        return changes_.back().get();
+    }
+
+    ChangeForReader_t change_for_reader(
+            uint64_t seq_num,
+            ChangeForReaderStatus_t status)
+    {
+        ChangeForReader_t change(create_change(seq_num));
+        change.setStatus(status);
+        return change;
+    }
+
+    //! Checks the window holds the same changes, with the same status, as the model.
+    void check(
+            const ChangesForReaderWindow& window,
+            const std::map<uint64_t, ChangeForReaderStatus_t>& model)
+    {
+        ASSERT_EQ(model.size(), window.size());
+        size_t pos = window.begin();
+        for (const auto& entry : model)
+        {
+            ASSERT_EQ(SequenceNumber_t(entry.first), window.sequence_number(pos));
+            ASSERT_EQ(entry.second, window.status(pos));
+            ASSERT_EQ(pos, window.find(SequenceNumber_t(entry.first)));
+            ++pos;
+        }
+        ASSERT_EQ(window.end(), pos);
+    }
+
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+};
+
+/*!
+ * Changes are found by sequence number, also when there are holes in the window.
+ */
+TEST_F(ChangesForReaderWindowTests, find)
+{
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig(), false);
+    EXPECT_TRUE(window.empty());
+    EXPECT_EQ(window.end(), window.find(SequenceNumber_t(1)));
+
+    for (uint64_t seq : {1u, 2u, 3u, 6u, 7u})
+    {
+        ASSERT_TRUE(window.push_back(change_for_reader(seq, UNSENT)));
+    }
+
+    EXPECT_EQ(5u, window.size());
+    EXPECT_EQ(window.begin(), window.find(SequenceNumber_t(1)));
+    EXPECT_EQ(window.begin() + 2, window.find(SequenceNumber_t(3)));
+    EXPECT_EQ(window.end(), window.find(SequenceNumber_t(4)));
+    EXPECT_EQ(window.end(), window.find(SequenceNumber_t(5)));
+    EXPECT_EQ(window.begin() + 3, window.find(SequenceNumber_t(6)));
+    EXPECT_EQ(window.begin() + 3, window.lower_bound(SequenceNumber_t(4)));
+    EXPECT_EQ(window.end(), window.lower_bound(SequenceNumber_t(8)));
+}
+
+/*!
+ * Runs of acknowledged changes stop on the first change not acknowledged, and on the first hole.
+ */
+TEST_F(ChangesForReaderWindowTests, acknowledged_run_end)
+{
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig(), false);
+    for (uint64_t seq = 1; seq <= 200; ++seq)
+    {
+        if (seq != 150)
+        {
+            ASSERT_TRUE(window.push_back(change_for_reader(seq, seq == 100 ? UNACKNOWLEDGED : ACKNOWLEDGED)));
+        }
+    }
+
+    size_t first = window.begin();
+    EXPECT_EQ(first + 99, window.acknowledged_run_end(first, SequenceNumber_t(1)));
+    EXPECT_EQ(first, window.acknowledged_run_end(first, SequenceNumber_t(2)));
+
+    // A run starting after the unacknowledged change stops on the hole.
+    size_t pos = window.find(SequenceNumber_t(101));
+    EXPECT_EQ(window.find(SequenceNumber_t(151)), window.acknowledged_run_end(pos, SequenceNumber_t(101)));
+
+    // A run starting after the hole reaches the end.
+    pos = window.find(SequenceNumber_t(151));
+    EXPECT_EQ(window.end(), window.acknowledged_run_end(pos, SequenceNumber_t(151)));
+
+    window.erase_front(window.find(SequenceNumber_t(100)));
+    EXPECT_EQ(SequenceNumber_t(100), window.sequence_number(window.begin()));
+    EXPECT_EQ(100u, window.size());
+}
+
+/*!
+ * A run starting on a change not acknowledged is empty, also when it is the first change of the window.
+ */
+TEST_F(ChangesForReaderWindowTests, acknowledged_run_end_first_unacknowledged)
+{
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig(), false);
+    ASSERT_TRUE(window.push_back(change_for_reader(1, UNACKNOWLEDGED)));
+    ASSERT_TRUE(window.push_back(change_for_reader(2, ACKNOWLEDGED)));
+
+    size_t first = window.begin();
+    EXPECT_EQ(first, window.acknowledged_run_end(first, SequenceNumber_t(1)));
+    EXPECT_EQ(window.end(), window.acknowledged_run_end(first + 1, SequenceNumber_t(2)));
+}
+
+/*!
+ * The maximum number of changes also counts the removed changes not discarded yet, which are discarded to make room
+ * for new changes.
+ */
+TEST_F(ChangesForReaderWindowTests, maximum_changes)
+{
+    constexpr size_t max_changes = 100;
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig::fixed_size_configuration(max_changes), false);
+    std::map<uint64_t, ChangeForReaderStatus_t> model;
+    uint64_t next_seq = 1;
+    for (; next_seq <= max_changes; ++next_seq)
+    {
+        ASSERT_TRUE(window.push_back(change_for_reader(next_seq, UNACKNOWLEDGED)));
+        model[next_seq] = UNACKNOWLEDGED;
+    }
+    EXPECT_FALSE(window.push_back(change_for_reader(next_seq, UNACKNOWLEDGED)));
+
+    // Removing a few changes, less than the ones discarded lazily, makes room for the same number of changes.
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        window.erase_front(window.begin() + 1);
+        model.erase(model.begin());
+        ASSERT_TRUE(window.push_back(change_for_reader(next_seq, REQUESTED)));
+        model[next_seq++] = REQUESTED;
+        EXPECT_FALSE(window.push_back(change_for_reader(next_seq, UNACKNOWLEDGED)));
+        check(window, model);
+    }
+
+    // A change can also be inserted in a hole after discarding the removed changes.
+    window.erase(window.find(SequenceNumber_t(50)));
+    model.erase(50);
+    window.erase_front(window.begin() + 1);
+    model.erase(model.begin());
+    ASSERT_TRUE(window.insert(change_for_reader(50, ACKNOWLEDGED)));
+    model[50] = ACKNOWLEDGED;
+    check(window, model);
+}
+
+/*!
+ * Status conversions only affect the changes with the given status.
+ */
+TEST_F(ChangesForReaderWindowTests, convert_status)
+{
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig(), false);
+    for (uint64_t seq = 1; seq <= 300; ++seq)
+    {
+        ASSERT_TRUE(window.push_back(change_for_reader(seq, 0 == seq % 3 ? REQUESTED : UNACKNOWLEDGED)));
+    }
+
+    std::vector<SequenceNumber_t> converted;
+    EXPECT_EQ(100u, window.convert_status(REQUESTED, UNSENT, [&](size_t pos)
+            {
+                converted.push_back(window.sequence_number(pos));
+            }));
+    ASSERT_EQ(100u, converted.size());
+    for (size_t i = 0; i < converted.size(); ++i)
+    {
+        EXPECT_EQ(SequenceNumber_t(3 * (i + 1)), converted[i]);
+        EXPECT_EQ(UNSENT, window.status(window.find(converted[i])));
+    }
+
+    EXPECT_FALSE(window.any(REQUESTED));
+    EXPECT_TRUE(window.any(UNACKNOWLEDGED));
+    EXPECT_EQ(0u, window.convert_status(REQUESTED, UNSENT, [](size_t)
+            {
+            }));
+}
+
+/*!
+ * Random operations keep the window equal to a simple model of the changes.
+ */
+TEST_F(ChangesForReaderWindowTests, random_operations)
+{
+    ChangesForReaderWindow window(ResourceLimitedContainerConfig(), true);
+    std::map<uint64_t, ChangeForReaderStatus_t> model;
+    std::mt19937 gen(12345);
+    uint64_t next_seq = 1;
+
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+        uint32_t operation = gen() % 10;
+        if (operation < 4)
+        {
+            // Add a change, maybe leaving a hole.
+            next_seq += gen() % 3;
+            auto status = static_cast<ChangeForReaderStatus_t>(gen() % 5);
+            ASSERT_TRUE(window.push_back(change_for_reader(next_seq, status)));
+            model[next_seq] = status;
+            ++next_seq;
+        }
+        else if (operation < 5 && !model.empty())
+        {
+            // Fill a hole.
+            uint64_t seq = model.begin()->first + gen() % (next_seq - model.begin()->first);
+            if (model.end() == model.find(seq))
+            {
+                ASSERT_TRUE(window.insert(change_for_reader(seq, UNACKNOWLEDGED)));
+                model[seq] = UNACKNOWLEDGED;
+            }
+        }
+        else if (operation < 6 && !model.empty())
+        {
+            // Remove a change.
+            auto it = model.begin();
+            std::advance(it, gen() % model.size());
+            window.erase(window.find(SequenceNumber_t(it->first)));
+            model.erase(it);
+        }
+        else if (operation < 7 && !model.empty())
+        {
+            // Acknowledge the first changes.
+            size_t count = gen() % (model.size() + 1);
+            auto it = model.begin();
+            std::advance(it, count);
+            window.erase_front(window.begin() + count);
+            model.erase(model.begin(), it);
+        }
+        else if (operation < 8)
+        {
+            auto previous = static_cast<ChangeForReaderStatus_t>(1 + gen() % 4);
+            auto next = static_cast<ChangeForReaderStatus_t>(gen() % 5);
+            if (previous != next)
+            {
+                uint32_t expected = 0;
+                for (auto& entry : model)
+                {
+                    if (entry.second == previous)
+                    {
+                        entry.second = next;
+                        ++expected;
+                    }
+                }
+                ASSERT_EQ(expected, window.convert_status(previous, next, [](size_t)
+                        {
+                        }));
+            }
+        }
+        else if (!model.empty())
+        {
+            // Change the status of a change.
+            auto it = model.begin();
+            std::advance(it, gen() % model.size());
+            it->second = static_cast<ChangeForReaderStatus_t>(gen() % 5);
+            window.status(window.find(SequenceNumber_t(it->first)), it->second);
+        }
+
+        if (0 == i % 64)
+        {
+            check(window, model);
+        }
+    }
+    check(window, model);
+}
+
+/*!
+ * Acknowledging the changes of many readers, each one with a deep window of unacknowledged changes.
+ */
+TEST_F(ChangesForReaderWindowTests, acknowledge_many_readers)
+{
+    constexpr uint64_t history_depth = 10000;
+    constexpr size_t num_readers = 100;
+    constexpr uint64_t acknack_step = 16;
+
+    for (uint64_t seq = 1; seq <= history_depth; ++seq)
+    {
+        create_change(seq);
+    }
+
+    std::vector<std::unique_ptr<ChangesForReaderWindow>> readers;
+    for (size_t i = 0; i < num_readers; ++i)
+    {
+        readers.emplace_back(new ChangesForReaderWindow(ResourceLimitedContainerConfig(), false));
+        for (auto& change : changes_)
+        {
+            ChangeForReader_t change_for_reader(change.get());
+            change_for_reader.setStatus(UNACKNOWLEDGED);
+            ASSERT_TRUE(readers.back()->push_back(change_for_reader));
+        }
+    }
+
+    for (uint64_t ack = acknack_step + 1; ack <= history_depth + 1; ack += acknack_step)
+    {
+        for (auto& reader : readers)
+        {
+            size_t pos = reader->lower_bound(SequenceNumber_t(ack));
+            reader->erase_front(pos);
+        }
+    }
+
+    for (auto& reader : readers)
+    {
+        EXPECT_TRUE(reader->empty());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <atomic>
 #include <map>
 #include <thread>
 
@@ -239,13 +240,20 @@ protected:
 
 public:
 
-    void create_participant()
+    void create_participant(
+            uint32_t counters_publication_period_ms = 0)
     {
         using namespace fastdds::rtps;
 
         // create the participant
         RTPSParticipantAttributes p_attr;
 
+        if (0 < counters_publication_period_ms)
+        {
+            p_attr.properties.properties().emplace_back("fastdds.statistics.counters_publication_period",
+                    std::to_string(counters_publication_period_ms));
+        }
+
         // use leaky transport
         // as filter use a fixture provided functor
         test_transport_descriptor_ = std::make_shared<test_Descriptor>();
@@ -1086,6 +1094,61 @@ TEST_F(RTPSStatisticsTests, statistics_rpts_listener_gap_callback)
     EXPECT_TRUE(participant_->remove_statistics_listener(participant_writer_listener, EventKind::GAP_COUNT));
 }
 
+/*
+ * This test checks that, when the counters publication period is set on the participant, the writer counters are
+ * reported periodically instead of on every event.
+ */
+TEST_F(RTPSStatisticsTests, statistics_rpts_aggregated_counters)
+{
+    using namespace ::testing;
+    using namespace fastdds;
+    using namespace fastdds::rtps;
+    using namespace std;
+
+    constexpr uint32_t period_ms = 200;
+    constexpr uint64_t num_samples = 20;
+
+    // replace the fixture participant with one that aggregates the counters
+    remove_participant();
+    create_participant(period_ms);
+
+    uint32_t enable_writers_mask = EventKind::DATA_COUNT | EventKind::HEARTBEAT_COUNT;
+
+    auto writer_listener = make_shared<MockListener>();
+    auto last_data_count = make_shared<std::atomic<uint64_t>>(0);
+
+    EXPECT_CALL(*writer_listener, on_data_count)
+            .Times(Between(1, static_cast<int>(num_samples) - 1))
+            .WillRepeatedly(Invoke([last_data_count](const EntityCount& count)
+            {
+                last_data_count->store(count.count());
+            }));
+    EXPECT_CALL(*writer_listener, on_heartbeat_count)
+            .Times(AnyNumber());
+
+    uint16_t length = 255;
+    create_endpoints(length, RELIABLE);
+    writer_->set_enabled_statistics_writers_mask(enable_writers_mask);
+    ASSERT_TRUE(writer_->add_statistics_listener(writer_listener));
+
+    // match writer and reader on a dummy topic
+    match_endpoints(false, "string", "statisticsSmallTopic");
+
+    for (uint64_t i = 0; i < num_samples; ++i)
+    {
+        write_small_sample(length);
+    }
+
+    // wait for acknowledgement
+    EXPECT_TRUE(writer_->wait_for_all_acked(dds::Duration_t(5, 0)));
+
+    // let the periodic publication report the final value
+    this_thread::sleep_for(chrono::milliseconds(3 * period_ms));
+    EXPECT_GE(last_data_count->load(), num_samples);
+
+    EXPECT_TRUE(writer_->remove_statistics_listener(writer_listener));
+}
+
 /*
  * This test checks the participant discovery callbacks
  */
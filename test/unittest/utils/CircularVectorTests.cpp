@@ -0,0 +1,249 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/CircularVector.hpp>
+#include <utils/collections/sorted_vector_insert.hpp>
+
+using namespace eprosima::fastdds;
+
+template<typename Collection>
+static void expect_same_contents(
+        const Collection& uut,
+        const std::vector<int>& expected)
+{
+    ASSERT_EQ(uut.size(), expected.size());
+    ASSERT_EQ(uut.empty(), expected.empty());
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), uut.begin()));
+    EXPECT_TRUE(std::equal(expected.rbegin(), expected.rend(), uut.rbegin()));
+    EXPECT_EQ(static_cast<std::ptrdiff_t>(expected.size()), std::distance(uut.begin(), uut.end()));
+    if (!expected.empty())
+    {
+        EXPECT_EQ(expected.front(), uut.front());
+        EXPECT_EQ(expected.back(), uut.back());
+    }
+}
+
+TEST(CircularVectorTests, iterators)
+{
+    CircularVector<int> uut;
+    for (int i = 0; i < 10; ++i)
+    {
+        uut.push_back(i);
+    }
+
+    CircularVector<int>::iterator it = uut.begin();
+    CircularVector<int>::const_iterator cit = it;
+    EXPECT_TRUE(cit == it);
+    EXPECT_TRUE(it == cit);
+    EXPECT_EQ(0, *cit);
+
+    it += 5;
+    EXPECT_EQ(5, *it);
+    EXPECT_EQ(6, it[1]);
+    EXPECT_EQ(4, *(it - 1));
+    EXPECT_EQ(7, *(2 + it));
+    EXPECT_EQ(5, it - cit);
+    EXPECT_TRUE(cit < it);
+    EXPECT_TRUE(it >= cit);
+    EXPECT_TRUE(it != uut.cend());
+
+    *it = 50;
+    EXPECT_EQ(50, uut[5]);
+
+    EXPECT_EQ(9, *uut.rbegin());
+    EXPECT_EQ(0, *std::prev(uut.rend()));
+
+    const CircularVector<int>& const_uut = uut;
+    EXPECT_EQ(10, std::count_if(const_uut.begin(), const_uut.end(), [](int)
+            {
+                return true;
+            }));
+}
+
+TEST(CircularVectorTests, wrap_around)
+{
+    CircularVector<int> uut;
+    uut.reserve(16);
+    std::vector<int> expected;
+
+    // Keep a window of 10 elements moving along the buffer, so it wraps around several times.
+    for (int i = 0; i < 100; ++i)
+    {
+        if (10 == expected.size())
+        {
+            uut.pop_front();
+            expected.erase(expected.begin());
+        }
+        uut.push_back(i);
+        expected.push_back(i);
+        expect_same_contents(uut, expected);
+    }
+    EXPECT_EQ(16u, uut.capacity());
+
+    // Grow the buffer when the contents are wrapped.
+    for (int i = 100; i < 120; ++i)
+    {
+        uut.push_back(i);
+        expected.push_back(i);
+    }
+    expect_same_contents(uut, expected);
+
+    uut.clear();
+    expected.clear();
+    expect_same_contents(uut, expected);
+}
+
+TEST(CircularVectorTests, sorted_insertion)
+{
+    CircularVector<int> uut;
+    std::vector<int> expected;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> value(0, 1000);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        int v = value(gen);
+        eprosima::utilities::collections::sorted_vector_insert(uut, v);
+        eprosima::utilities::collections::sorted_vector_insert(expected, v);
+
+        if (0 == i % 3)
+        {
+            uut.pop_front();
+            expected.erase(expected.begin());
+        }
+    }
+
+    expect_same_contents(uut, expected);
+    EXPECT_TRUE(std::is_sorted(uut.begin(), uut.end()));
+}
+
+TEST(CircularVectorTests, random_operations)
+{
+    CircularVector<int> uut;
+    std::vector<int> expected;
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> operation(0, 5);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        switch (operation(gen))
+        {
+            case 0:
+            case 1:
+                uut.push_back(i);
+                expected.push_back(i);
+                break;
+
+            case 2:
+            {
+                size_t pos = std::uniform_int_distribution<size_t>(0, expected.size())(gen);
+                auto it = uut.insert(uut.cbegin() + pos, i);
+                EXPECT_EQ(i, *it);
+                expected.insert(expected.begin() + pos, i);
+                break;
+            }
+
+            case 3:
+                if (!expected.empty())
+                {
+                    size_t pos = std::uniform_int_distribution<size_t>(0, expected.size() - 1)(gen);
+                    auto it = uut.erase(uut.cbegin() + pos);
+                    EXPECT_EQ(static_cast<std::ptrdiff_t>(pos), it - uut.begin());
+                    expected.erase(expected.begin() + pos);
+                }
+                break;
+
+            case 4:
+                if (!expected.empty())
+                {
+                    size_t first = std::uniform_int_distribution<size_t>(0, expected.size() - 1)(gen);
+                    size_t max_last = (std::min)(first + 5, expected.size());
+                    size_t last = std::uniform_int_distribution<size_t>(first, max_last)(gen);
+                    uut.erase(uut.cbegin() + first, uut.cbegin() + last);
+                    expected.erase(expected.begin() + first, expected.begin() + last);
+                }
+                break;
+
+            default:
+                if (!expected.empty())
+                {
+                    uut.pop_front();
+                    expected.erase(expected.begin());
+                }
+                break;
+        }
+
+        expect_same_contents(uut, expected);
+        if (HasFailure())
+        {
+            FAIL() << "Failed on operation " << i;
+        }
+    }
+}
+
+/*
+ * Keeps the last elements of the given depth of an in-order sequence, as KEEP_LAST queues do.
+ */
+template<typename Collection>
+static void keep_last_run(
+        Collection& elements,
+        size_t depth,
+        uintptr_t num_elements)
+{
+    elements.reserve(depth);
+    for (uintptr_t i = 1; i <= num_elements; ++i)
+    {
+        if (depth == elements.size())
+        {
+            elements.erase(elements.begin());
+        }
+        eprosima::utilities::collections::sorted_vector_insert(elements, reinterpret_cast<void*>(i));
+    }
+}
+
+/*
+ * Keeping the last elements on a CircularVector gives the same result as on a std::vector, without growing once it is
+ * full.
+ */
+TEST(CircularVectorTests, keep_last)
+{
+    constexpr size_t depth = 100;
+    constexpr uintptr_t num_elements = 1000;
+
+    CircularVector<void*> ring;
+    std::vector<void*> vector;
+    keep_last_run(ring, depth, num_elements);
+    keep_last_run(vector, depth, num_elements);
+
+    EXPECT_EQ(depth, ring.capacity());
+    ASSERT_EQ(depth, ring.size());
+    EXPECT_TRUE(std::equal(vector.begin(), vector.end(), ring.begin()));
+    EXPECT_EQ(reinterpret_cast<void*>(num_elements - depth + 1), ring.front());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+// Copyright 2026 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/DeadlineQueue.hpp>
+
+using namespace eprosima::utilities::collections;
+
+using time_point = DeadlineQueue<int>::time_point;
+
+static const time_point t0 = std::chrono::steady_clock::now();
+
+static time_point at(
+        int ms)
+{
+    return t0 + std::chrono::milliseconds(ms);
+}
+
+static void expect_front(
+        const DeadlineQueue<int>& uut,
+        int expected_key,
+        const time_point& expected_deadline)
+{
+    int key = -1;
+    time_point deadline;
+    ASSERT_TRUE(uut.front(key, deadline));
+    EXPECT_EQ(expected_key, key);
+    EXPECT_EQ(expected_deadline, deadline);
+}
+
+TEST(DeadlineQueueTests, update_moves_to_back)
+{
+    DeadlineQueue<int> uut;
+    int key;
+    time_point deadline;
+    EXPECT_FALSE(uut.front(key, deadline));
+    EXPECT_TRUE(uut.empty());
+
+    for (int i = 0; i < 5; ++i)
+    {
+        uut.set(i, at(100 + i));
+    }
+    EXPECT_EQ(5u, uut.size());
+    expect_front(uut, 0, at(100));
+
+    // Updating the deadline with the same period moves the key behind the rest.
+    uut.set(0, at(105));
+    expect_front(uut, 1, at(101));
+    uut.set(1, at(106));
+    uut.set(2, at(107));
+    expect_front(uut, 3, at(103));
+    EXPECT_EQ(5u, uut.size());
+
+    uut.erase(3);
+    uut.erase(3);
+    expect_front(uut, 4, at(104));
+    EXPECT_EQ(4u, uut.size());
+
+    uut.clear();
+    EXPECT_TRUE(uut.empty());
+    EXPECT_FALSE(uut.front(key, deadline));
+}
+
+TEST(DeadlineQueueTests, earlier_deadline)
+{
+    DeadlineQueue<int> uut;
+    uut.set(0, at(100));
+    uut.set(1, at(200));
+    uut.set(2, at(300));
+
+    // A shorter period puts the key before others.
+    uut.set(3, at(150));
+    uut.set(2, at(50));
+    expect_front(uut, 2, at(50));
+    uut.erase(2);
+    expect_front(uut, 0, at(100));
+    uut.erase(0);
+    expect_front(uut, 3, at(150));
+
+    // Setting the same deadline again keeps the key on its position.
+    uut.set(3, at(150));
+    expect_front(uut, 3, at(150));
+}
+
+TEST(DeadlineQueueTests, random_operations)
+{
+    DeadlineQueue<int> uut;
+    std::map<int, int> expected;
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> key_dist(0, 50);
+    std::uniform_int_distribution<int> deadline_dist(0, 1000);
+    std::uniform_int_distribution<int> operation(0, 3);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        int key = key_dist(gen);
+        if (0 == operation(gen))
+        {
+            uut.erase(key);
+            expected.erase(key);
+        }
+        else
+        {
+            int deadline = deadline_dist(gen);
+            uut.set(key, at(deadline));
+            expected[key] = deadline;
+        }
+
+        ASSERT_EQ(expected.size(), uut.size());
+        if (!expected.empty())
+        {
+            auto min = std::min_element(expected.begin(), expected.end(),
+                            [](const std::pair<const int, int>& lhs, const std::pair<const int, int>& rhs)
+                            {
+                                return lhs.second < rhs.second;
+                            });
+            int front_key;
+            time_point front_deadline;
+            ASSERT_TRUE(uut.front(front_key, front_deadline));
+            EXPECT_EQ(at(min->second), front_deadline);
+            EXPECT_EQ(min->second, expected[front_key]);
+        }
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
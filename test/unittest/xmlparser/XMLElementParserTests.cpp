@@ -2205,7 +2205,8 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
         {"FIFO", FlowControllerSchedulerPolicy::FIFO},
         {"ROUND_ROBIN", FlowControllerSchedulerPolicy::ROUND_ROBIN},
         {"HIGH_PRIORITY", FlowControllerSchedulerPolicy::HIGH_PRIORITY},
-        {"PRIORITY_WITH_RESERVATION", FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION}
+        {"PRIORITY_WITH_RESERVATION", FlowControllerSchedulerPolicy::PRIORITY_WITH_RESERVATION},
+        {"EARLIEST_DEADLINE_FIRST", FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST}
     };
 
     /* Define the test cases */
@@ -2224,6 +2225,10 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
             "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
         {{"test_flow_controller", "PRIORITY_WITH_RESERVATION", "2500", "100", \
             "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
+        {{"test_flow_controller", "EARLIEST_DEADLINE_FIRST", "2500", "100", \
+            "15", "12", "12", "12", "" }, XMLP_ret::XML_OK},
+        {{"test_flow_controller", "FIFO", "2500", "100", \
+            "15", "12", "12", "12", "<max_burst_bytes>1500</max_burst_bytes>" }, XMLP_ret::XML_OK},
         {{"test_flow_controller", "INVALID", "120", "50", \
             "12", "12", "12", "12", "" }, XMLP_ret::XML_ERROR},   // Invalid scheduler
         {{"test_flow_controller", "HIGH_PRIORITY", "120", "-10", \
@@ -2240,6 +2245,8 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
             "12", "12", "12", "12", "<max_bytes_per_period>96</max_bytes_per_period>" }, XMLP_ret::XML_ERROR},   // duplicated max_bytes_per_period tag
         {{"test_flow_controller", "HIGH_PRIORITY", "120", "50", \
             "12", "12", "12", "12", "<period_ms>96</period_ms>" }, XMLP_ret::XML_ERROR},   // duplicated period_ms tag
+        {{"test_flow_controller", "HIGH_PRIORITY", "120", "50", \
+            "12", "12", "12", "12", "<max_burst_bytes>abc</max_burst_bytes>" }, XMLP_ret::XML_ERROR},   // invalid max_burst_bytes
         {{"test_flow_controller", "HIGH_PRIORITY", "120", "50", \
             "12", "12", "12", "12", "<sender_thread><scheduling_policy>12</scheduling_policy></sender_thread>" },
             XMLP_ret::XML_ERROR}, // duplicated sender_thread tag
@@ -2293,6 +2300,7 @@ TEST_F(XMLParserTests, getXMLFlowControllerDescriptorList)
             ASSERT_EQ(flow_controller_descriptor_list.at(0)->max_bytes_per_period,
                     static_cast<int32_t>(std::stoi(params[2])));
             ASSERT_EQ(flow_controller_descriptor_list.at(0)->period_ms, static_cast<uint64_t>(std::stoi(params[3])));
+            ASSERT_EQ(flow_controller_descriptor_list.at(0)->max_burst_bytes, params[8].empty() ? 0u : 1500u);
             ASSERT_EQ(flow_controller_descriptor_list.at(0)->sender_thread.scheduling_policy,
                     static_cast<int32_t>(std::stoi(params[4])));
             ASSERT_EQ(flow_controller_descriptor_list.at(0)->sender_thread.priority,